@@ -0,0 +1,376 @@
+/**
+ * @file
+ * Copyright &copy; AUDI AG. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ */
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+#include "data_sample.h"
+
+namespace fep3
+{
+namespace arya
+{
+namespace detail
+{
+
+/**
+ * @brief Shared state of a @ref DataSamplePool
+ * The state is kept alive by every sample obtained from the pool, so samples may outlive the pool itself.
+ */
+class DataSamplePoolState
+{
+public:
+    /**
+     * @brief CTOR
+     *
+     * @param min_sample_size capacity in bytes of the smallest size class
+     * @param size_class_count number of size classes, every size class doubles the capacity of the previous one
+     */
+    DataSamplePoolState(size_t min_sample_size, size_t size_class_count)
+        : _min_sample_size(min_sample_size > 0 ? min_sample_size : 1)
+        , _free_samples(size_class_count)
+    {
+    }
+    /**
+     * @brief DTOR
+     * Deletes all samples and control blocks which are currently free.
+     */
+    ~DataSamplePoolState()
+    {
+        for (auto& free_samples : _free_samples)
+        {
+            for (auto sample : free_samples)
+            {
+                delete sample;
+            }
+        }
+        for (auto sample : _free_oversized_samples)
+        {
+            delete sample;
+        }
+        for (auto block : _free_blocks)
+        {
+            ::operator delete(block);
+        }
+    }
+    DataSamplePoolState(const DataSamplePoolState&) = delete;
+    DataSamplePoolState(DataSamplePoolState&&) = delete;
+    DataSamplePoolState& operator=(const DataSamplePoolState&) = delete;
+    DataSamplePoolState& operator=(DataSamplePoolState&&) = delete;
+
+    /**
+     * @brief Get the index of the smallest size class which can hold @p size bytes
+     *
+     * @param size the size in bytes
+     * @return the size class index, or the size class count if @p size exceeds the largest size class
+     */
+    size_t getSizeClass(size_t size) const
+    {
+        size_t size_class = 0;
+        size_t capacity = _min_sample_size;
+        while (size_class < _free_samples.size() && capacity < size)
+        {
+            ++size_class;
+            capacity *= 2;
+        }
+        return size_class;
+    }
+
+    /**
+     * @brief Get a sample of the given size class which is not used by anyone else
+     * Samples exceeding the largest size class are reused by capacity, if no free one is large enough
+     * the largest free one is reallocated to @p size, so their number does not exceed the number of such samples
+     * in use at the same time.
+     *
+     * @param size_class the size class index (see @ref getSizeClass)
+     * @param size the requested size in bytes, only used if @p size_class exceeds the largest size class
+     * @return the sample with reset time, counter and size
+     */
+    DataSample* acquireSample(size_t size_class, size_t size)
+    {
+        DataSample* sample = nullptr;
+        if (size_class >= _free_samples.size())
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (!_free_oversized_samples.empty())
+                {
+                    // sorted by capacity, so this is the smallest fitting one or the largest one if none fits
+                    auto fitting_sample = std::lower_bound(_free_oversized_samples.begin(), _free_oversized_samples.end()
+                        , size
+                        , [](const DataSample* free_sample, size_t capacity) { return free_sample->capacity() < capacity; });
+                    if (fitting_sample == _free_oversized_samples.end())
+                    {
+                        --fitting_sample;
+                    }
+                    sample = *fitting_sample;
+                    _free_oversized_samples.erase(fitting_sample);
+                }
+            }
+            if (!sample)
+            {
+                return new DataSample(size, false);
+            }
+            if (sample->capacity() < size)
+            {
+                *sample = DataSample(size, false);
+            }
+        }
+        else
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                auto& free_samples = _free_samples[size_class];
+                if (!free_samples.empty())
+                {
+                    sample = free_samples.back();
+                    free_samples.pop_back();
+                }
+            }
+            if (!sample)
+            {
+                return new DataSample(_min_sample_size << size_class, false);
+            }
+        }
+        sample->setTime(Timestamp(0));
+        sample->setCounter(0);
+        sample->resize(0);
+        return sample;
+    }
+
+    /**
+     * @brief Give a sample back to the free list of its size class
+     *
+     * @param sample the sample obtained by @ref acquireSample
+     * @param size_class the size class the sample was acquired for
+     */
+    void releaseSample(DataSample* sample, size_t size_class)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (size_class >= _free_samples.size())
+        {
+            _free_oversized_samples.insert(std::upper_bound(_free_oversized_samples.begin(), _free_oversized_samples.end()
+                , sample->capacity()
+                , [](size_t capacity, const DataSample* free_sample) { return capacity < free_sample->capacity(); })
+                , sample);
+            return;
+        }
+        _free_samples[size_class].push_back(sample);
+    }
+
+    /**
+     * @brief Allocate memory for the reference count control block of a sample
+     *
+     * @param size the size in bytes
+     * @return the memory
+     */
+    void* allocateBlock(size_t size)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            //all samples share the same control block type, so one block size is enough
+            if (_block_size == 0)
+            {
+                _block_size = size;
+            }
+            if (_block_size == size && !_free_blocks.empty())
+            {
+                void* block = _free_blocks.back();
+                _free_blocks.pop_back();
+                return block;
+            }
+        }
+        return ::operator new(size);
+    }
+
+    /**
+     * @brief Give back memory obtained by @ref allocateBlock
+     *
+     * @param block the memory
+     * @param size the size in bytes
+     */
+    void deallocateBlock(void* block, size_t size)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_block_size == size)
+            {
+                _free_blocks.push_back(block);
+                return;
+            }
+        }
+        ::operator delete(block);
+    }
+
+private:
+    const size_t _min_sample_size;
+    std::mutex _mutex;
+    std::vector<std::vector<DataSample*>> _free_samples;
+    // samples exceeding the largest size class, sorted by capacity
+    std::vector<DataSample*> _free_oversized_samples;
+    size_t _block_size{ 0 };
+    std::vector<void*> _free_blocks;
+};
+
+/**
+ * @brief Allocator for the reference count control blocks of pooled samples
+ *
+ * @tparam T the type to allocate
+ */
+template<typename T>
+class DataSamplePoolAllocator
+{
+public:
+    /// the allocated type
+    using value_type = T;
+
+    /**
+     * @brief CTOR
+     *
+     * @param state the pool state to allocate from
+     */
+    explicit DataSamplePoolAllocator(const std::shared_ptr<DataSamplePoolState>& state) : _state(state)
+    {
+    }
+    /**
+     * @brief rebind CTOR
+     *
+     * @param other the allocator to rebind
+     */
+    template<typename U>
+    DataSamplePoolAllocator(const DataSamplePoolAllocator<U>& other) : _state(other.getState())
+    {
+    }
+
+    /**
+     * @brief allocate memory for @p count objects
+     *
+     * @param count the number of objects
+     * @return the memory
+     */
+    T* allocate(size_t count)
+    {
+        return static_cast<T*>(_state->allocateBlock(count * sizeof(T)));
+    }
+    /**
+     * @brief deallocate memory obtained by @ref allocate
+     *
+     * @param pointer the memory
+     * @param count the number of objects
+     */
+    void deallocate(T* pointer, size_t count)
+    {
+        _state->deallocateBlock(pointer, count * sizeof(T));
+    }
+
+    /**
+     * @brief Get the pool state
+     *
+     * @return the pool state
+     */
+    const std::shared_ptr<DataSamplePoolState>& getState() const
+    {
+        return _state;
+    }
+
+private:
+    std::shared_ptr<DataSamplePoolState> _state;
+};
+
+/// @cond no_documentation
+template<typename T, typename U>
+bool operator==(const DataSamplePoolAllocator<T>& lhs, const DataSamplePoolAllocator<U>& rhs)
+{
+    return lhs.getState() == rhs.getState();
+}
+template<typename T, typename U>
+bool operator!=(const DataSamplePoolAllocator<T>& lhs, const DataSamplePoolAllocator<U>& rhs)
+{
+    return !(lhs == rhs);
+}
+/// @endcond no_documentation
+
+} // namespace detail
+
+/**
+ * @brief Pool of data samples with recycled memory.
+ * The samples are kept in free lists by size class (the capacity doubles from class to class).
+ * A sample goes back to the free list of its size class as soon as the last data_read_ptr to it is released,
+ * the reference count control blocks are recycled as well. So once the pool contains as many samples as
+ * are in use at the same time, getting and releasing samples does not allocate heap memory.
+ * Samples larger than the largest size class are kept in one more free list and reused by capacity.
+ * The pool may be used from several threads and the samples may outlive the pool.
+ */
+class DataSamplePool : public IDataSamplePool
+{
+public:
+    /**
+     * @brief CTOR
+     *
+     * @param min_sample_size capacity in bytes of the smallest size class
+     * @param size_class_count number of size classes
+     */
+    explicit DataSamplePool(size_t min_sample_size = 64, size_t size_class_count = 16)
+        : _state(std::make_shared<detail::DataSamplePoolState>(min_sample_size, size_class_count))
+    {
+    }
+    /**
+     * @brief DTOR
+     *
+     */
+    virtual ~DataSamplePool() = default;
+    DataSamplePool(const DataSamplePool&) = delete;
+    DataSamplePool(DataSamplePool&&) = delete;
+    DataSamplePool& operator=(const DataSamplePool&) = delete;
+    DataSamplePool& operator=(DataSamplePool&&) = delete;
+
+    data_read_ptr<IDataSample> getSample() override
+    {
+        return getSample(0);
+    }
+
+    /**
+     * @brief Get one sample object with managed memory which can hold at least @p size bytes without reallocation
+     *
+     * @param size the size in bytes the sample will be filled with
+     * @return the sample with time, counter and size set to 0
+     */
+    std::shared_ptr<DataSample> getSample(size_t size)
+    {
+        const size_t size_class = _state->getSizeClass(size);
+        DataSample* sample = _state->acquireSample(size_class, size);
+        return std::shared_ptr<DataSample>(sample
+            , Releaser{ _state, size_class }
+            , detail::DataSamplePoolAllocator<DataSample>(_state));
+    }
+
+private:
+    /// gives the sample back to the pool when the last reference is released
+    struct Releaser
+    {
+        std::shared_ptr<detail::DataSamplePoolState> _state;
+        size_t _size_class;
+
+        void operator()(DataSample* sample) const
+        {
+            _state->releaseSample(sample, _size_class);
+        }
+    };
+
+    std::shared_ptr<detail::DataSamplePoolState> _state;
+};
+
+} // namespace arya
+using arya::DataSamplePool;
+} // namespace fep3
@@ -0,0 +1,136 @@
+/**
+ * Declaration of the class ThreadConfiguration.
+ *
+ * @file
+ * Copyright &copy; AUDI AG. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace fep3
+{
+namespace arya
+{
+
+/**
+* @brief Configuration of an operating system thread of the participant,
+* i.e. the cpus it may run on and its scheduling policy and priority
+*
+*/
+class ThreadConfiguration
+{
+public:
+    /// Scheduling policy of a thread
+    enum class SchedulingPolicy
+    {
+        /// dummy value
+        unknown = 0,
+        /// The policy and priority are inherited from the thread creating the thread
+        inherit,
+        /// Default time sharing policy (SCHED_OTHER)
+        other,
+        /// Real-time policy, a thread runs until it blocks or a thread of higher priority is ready (SCHED_FIFO)
+        fifo,
+        /// Real-time policy, threads of the same priority are executed in time slices (SCHED_RR)
+        round_robin
+    };
+
+public:
+    /**
+    * @brief Return a scheduling policy for a given string.
+    *
+    * The string parameter must match one of the scheduling policy names.
+    * In case of no match, the unknown policy is returned.
+    *
+    * @param policy_string The string to derive a scheduling policy from.
+    *
+    * @return Scheduling policy matching the provided string.
+    */
+    static SchedulingPolicy schedulingPolicyFromString(const std::string& policy_string)
+    {
+        if ("inherit" == policy_string)
+        {
+            return SchedulingPolicy::inherit;
+        }
+        else if ("other" == policy_string)
+        {
+            return SchedulingPolicy::other;
+        }
+        else if ("fifo" == policy_string)
+        {
+            return SchedulingPolicy::fifo;
+        }
+        else if ("round_robin" == policy_string)
+        {
+            return SchedulingPolicy::round_robin;
+        }
+        else
+        {
+            return SchedulingPolicy::unknown;
+        }
+    }
+
+    /**
+     * @brief Return the configured scheduling policy as string.
+     *
+     * @return The configured scheduling policy as std::string.
+     */
+    std::string schedulingPolicyAsString() const
+    {
+        switch (_scheduling_policy)
+        {
+        case SchedulingPolicy::inherit:
+            return "inherit";
+        case SchedulingPolicy::other:
+            return "other";
+        case SchedulingPolicy::fifo:
+            return "fifo";
+        case SchedulingPolicy::round_robin:
+            return "round_robin";
+        default:
+            return "unknown";
+        }
+    }
+
+    /**
+     * @return true if the thread is neither pinned to cpus nor scheduled by a policy of its own
+     */
+    bool isDefault() const
+    {
+        return _cpu_affinity.empty() && SchedulingPolicy::inherit == _scheduling_policy;
+    }
+
+public:
+    /// list of cpus (by index) the thread may run on, empty to run on all cpus
+    std::vector<uint32_t>            _cpu_affinity;
+    /// The scheduling policy of the thread
+    SchedulingPolicy                 _scheduling_policy = SchedulingPolicy::inherit;
+    /// The priority of the thread for the real-time policies fifo and round_robin (1 to 99 on Linux)
+    int32_t                          _priority = 0;
+};
+
+/**
+ * @brief Compares two thread configurations.
+ *
+ * @return true if the configurations are equal
+ */
+inline bool operator==(const ThreadConfiguration& lhs, const ThreadConfiguration& rhs)
+{
+    return lhs._cpu_affinity == rhs._cpu_affinity
+        && lhs._scheduling_policy == rhs._scheduling_policy
+        && lhs._priority == rhs._priority;
+}
+
+} // namespace arya
+using arya::ThreadConfiguration;
+} // namespace fep3
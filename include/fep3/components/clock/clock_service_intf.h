@@ -122,6 +122,36 @@
 */
 #define FEP3_TIME_UPDATE_TIMEOUT_DEFAULT_VALUE 5000
 
+/**
+* @brief Name of the property to publish the time of the main clock to shared memory.
+* Timing slaves on the same host read it with the clocks 'slave_shared_clock' and 'slave_shared_clock_discrete'.
+* Only supported on POSIX systems.
+*
+*/
+#define FEP3_CLOCK_SHARED_CLOCK_PROPERTY "shared_clock"
+/**
+* @brief Full path of the property to publish the time of the main clock to shared memory.
+*
+*/
+#define FEP3_CLOCK_SERVICE_CLOCK_SHARED_CLOCK FEP3_CLOCK_SERVICE_CONFIG "/" FEP3_CLOCK_SHARED_CLOCK_PROPERTY
+/**
+* @brief Default value of the property to publish the time of the main clock to shared memory.
+*
+*/
+#define FEP3_CLOCK_SHARED_CLOCK_DEFAULT_VALUE false
+/**
+* @brief Name of the property to configure the cpu affinity and scheduling of the thread
+* stepping the native discrete clock 'local_system_simtime', e.g. "cpus=1;policy=fifo;priority=90".
+* An empty string keeps the thread as it is.
+*
+*/
+#define FEP3_CLOCK_THREAD_CONFIGURATION_PROPERTY "thread_configuration"
+/**
+* @brief Full path of the property to configure the thread stepping the native discrete clock.
+*
+*/
+#define FEP3_CLOCK_SERVICE_CLOCK_THREAD_CONFIGURATION FEP3_CLOCK_SERVICE_CONFIG "/" FEP3_CLOCK_THREAD_CONFIGURATION_PROPERTY
+
 namespace fep3
 {
 namespace arya
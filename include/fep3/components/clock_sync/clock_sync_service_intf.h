@@ -48,6 +48,25 @@
 */
 #define FEP3_CLOCK_SLAVE_MASTER_ONDEMAND_DISCRETE  "slave_master_on_demand_discrete"
 
+/**
+* @brief Name of the clock of the synchronization service providing as timing slave continuous clock
+* for a timing master running on the same host.
+* The clock reads the time the timing master publishes to shared memory (see FEP3_CLOCK_SERVICE_CLOCK_SHARED_CLOCK)
+* without any request to the timing master.
+*
+*/
+#define FEP3_CLOCK_SLAVE_SHARED_CLOCK     "slave_shared_clock"
+
+/**
+* @brief Name of the clock of the synchronization service providing as timing slave discrete clock
+* for a timing master running on the same host.
+* The clock receives the time update events the timing master publishes to shared memory
+* (see FEP3_CLOCK_SERVICE_CLOCK_SHARED_CLOCK) and the timing master waits until they are processed.
+* If the timing master is a continuous clock it will synchronize in discrete clock steps every given FEP3_CLOCK_SLAVE_SYNC_CYCLE_TIME
+*
+*/
+#define FEP3_CLOCK_SLAVE_SHARED_CLOCK_DISCRETE  "slave_shared_clock_discrete"
+
 /**
 * @brief Period at which the clock of the timing slave continuous clock synchronizes with the timing master.
 * Only relevant for timing slave configuration if the timing slave's main clock is set to FEP3_CLOCK_SLAVE_MASTER_ONDEMAND.
@@ -73,6 +92,73 @@
 */
 #define FEP3_SLAVE_SYNC_CYCLE_TIME_DEFAULT_VALUE 100
 
+/**
+* @brief Name of the property selecting how the timing slave continuous clock interpolates the time received from the timing master.
+* Only relevant for timing slave configuration if the timing slave's main clock is set to FEP3_CLOCK_SLAVE_MASTER_ONDEMAND.
+* Possible values are FEP3_SLAVE_INTERPOLATION_CRISTIAN and FEP3_SLAVE_INTERPOLATION_DRIFT_COMPENSATION.
+*
+*/
+#define FEP3_SLAVE_INTERPOLATION_PROPERTY "interpolation"
+
+/**
+* @brief Full path of the property selecting the interpolation of the timing slave continuous clock
+*
+*/
+#define FEP3_CLOCKSYNC_SERVICE_CONFIG_SLAVE_INTERPOLATION FEP3_CLOCKSYNC_SERVICE_CONFIG "/" FEP3_SLAVE_INTERPOLATION_PROPERTY
+
+/**
+* @brief Interpolation assuming the timing master's clock advances at the rate of the local clock.
+* Every received time replaces the offset to the local clock (Cristian's algorithm).
+*
+*/
+#define FEP3_SLAVE_INTERPOLATION_CRISTIAN "cristian"
+
+/**
+* @brief Interpolation estimating rate and offset of the timing master's clock from the last received times
+* (see FEP3_SLAVE_INTERPOLATION_WINDOW_SIZE_PROPERTY), received times with an outlying roundtrip time are discarded.
+* Keeps the deviation low with a considerably higher FEP3_SLAVE_SYNC_CYCLE_TIME_PROPERTY.
+*
+*/
+#define FEP3_SLAVE_INTERPOLATION_DRIFT_COMPENSATION "drift_compensation"
+
+/**
+* @brief Default value of the interpolation property
+*
+*/
+#define FEP3_SLAVE_INTERPOLATION_DEFAULT_VALUE FEP3_SLAVE_INTERPOLATION_CRISTIAN
+
+/**
+* @brief Name of the property for the number of received times the drift compensating interpolation estimates from.
+* Only relevant if the interpolation is FEP3_SLAVE_INTERPOLATION_DRIFT_COMPENSATION, has to be >= 2.
+*
+*/
+#define FEP3_SLAVE_INTERPOLATION_WINDOW_SIZE_PROPERTY "interpolation_window_size"
+
+/**
+* @brief Full path of the property for the window size of the drift compensating interpolation
+*
+*/
+#define FEP3_CLOCKSYNC_SERVICE_CONFIG_SLAVE_INTERPOLATION_WINDOW_SIZE FEP3_CLOCKSYNC_SERVICE_CONFIG "/" FEP3_SLAVE_INTERPOLATION_WINDOW_SIZE_PROPERTY
+
+/**
+* @brief Default value of the interpolation window size property
+*
+*/
+#define FEP3_SLAVE_INTERPOLATION_WINDOW_SIZE_DEFAULT_VALUE 16
+
+/**
+* @brief Name of the property to configure the cpu affinity and scheduling of the threads
+* synchronizing the slave clocks with the timing master, e.g. "cpus=1;policy=fifo;priority=85".
+* An empty string keeps the threads as they are.
+*
+*/
+#define FEP3_CLOCKSYNC_THREAD_CONFIGURATION_PROPERTY "thread_configuration"
+/**
+* @brief Full path of the property to configure the threads synchronizing the slave clocks.
+*
+*/
+#define FEP3_CLOCKSYNC_SERVICE_CONFIG_THREAD_CONFIGURATION FEP3_CLOCKSYNC_SERVICE_CONFIG "/" FEP3_CLOCKSYNC_THREAD_CONFIGURATION_PROPERTY
+
 namespace fep3
 {
 namespace arya
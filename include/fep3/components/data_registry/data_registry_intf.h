@@ -22,6 +22,42 @@
 #include "fep3/fep3_errors.h"
 #include "fep3/fep3_participant_types.h"
 
+/**
+* @brief The data registry main property tree entry node
+*
+*/
+#define FEP3_DATA_REGISTRY_CONFIG "data_registry"
+
+/**
+* @brief Number of threads which dispatch the incoming data of all input signals.
+* If set to 0, every input signal is received by its own thread.
+*
+*/
+#define FEP3_DATA_REGISTRY_RECEIVE_THREAD_COUNT_PROPERTY "receive_thread_count"
+/**
+* @brief Number of threads which dispatch the incoming data of all input signals.
+* If set to 0, every input signal is received by its own thread.
+*
+*/
+#define FEP3_DATA_REGISTRY_RECEIVE_THREAD_COUNT FEP3_DATA_REGISTRY_CONFIG "/" FEP3_DATA_REGISTRY_RECEIVE_THREAD_COUNT_PROPERTY
+/**
+* @brief Default value of the receive thread count property (one thread per input signal).
+*
+*/
+#define FEP3_DATA_REGISTRY_RECEIVE_THREAD_COUNT_DEFAULT_VALUE 0
+/**
+* @brief Name of the property to configure the cpu affinity and scheduling of the threads
+* receiving the incoming data, e.g. "cpus=2-3;policy=fifo;priority=70".
+* An empty string keeps the threads as they are.
+*
+*/
+#define FEP3_DATA_REGISTRY_RECEIVE_THREAD_CONFIGURATION_PROPERTY "receive_thread_configuration"
+/**
+* @brief Full path of the property to configure the threads receiving the incoming data.
+*
+*/
+#define FEP3_DATA_REGISTRY_RECEIVE_THREAD_CONFIGURATION FEP3_DATA_REGISTRY_CONFIG "/" FEP3_DATA_REGISTRY_RECEIVE_THREAD_CONFIGURATION_PROPERTY
+
 namespace fep3
 {
 namespace arya
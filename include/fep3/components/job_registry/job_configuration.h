@@ -18,6 +18,7 @@
 
 #include <fep3/fep3_duration.h>
 #include <fep3/fep3_optional.h>
+#include <fep3/base/thread/thread_configuration.h>
 
 
 namespace fep3
@@ -57,17 +58,30 @@ public:
     *                                   Provide no value if you have no expectations on the jobs runtime.
     * @param runtime_violation_strategy The violation strategy
     * @param jobs_this_depends_on The jobs (by name), this job depends on
+    * @param trigger_signals The incoming data (by name), which trigger the job
+    *                        if the scheduler @ref FEP3_SCHEDULER_DATA_TRIGGERED is active
+    * @param input_signals The incoming data (by name), which is read by the job
+    * @param output_signals The outgoing data (by name), which is written by the job
+    * @param thread_configuration The cpu affinity and scheduling of the thread executing the job
     */
     JobConfiguration(Duration cycle_sim_time,
                      Duration first_delay_sim_time = Duration(0),
                      Optional<Duration> max_runtime_real_time = {},
                      TimeViolationStrategy runtime_violation_strategy = TimeViolationStrategy::ignore_runtime_violation,
-                     std::vector<std::string> jobs_this_depends_on = {})
+                     std::vector<std::string> jobs_this_depends_on = {},
+                     std::vector<std::string> trigger_signals = {},
+                     std::vector<std::string> input_signals = {},
+                     std::vector<std::string> output_signals = {},
+                     ThreadConfiguration thread_configuration = {})
         : _cycle_sim_time(cycle_sim_time)
         , _delay_sim_time(first_delay_sim_time)
         , _max_runtime_real_time(std::move(max_runtime_real_time))
         , _runtime_violation_strategy(runtime_violation_strategy)
         , _jobs_this_depends_on(std::move(jobs_this_depends_on))
+        , _trigger_signals(std::move(trigger_signals))
+        , _input_signals(std::move(input_signals))
+        , _output_signals(std::move(output_signals))
+        , _thread_configuration(std::move(thread_configuration))
     {
     }
 
@@ -139,6 +153,14 @@ public:
     TimeViolationStrategy	         _runtime_violation_strategy;
     /// list of jobs (by name), this job depends on
     std::vector<std::string>         _jobs_this_depends_on;
+    /// list of incoming data (by name), a sample of which triggers the job (data triggered scheduling)
+    std::vector<std::string>         _trigger_signals;
+    /// list of incoming data (by name), the job reads (data flow scheduling)
+    std::vector<std::string>         _input_signals;
+    /// list of outgoing data (by name), the job writes (data flow scheduling)
+    std::vector<std::string>         _output_signals;
+    /// cpu affinity and scheduling of the thread executing the job (if the scheduler executes the job in a thread of its own)
+    ThreadConfiguration              _thread_configuration;
 };
 
 } // namespace arya
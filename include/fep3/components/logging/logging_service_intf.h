@@ -71,6 +71,51 @@
  */
 #define FEP3_LOGGING_DEFAULT_FILE_SINK FEP3_LOGGING_SERVICE_CONFIG "/" FEP3_LOGGING_DEFAULT_FILE_SINK_PROPERTY
 
+/**
+ * @brief The logging configuration property name for the number of log messages
+ * which may be pending in the logging queue (waiting to be logged by the sinks).
+ * By default 4096 is used.
+ *
+ */
+#define FEP3_LOGGING_QUEUE_CAPACITY_PROPERTY "queue_capacity"
+
+/**
+ * @brief The logging configuration property path for the capacity of the logging queue
+ *
+ */
+#define FEP3_LOGGING_QUEUE_CAPACITY FEP3_LOGGING_SERVICE_CONFIG "/" FEP3_LOGGING_QUEUE_CAPACITY_PROPERTY
+
+/**
+ * @brief The logging configuration property name for what happens to a log message
+ * while the logging queue is full. Following values are possible:
+ * \li drop_oldest (the oldest pending log message is dropped)
+ * \li drop_newest (the new log message is dropped and the logger returns ERR_MEMORY)
+ * \li block (the logger waits until the log message fits into the queue)
+ * By default "drop_newest" is used. Dropped log messages are counted and reported on the console sink.
+ *
+ */
+#define FEP3_LOGGING_QUEUE_OVERFLOW_POLICY_PROPERTY "queue_overflow_policy"
+
+/**
+ * @brief The logging configuration property path for the overflow policy of the logging queue
+ *
+ */
+#define FEP3_LOGGING_QUEUE_OVERFLOW_POLICY FEP3_LOGGING_SERVICE_CONFIG "/" FEP3_LOGGING_QUEUE_OVERFLOW_POLICY_PROPERTY
+
+/**
+ * @brief The logging configuration property name for the cpu affinity and scheduling of the thread
+ * passing the queued log messages to the sinks, e.g. "cpus=0;policy=other".
+ * By default the thread is kept as it is (empty string).
+ *
+ */
+#define FEP3_LOGGING_THREAD_CONFIGURATION_PROPERTY "thread_configuration"
+
+/**
+ * @brief The logging configuration property path for the thread configuration of the logging queue
+ *
+ */
+#define FEP3_LOGGING_THREAD_CONFIGURATION FEP3_LOGGING_SERVICE_CONFIG "/" FEP3_LOGGING_THREAD_CONFIGURATION_PROPERTY
+
 
 namespace fep3
 {
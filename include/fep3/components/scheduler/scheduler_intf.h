@@ -24,6 +24,20 @@
 */
 #define FEP3_SCHEDULER_CLOCK_BASED "clock_based_scheduler"
 
+/**
+* @brief Name of the native scheduler implementation which triggers jobs by incoming data.
+* Jobs without trigger signals (see @ref fep3::arya::JobConfiguration::_trigger_signals) are scheduled clock based.
+*/
+#define FEP3_SCHEDULER_DATA_TRIGGERED "data_triggered_scheduler"
+
+/**
+* @brief Name of the native scheduler implementation which executes jobs along the data flow between them.
+* A job reading data (see @ref fep3::arya::JobConfiguration::_input_signals) written by other jobs due at the same time
+* is executed directly after these jobs, independent jobs are executed in parallel.
+* The scheduler is registered by the native scheduler service on tense, if it is the configured scheduler.
+*/
+#define FEP3_SCHEDULER_DATA_FLOW "data_flow_scheduler"
+
 namespace fep3
 {
 namespace arya
@@ -31,6 +31,70 @@
 * @brief The scheduler configuration property path to set up the scheduler to use
 */
 #define FEP3_SCHEDULER_SERVICE_SCHEDULER FEP3_SCHEDULER_SERVICE_CONFIG "/" FEP3_SCHEDULER_PROPERTY
+/**
+* @brief The job worker thread count configuration property name
+* Use this to set the number of threads executing the jobs of the native schedulers.
+* 0 executes every job in its own thread, a value > 0 executes the jobs as tasks of a worker pool
+* with this number of threads and -1 sizes the worker pool to the number of cores.
+*/
+#define FEP3_SCHEDULER_JOB_WORKER_THREAD_COUNT_PROPERTY "job_worker_thread_count"
+/**
+* @brief The job worker thread count configuration property path
+*/
+#define FEP3_SCHEDULER_JOB_WORKER_THREAD_COUNT FEP3_SCHEDULER_SERVICE_CONFIG "/" FEP3_SCHEDULER_JOB_WORKER_THREAD_COUNT_PROPERTY
+/**
+* @brief Default value of the job worker thread count (one thread per job)
+*/
+#define FEP3_SCHEDULER_JOB_WORKER_THREAD_COUNT_DEFAULT_VALUE 0
+/**
+* @brief The parallel job execution configuration property name
+* Use this to execute the jobs due at the same instant of a discrete clock in parallel instead of one after another.
+* Dependencies between jobs (see @ref fep3::arya::JobConfiguration::_jobs_this_depends_on) are respected.
+*/
+#define FEP3_SCHEDULER_PARALLEL_JOB_EXECUTION_PROPERTY "parallel_job_execution"
+/**
+* @brief The parallel job execution configuration property path
+*/
+#define FEP3_SCHEDULER_PARALLEL_JOB_EXECUTION FEP3_SCHEDULER_SERVICE_CONFIG "/" FEP3_SCHEDULER_PARALLEL_JOB_EXECUTION_PROPERTY
+/**
+* @brief Default value of the parallel job execution (disabled)
+*/
+#define FEP3_SCHEDULER_PARALLEL_JOB_EXECUTION_DEFAULT_VALUE false
+/**
+* @brief The timer spin window configuration property name
+* Use this to set the time in microseconds before the next due job of a continuous clock,
+* which the native schedulers busy wait for instead of blocking. 0 never busy waits.
+*/
+#define FEP3_SCHEDULER_TIMER_SPIN_WINDOW_PROPERTY "timer_spin_window_us"
+/**
+* @brief The timer spin window configuration property path
+*/
+#define FEP3_SCHEDULER_TIMER_SPIN_WINDOW FEP3_SCHEDULER_SERVICE_CONFIG "/" FEP3_SCHEDULER_TIMER_SPIN_WINDOW_PROPERTY
+/**
+* @brief Default value of the timer spin window in microseconds
+*/
+#define FEP3_SCHEDULER_TIMER_SPIN_WINDOW_DEFAULT_VALUE 20
+/**
+* @brief The scheduler thread configuration property name
+* Use this to set the cpu affinity and scheduling of the thread of the native schedulers waking up the jobs,
+* e.g. "cpus=1;policy=fifo;priority=90". An empty string keeps the thread as it is.
+*/
+#define FEP3_SCHEDULER_THREAD_CONFIGURATION_PROPERTY "scheduler_thread_configuration"
+/**
+* @brief The scheduler thread configuration property path
+*/
+#define FEP3_SCHEDULER_THREAD_CONFIGURATION FEP3_SCHEDULER_SERVICE_CONFIG "/" FEP3_SCHEDULER_THREAD_CONFIGURATION_PROPERTY
+/**
+* @brief The job worker thread configuration property name
+* Use this to set the cpu affinity and scheduling of the worker threads of the native schedulers
+* executing the jobs (see @ref FEP3_SCHEDULER_JOB_WORKER_THREAD_COUNT), e.g. "cpus=2-3;policy=fifo;priority=80".
+* An empty string keeps the threads as they are.
+*/
+#define FEP3_SCHEDULER_JOB_WORKER_THREAD_CONFIGURATION_PROPERTY "job_worker_thread_configuration"
+/**
+* @brief The job worker thread configuration property path
+*/
+#define FEP3_SCHEDULER_JOB_WORKER_THREAD_CONFIGURATION FEP3_SCHEDULER_SERVICE_CONFIG "/" FEP3_SCHEDULER_JOB_WORKER_THREAD_CONFIGURATION_PROPERTY
 
 namespace fep3
 {
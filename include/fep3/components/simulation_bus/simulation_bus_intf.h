@@ -22,6 +22,28 @@
 #include <fep3/base/streamtype/streamtype.h>
 #include <fep3/base/sample/data_sample_intf.h>
 
+/**
+* @brief The native simulation bus main property tree entry node
+*
+*/
+#define FEP3_SIMULATION_BUS_NATIVE_CONFIG "native_simulation_bus"
+
+/**
+* @brief Name of the property to use the lock free queues of the native simulation bus
+* for the transmit buffers and receiver queues instead of the mutex based ones.
+*
+*/
+#define FEP3_SIMULATION_BUS_NATIVE_USE_LOCK_FREE_QUEUES_PROPERTY "use_lock_free_queues"
+/**
+* @brief Full path of the property to use the lock free queues of the native simulation bus.
+*
+*/
+#define FEP3_SIMULATION_BUS_NATIVE_USE_LOCK_FREE_QUEUES FEP3_SIMULATION_BUS_NATIVE_CONFIG "/" FEP3_SIMULATION_BUS_NATIVE_USE_LOCK_FREE_QUEUES_PROPERTY
+/**
+* @brief Default value of the use lock free queues property (mutex based queues).
+*
+*/
+#define FEP3_SIMULATION_BUS_NATIVE_USE_LOCK_FREE_QUEUES_DEFAULT_VALUE false
 
 namespace fep3
 {
@@ -0,0 +1,357 @@
+/**
+ * @file
+* Copyright &copy; AUDI AG. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ */
+
+#ifdef WIN32
+#include <Windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <fep3/fep3_errors.h>
+
+#include "thread.h"
+
+namespace
+{
+
+std::string trim(const std::string& value)
+{
+    const auto first = value.find_first_not_of(" \t");
+    if (std::string::npos == first)
+    {
+        return {};
+    }
+    const auto last = value.find_last_not_of(" \t");
+    return value.substr(first, last - first + 1);
+}
+
+std::vector<std::string> split(const std::string& value, char delimiter)
+{
+    std::vector<std::string> parts;
+    size_t begin = 0;
+    while (true)
+    {
+        const auto end = value.find(delimiter, begin);
+        parts.push_back(trim(value.substr(begin, end - begin)));
+        if (std::string::npos == end)
+        {
+            return parts;
+        }
+        begin = end + 1;
+    }
+}
+
+bool toUInt32(const std::string& value, uint32_t& number)
+{
+    if (value.empty() || !std::all_of(value.begin(), value.end(), [](char c) { return c >= '0' && c <= '9'; }))
+    {
+        return false;
+    }
+    try
+    {
+        const auto parsed = std::stoul(value);
+        if (parsed > UINT32_MAX)
+        {
+            return false;
+        }
+        number = static_cast<uint32_t>(parsed);
+        return true;
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+}
+
+// number of cpus the thread affinity can be set for, larger cpu indices are rejected on parsing
+#ifdef WIN32
+constexpr uint32_t max_cpu_count = sizeof(DWORD_PTR) * 8;
+#elif defined(CPU_SETSIZE)
+constexpr uint32_t max_cpu_count = CPU_SETSIZE;
+#else
+// the platform does not support setting the cpu affinity, the cpu lists are limited like Linux cpu sets
+constexpr uint32_t max_cpu_count = 1024;
+#endif
+
+bool isRealTime(fep3::ThreadConfiguration::SchedulingPolicy policy)
+{
+    return fep3::ThreadConfiguration::SchedulingPolicy::fifo == policy
+        || fep3::ThreadConfiguration::SchedulingPolicy::round_robin == policy;
+}
+
+#ifdef WIN32
+
+fep3::Result setName(std::thread&, const std::string&)
+{
+    // naming a thread requires SetThreadDescription, which is not available on all supported Windows versions
+    return {};
+}
+
+fep3::Result setCpuAffinity(std::thread& thread, const std::vector<uint32_t>& cpus)
+{
+    DWORD_PTR mask = 0;
+    for (const auto cpu : cpus)
+    {
+        if (cpu >= sizeof(DWORD_PTR) * 8)
+        {
+            RETURN_ERROR_DESCRIPTION(fep3::ERR_NOT_SUPPORTED, "cpu %u exceeds the cpus supported by the thread affinity mask", cpu);
+        }
+        mask |= DWORD_PTR(1) << cpu;
+    }
+    if (0 == SetThreadAffinityMask(thread.native_handle(), mask))
+    {
+        RETURN_ERROR_DESCRIPTION(fep3::ERR_FAILED, "setting the cpu affinity failed with error %lu", GetLastError());
+    }
+    return {};
+}
+
+fep3::Result setScheduling(std::thread& thread, const fep3::ThreadConfiguration& configuration)
+{
+    // Windows has no real-time policies, the real-time policies are mapped to the highest thread priority
+    const int priority = isRealTime(configuration._scheduling_policy) ? THREAD_PRIORITY_TIME_CRITICAL : THREAD_PRIORITY_NORMAL;
+    if (FALSE == SetThreadPriority(thread.native_handle(), priority))
+    {
+        RETURN_ERROR_DESCRIPTION(fep3::ERR_FAILED, "setting the thread priority failed with error %lu", GetLastError());
+    }
+    return {};
+}
+
+#else //WIN32
+
+fep3::Result setName(std::thread& thread, const std::string& name)
+{
+#if defined(__linux__)
+    // the name is limited to 16 characters including the terminating null character
+    const auto error = pthread_setname_np(thread.native_handle(), name.substr(0, 15).c_str());
+#elif defined(__APPLE__)
+    // macOS can only name the calling thread, other threads keep their names
+    if (0 == pthread_equal(thread.native_handle(), pthread_self()))
+    {
+        return {};
+    }
+    // the name is limited to 64 characters including the terminating null character
+    const auto error = pthread_setname_np(name.substr(0, 63).c_str());
+#else
+    const auto error = pthread_setname_np(thread.native_handle(), name.c_str());
+#endif
+    if (0 != error)
+    {
+        RETURN_ERROR_DESCRIPTION(fep3::ERR_FAILED, "naming the thread '%s' failed: %s", name.c_str(), std::strerror(error));
+    }
+    return {};
+}
+
+fep3::Result setCpuAffinity(std::thread& thread, const std::vector<uint32_t>& cpus)
+{
+#ifdef __linux__
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (const auto cpu : cpus)
+    {
+        if (cpu >= CPU_SETSIZE)
+        {
+            RETURN_ERROR_DESCRIPTION(fep3::ERR_NOT_SUPPORTED, "cpu %u exceeds the cpus supported by the thread affinity mask", cpu);
+        }
+        CPU_SET(cpu, &cpu_set);
+    }
+    const auto error = pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set), &cpu_set);
+    if (0 != error)
+    {
+        RETURN_ERROR_DESCRIPTION(fep3::ERR_FAILED, "setting the cpu affinity failed: %s", std::strerror(error));
+    }
+    return {};
+#else
+    (void)thread;
+    (void)cpus;
+    RETURN_ERROR_DESCRIPTION(fep3::ERR_NOT_SUPPORTED, "setting the cpu affinity of a thread is not supported on this platform");
+#endif
+}
+
+fep3::Result setScheduling(std::thread& thread, const fep3::ThreadConfiguration& configuration)
+{
+    using SchedulingPolicy = fep3::ThreadConfiguration::SchedulingPolicy;
+
+    int policy = SCHED_OTHER;
+    if (SchedulingPolicy::fifo == configuration._scheduling_policy)
+    {
+        policy = SCHED_FIFO;
+    }
+    else if (SchedulingPolicy::round_robin == configuration._scheduling_policy)
+    {
+        policy = SCHED_RR;
+    }
+
+    sched_param parameter{};
+    parameter.sched_priority = isRealTime(configuration._scheduling_policy) ? configuration._priority : 0;
+    if (parameter.sched_priority < sched_get_priority_min(policy)
+        || parameter.sched_priority > sched_get_priority_max(policy))
+    {
+        RETURN_ERROR_DESCRIPTION(fep3::ERR_INVALID_ARG, "priority %d is out of the range %d to %d of the scheduling policy '%s'",
+            parameter.sched_priority, sched_get_priority_min(policy), sched_get_priority_max(policy),
+            configuration.schedulingPolicyAsString().c_str());
+    }
+
+    const auto error = pthread_setschedparam(thread.native_handle(), policy, &parameter);
+    if (EPERM == error)
+    {
+        RETURN_ERROR_DESCRIPTION(fep3::ERR_FAILED, "setting the scheduling policy '%s' is not permitted, "
+            "real-time policies require the capability CAP_SYS_NICE or a sufficient RLIMIT_RTPRIO",
+            configuration.schedulingPolicyAsString().c_str());
+    }
+    else if (0 != error)
+    {
+        RETURN_ERROR_DESCRIPTION(fep3::ERR_FAILED, "setting the scheduling policy '%s' failed: %s",
+            configuration.schedulingPolicyAsString().c_str(), std::strerror(error));
+    }
+    return {};
+}
+
+#endif //WIN32
+
+} // namespace
+
+namespace fep3
+{
+namespace thread
+{
+
+Result configure(std::thread& thread, const std::string& name, const ThreadConfiguration& configuration)
+{
+    FEP3_RETURN_IF_FAILED(validateConfiguration(configuration));
+
+    if (!name.empty())
+    {
+        FEP3_RETURN_IF_FAILED(setName(thread, name));
+    }
+    if (!configuration._cpu_affinity.empty())
+    {
+        FEP3_RETURN_IF_FAILED(setCpuAffinity(thread, configuration._cpu_affinity));
+    }
+    if (ThreadConfiguration::SchedulingPolicy::inherit != configuration._scheduling_policy)
+    {
+        FEP3_RETURN_IF_FAILED(setScheduling(thread, configuration));
+    }
+    return {};
+}
+
+Result parseCpuList(const std::string& cpu_list, std::vector<uint32_t>& cpus)
+{
+    cpus.clear();
+    if (trim(cpu_list).empty())
+    {
+        return {};
+    }
+
+    for (const auto& entry : split(cpu_list, ','))
+    {
+        const auto range = split(entry, '-');
+        uint32_t first = 0;
+        uint32_t last = 0;
+        if (range.size() > 2
+            || !toUInt32(range.front(), first)
+            || !toUInt32(range.back(), last)
+            || first > last)
+        {
+            RETURN_ERROR_DESCRIPTION(ERR_INVALID_ARG, "invalid cpu list '%s', expected cpu indices and ranges like '0,2-3'",
+                cpu_list.c_str());
+        }
+        // checked before expanding the range, so a huge range neither loops endlessly nor exhausts the memory
+        if (last >= max_cpu_count)
+        {
+            RETURN_ERROR_DESCRIPTION(ERR_INVALID_ARG, "invalid cpu list '%s', the cpu indices have to be less than %u",
+                cpu_list.c_str(), max_cpu_count);
+        }
+        for (auto cpu = first; cpu <= last; ++cpu)
+        {
+            cpus.push_back(cpu);
+        }
+    }
+
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return {};
+}
+
+Result parseConfiguration(const std::string& configuration_string, ThreadConfiguration& configuration)
+{
+    configuration = ThreadConfiguration();
+    if (trim(configuration_string).empty())
+    {
+        return {};
+    }
+
+    for (const auto& entry : split(configuration_string, ';'))
+    {
+        if (entry.empty())
+        {
+            continue;
+        }
+        const auto separator = entry.find('=');
+        const auto key = trim(entry.substr(0, separator));
+        const auto value = std::string::npos == separator ? std::string() : trim(entry.substr(separator + 1));
+        if ("cpus" == key)
+        {
+            FEP3_RETURN_IF_FAILED(parseCpuList(value, configuration._cpu_affinity));
+        }
+        else if ("policy" == key)
+        {
+            configuration._scheduling_policy = ThreadConfiguration::schedulingPolicyFromString(value);
+        }
+        else if ("priority" == key)
+        {
+            uint32_t priority = 0;
+            if (!toUInt32(value, priority) || priority > INT32_MAX)
+            {
+                RETURN_ERROR_DESCRIPTION(ERR_INVALID_ARG, "invalid priority '%s' in thread configuration '%s'",
+                    value.c_str(), configuration_string.c_str());
+            }
+            configuration._priority = static_cast<int32_t>(priority);
+        }
+        else
+        {
+            RETURN_ERROR_DESCRIPTION(ERR_INVALID_ARG, "invalid key '%s' in thread configuration '%s', "
+                "expected a configuration like 'cpus=2-3;policy=fifo;priority=80'",
+                key.c_str(), configuration_string.c_str());
+        }
+    }
+
+    return validateConfiguration(configuration);
+}
+
+Result validateConfiguration(const ThreadConfiguration& configuration)
+{
+    if (ThreadConfiguration::SchedulingPolicy::unknown == configuration._scheduling_policy)
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_INVALID_ARG, "invalid scheduling policy, expected one of inherit, other, fifo or round_robin");
+    }
+    if (isRealTime(configuration._scheduling_policy))
+    {
+        if (configuration._priority < 1)
+        {
+            RETURN_ERROR_DESCRIPTION(ERR_INVALID_ARG, "the scheduling policy '%s' requires a priority > 0",
+                configuration.schedulingPolicyAsString().c_str());
+        }
+    }
+    else if (0 != configuration._priority)
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_INVALID_ARG, "a priority is only supported by the scheduling policies fifo and round_robin");
+    }
+    return {};
+}
+
+} // namespace thread
+} // namespace fep3
@@ -0,0 +1,69 @@
+/**
+ * @file
+* Copyright &copy; AUDI AG. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fep3/fep3_result_decl.h>
+#include <fep3/base/thread/thread_configuration.h>
+
+namespace fep3
+{
+// Note: std::thread does not provide access to the name, cpu affinity and scheduling of a thread,
+// so this namespace applies them to the native handle of the thread
+namespace thread
+{
+
+/**
+ * Names the @p thread and applies the cpu affinity and scheduling of the @p configuration to it.
+ * The name is truncated to the length supported by the operating system (15 characters on Linux).
+ *
+ * @param thread the running thread
+ * @param name the name of the thread
+ * @param configuration the configuration, a default configuration keeps the thread as it is
+ * @return ERR_NOT_SUPPORTED if the operating system does not support the configuration,
+ *         ERR_FAILED if it was rejected (e.g. a real-time policy without the necessary privileges)
+ */
+Result configure(std::thread& thread, const std::string& name, const ThreadConfiguration& configuration);
+
+/**
+ * Parses a list of cpus like "0,2-3".
+ *
+ * @param cpu_list the comma separated cpu indices and ranges, may be empty
+ * @param cpus the parsed cpu indices in ascending order
+ * @return ERR_INVALID_ARG if the list is malformed or a cpu index exceeds the cpus
+ *         supported by the thread affinity of the platform
+ */
+Result parseCpuList(const std::string& cpu_list, std::vector<uint32_t>& cpus);
+
+/**
+ * Parses a thread configuration like "cpus=2-3;policy=fifo;priority=80", the format of the thread
+ * configuration properties of the native components. Every key is optional, an empty string is the default configuration.
+ *
+ * @param configuration_string the configuration as semicolon separated key value pairs
+ * @param configuration the parsed configuration
+ * @return ERR_INVALID_ARG if the string is malformed or the configuration is invalid
+ */
+Result parseConfiguration(const std::string& configuration_string, ThreadConfiguration& configuration);
+
+/**
+ * Checks the priority of the @p configuration against its scheduling policy.
+ *
+ * @return ERR_INVALID_ARG if the configuration is invalid
+ */
+Result validateConfiguration(const ThreadConfiguration& configuration);
+
+} // namespace thread
+} // namespace fep3
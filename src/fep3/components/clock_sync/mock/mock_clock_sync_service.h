@@ -33,6 +33,7 @@ struct InterpolationTime : public fep3::IInterpolationTime
 struct RPCClockSyncMaster : public fep3::rpc::arya::RPCService<fep3::rpc_stubs::RPCClockSyncMasterServiceStub, fep3::rpc::arya::IRPCClockSyncMasterDef>
 {
     MOCK_METHOD2(registerSyncSlave, int(int, const std::string&));
+    MOCK_METHOD2(registerSyncChannel, int(const std::string&, const std::string&));
     MOCK_METHOD1(unregisterSyncSlave, int(const std::string&));
     MOCK_METHOD2(slaveSyncedEvent, int(const std::string&, const std::string&));
     MOCK_METHOD0(getMasterTime, std::string());
@@ -32,6 +32,10 @@ bool operator==(const JobConfiguration& lhs, const JobConfiguration& rhs)
         && lhs._max_runtime_real_time == rhs._max_runtime_real_time
         && lhs._runtime_violation_strategy == rhs._runtime_violation_strategy
         && lhs._jobs_this_depends_on == rhs._jobs_this_depends_on
+        && lhs._trigger_signals == rhs._trigger_signals
+        && lhs._input_signals == rhs._input_signals
+        && lhs._output_signals == rhs._output_signals
+        && lhs._thread_configuration == rhs._thread_configuration
         );
 }
 bool operator==(const JobInfo& lhs, const JobInfo& rhs)
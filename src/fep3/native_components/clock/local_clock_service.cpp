@@ -22,6 +22,7 @@
 #include <fep3/components/service_bus/service_bus_intf.h>
 #include <fep3/base/properties/property_type.h>
 #include <fep3/fep3_errors.h>
+#include <fep3/base/thread/thread.h>
 
 #include "fep3/components/service_bus/rpc/fep_rpc_stubs_service.h"
 #include "fep3/rpc_services/clock_sync/clock_sync_service_rpc_intf_def.h"
@@ -220,6 +221,14 @@ protected:
         }
         return -1;
     }
+    int registerSyncChannel(const std::string& channel_address, const std::string& slave_name) override
+    {
+        if (fep3::isOk(_service.masterRegisterSlaveSyncChannel(slave_name, channel_address)))
+        {
+            return 0;
+        }
+        return -1;
+    }
     int unregisterSyncSlave(const std::string& slave_name) override
     {
         if (fep3::isOk(_service.masterUnregisterSlave(slave_name)))
@@ -314,6 +323,39 @@ int RPCClockService::getType(const std::string& clock_name)
     }
 }
 
+Json::Value RPCClockService::getSlaveSyncLatencies()
+{
+    Json::Value json_value;
+
+    for (const auto bucket_upper_bound : rpc::SyncLatencyHistogram::bucket_upper_bounds_us)
+    {
+        json_value["bucket_upper_bounds"].append(static_cast<Json::Int64>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::microseconds(bucket_upper_bound)).count()));
+    }
+
+    json_value["slaves"] = Json::Value(Json::arrayValue);
+    for (const auto& slave : _service.masterGetSlaveSyncLatencies())
+    {
+        const auto& statistic = slave.second;
+
+        Json::Value json_slave;
+        json_slave["slave_name"] = slave.first;
+        json_slave["count"] = static_cast<Json::UInt64>(statistic._count);
+        json_slave["min"] = static_cast<Json::Int64>(statistic._min.count());
+        json_slave["max"] = static_cast<Json::Int64>(statistic._max.count());
+        json_slave["mean"] = static_cast<Json::Int64>(
+            statistic._count > 0 ? statistic._total.count() / static_cast<int64_t>(statistic._count) : 0);
+        for (const auto bucket : statistic._buckets)
+        {
+            json_slave["buckets"].append(static_cast<Json::UInt64>(bucket));
+        }
+
+        json_value["slaves"].append(json_slave);
+    }
+
+    return json_value;
+}
+
 ClockServiceConfiguration::ClockServiceConfiguration()
     : Configuration(FEP3_CLOCK_SERVICE_CONFIG)
 {
@@ -325,6 +367,8 @@ fep3::Result ClockServiceConfiguration::registerPropertyVariables()
     FEP3_RETURN_IF_FAILED(registerPropertyVariable(_time_update_timeout, FEP3_TIME_UPDATE_TIMEOUT_PROPERTY));
     FEP3_RETURN_IF_FAILED(registerPropertyVariable(_clock_sim_time_time_factor, FEP3_CLOCK_SIM_TIME_TIME_FACTOR_PROPERTY));
     FEP3_RETURN_IF_FAILED(registerPropertyVariable(_clock_sim_time_cycle_time, FEP3_CLOCK_SIM_TIME_CYCLE_TIME_PROPERTY));
+    FEP3_RETURN_IF_FAILED(registerPropertyVariable(_shared_clock, FEP3_CLOCK_SHARED_CLOCK_PROPERTY));
+    FEP3_RETURN_IF_FAILED(registerPropertyVariable(_thread_configuration, FEP3_CLOCK_THREAD_CONFIGURATION_PROPERTY));
 
     return {};
 }
@@ -335,6 +379,8 @@ fep3::Result ClockServiceConfiguration::unregisterPropertyVariables()
     FEP3_RETURN_IF_FAILED(unregisterPropertyVariable(_time_update_timeout, FEP3_TIME_UPDATE_TIMEOUT_PROPERTY));
     FEP3_RETURN_IF_FAILED(unregisterPropertyVariable(_clock_sim_time_time_factor, FEP3_CLOCK_SIM_TIME_TIME_FACTOR_PROPERTY));
     FEP3_RETURN_IF_FAILED(unregisterPropertyVariable(_clock_sim_time_cycle_time, FEP3_CLOCK_SIM_TIME_CYCLE_TIME_PROPERTY));
+    FEP3_RETURN_IF_FAILED(unregisterPropertyVariable(_shared_clock, FEP3_CLOCK_SHARED_CLOCK_PROPERTY));
+    FEP3_RETURN_IF_FAILED(unregisterPropertyVariable(_thread_configuration, FEP3_CLOCK_THREAD_CONFIGURATION_PROPERTY));
 
     return {};
 }
@@ -437,6 +483,7 @@ fep3::Result LocalClockService::destroy()
         RETURN_ERROR_DESCRIPTION(ERR_INVALID_STATE, "No IComponents set, can not get configuration interface");
     }
 
+    _clock_master->closeSharedClock();
     auto res = unregisterServices(*components);
 
     _configuration.deinitConfiguration();
@@ -475,6 +522,8 @@ fep3::Result LocalClockService::tense()
         RETURN_ERROR_DESCRIPTION(ERR_EMPTY, exception.what());
     }
 
+    FEP3_RETURN_IF_FAILED(setupSharedClock());
+
     if (FEP3_CLOCK_LOCAL_SYSTEM_SIM_TIME == static_cast<std::string>(_configuration._main_clock_name))
     {
         FEP3_RETURN_IF_FAILED(_configuration.validateSimClockConfiguration(*_logger));
@@ -482,6 +531,18 @@ fep3::Result LocalClockService::tense()
         _local_system_sim_clock->updateConfiguration(
             Duration(std::chrono::milliseconds(_configuration._clock_sim_time_cycle_time)),
             _configuration._clock_sim_time_time_factor);
+
+        const std::string thread_configuration_string = _configuration._thread_configuration;
+        ThreadConfiguration thread_configuration;
+        const auto result = thread::parseConfiguration(thread_configuration_string, thread_configuration);
+        if (isFailed(result))
+        {
+            RETURN_ERROR_DESCRIPTION(ERR_INVALID_ARG, "Invalid value '%s' of property '%s': %s",
+                thread_configuration_string.c_str(),
+                FEP3_CLOCK_SERVICE_CLOCK_THREAD_CONFIGURATION,
+                result.getDescription());
+        }
+        _local_system_sim_clock->updateThreadConfiguration(thread_configuration);
     }
 
     return {};
@@ -497,6 +558,17 @@ fep3::Result LocalClockService::start()
     }
     
     current_clock->start(_clock_event_sink_registry);    
+    if (current_clock == _local_system_sim_clock)
+    {
+        // IClock::start can not fail, so the worker thread of the native discrete clock is checked here
+        const auto result = _local_system_sim_clock->getThreadConfigurationResult();
+        if (isFailed(result))
+        {
+            current_clock->stop();
+            return result;
+        }
+    }
+    _clock_master->startSharedClock(current_clock);
   
     _is_started = true;
 
@@ -508,6 +580,7 @@ fep3::Result LocalClockService::stop()
     std::lock_guard<std::recursive_mutex> lock_guard(_recursive_mutex);
 
     _current_clock->stop();
+    _clock_master->stopSharedClock();
     _is_started = false;
  
     return {};
@@ -790,6 +863,37 @@ fep3::Result LocalClockService::setupClockMaster(const IServiceBus& service_bus)
     return {};
 }
 
+fep3::Result LocalClockService::setupSharedClock()
+{
+    const bool shared_clock = _configuration._shared_clock;
+    if (!shared_clock)
+    {
+        _clock_master->closeSharedClock();
+        return {};
+    }
+
+    const auto components = _components.lock();
+    if (!components)
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_INVALID_STATE, "No IComponents set, can not get service bus interface");
+    }
+    const auto service_bus = components->getComponent<IServiceBus>();
+    if (!service_bus || !service_bus->getServer())
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_NOT_FOUND, "RPC Server not found");
+    }
+
+    // the timing master works without the shared clock, slaves on the same host have to use rpc then
+    const auto server = service_bus->getServer();
+    const auto result = _clock_master->openSharedClock(rpc::getSystemName(*server), server->getName());
+    if (isFailed(result))
+    {
+        logWarning(std::string("Publishing the time to the shared clock is not possible: ") + result.getDescription());
+    }
+
+    return {};
+}
+
 fep3::Result LocalClockService::setupRPCClockSyncMaster(IServiceBus::IParticipantServer& rpc_server)
 {
     if (_rpc_impl_master == nullptr)
@@ -821,6 +925,12 @@ fep3::Result LocalClockService::masterRegisterSlave(const std::string& slave_nam
     return _clock_master->registerSlave(slave_name, event_id_flag);
 }
 
+fep3::Result LocalClockService::masterRegisterSlaveSyncChannel(const std::string& slave_name,
+    const std::string& channel_address) const
+{
+    return _clock_master->registerSlaveSyncChannel(slave_name, channel_address);
+}
+
 fep3::Result LocalClockService::masterUnregisterSlave(const std::string& slave_name) const
 {
     return _clock_master->unregisterSlave(slave_name);
@@ -832,6 +942,10 @@ fep3::Result LocalClockService::masterSlaveSyncedEvent(const std::string& slave_
     return _clock_master->receiveSlaveSyncedEvent(slave_name, time);
 }
 
+std::map<std::string, rpc::SyncLatencyHistogram::Statistic> LocalClockService::masterGetSlaveSyncLatencies() const
+{
+    return _clock_master->getSlaveSyncLatencies();
+}
 
 fep3::Result LocalClockService::logError(const fep3::Result& error) const
 {
@@ -14,6 +14,7 @@
 #pragma once
 
 #include <list>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -53,6 +54,7 @@ protected:
     std::string getMainClockName() override;
     std::string getTime(const std::string& clock_name) override;
     int getType(const std::string& clock_name) override;
+    Json::Value getSlaveSyncLatencies() override;
 
 private:
     LocalClockService& _service;
@@ -74,6 +76,8 @@ struct ClockServiceConfiguration : public Configuration
     PropertyVariable<int32_t>           _time_update_timeout{ FEP3_TIME_UPDATE_TIMEOUT_DEFAULT_VALUE };
     PropertyVariable<double>            _clock_sim_time_time_factor{ FEP3_CLOCK_SIM_TIME_TIME_FACTOR_DEFAULT_VALUE };
     PropertyVariable<int32_t>           _clock_sim_time_cycle_time{ FEP3_CLOCK_SIM_TIME_CYCLE_TIME_DEFAULT_VALUE };
+    PropertyVariable<bool>              _shared_clock{ FEP3_CLOCK_SHARED_CLOCK_DEFAULT_VALUE };
+    PropertyVariable<std::string>       _thread_configuration{ "" };
 };
 
 /**
@@ -124,8 +128,10 @@ public: // inherited via ComponentBase
 
 public: // for Sync Master support
     fep3::Result masterRegisterSlave(const std::string& slave_name, int event_id_flag) const;
+    fep3::Result masterRegisterSlaveSyncChannel(const std::string& slave_name, const std::string& channel_address) const;
     fep3::Result masterUnregisterSlave(const std::string& slave_name) const;
     fep3::Result masterSlaveSyncedEvent(const std::string& slave_name, Timestamp time) const;
+    std::map<std::string, rpc::SyncLatencyHistogram::Statistic> masterGetSlaveSyncLatencies() const;
 
 private:
     Optional<Timestamp> getTimeUnlocked(const std::string& clock_name) const;
@@ -140,6 +146,7 @@ private:
     fep3::Result unregisterServices(const IComponents& components);
     fep3::Result registerDefaultClocks();
     fep3::Result setupClockMaster(const IServiceBus& service_bus);
+    fep3::Result setupSharedClock();
     fep3::Result setupRPCClockSyncMaster(IServiceBus::IParticipantServer& rpc_server);
     fep3::Result setupRPCClockService(IServiceBus::IParticipantServer& rpc_server);
 
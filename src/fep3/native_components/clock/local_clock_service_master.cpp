@@ -11,6 +11,7 @@
 
 #include "local_clock_service_master.h"
 
+#include <algorithm>
 #include <limits>
 
 #include <a_util/result/result_type.h>
@@ -24,6 +25,8 @@ using namespace std::chrono;
 namespace
 {
     constexpr nanoseconds minimum_safety_timeout = nanoseconds(1000000000);
+    // synchronizing a slave mostly waits for its reply, so more slaves than cores are synchronized concurrently
+    constexpr size_t max_synchronization_threads = 64;
 }
 
 namespace fep3
@@ -81,6 +84,8 @@ void ClockSlave::deactivate()
 {
     std::lock_guard<std::mutex> lock(_mutex);
     _active = false;
+    // a synchronization still executing keeps its own reference to the channel
+    _sync_channel.reset();
 }
 
 bool ClockSlave::isActive()
@@ -107,6 +112,18 @@ std::string ClockSlave::getName()
     return _name;
 }
 
+void ClockSlave::setSyncChannel(std::shared_ptr<ClockSyncChannelClient> sync_channel)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _sync_channel = std::move(sync_channel);
+}
+
+std::shared_ptr<ClockSyncChannelClient> ClockSlave::getSyncChannel()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _sync_channel;
+}
+
 ClockMaster::ClockMaster(const std::shared_ptr<const ILoggingService::ILogger>& logger
     , nanoseconds rpc_timeout
     , const std::function<fep3::Result()>& set_participant_to_error_state
@@ -130,8 +147,23 @@ ClockMaster::ClockMaster(const std::shared_ptr<const ILoggingService::ILogger>&
 
 void ClockMaster::createUpdateFunctions()
 {
-    _func_time_update_begin = [](ClockSlave& slave, const Timestamp new_time, const Timestamp old_time) ->void
+    // slaves with a sync channel get all events of a time step with the time updating event in one frame,
+    // slaves not registered for the time updating event get a frame for every event they are registered for
+    const auto rpc_timeout = _rpc_timeout;
+
+    _func_time_update_begin = [rpc_timeout](ClockSlave& slave, const Timestamp new_time, const Timestamp old_time) ->void
     {
+        const auto sync_channel = slave.getSyncChannel();
+        if (sync_channel)
+        {
+            sync_channel->queueEvent(IRPCClockSyncMasterDef::EventID::time_update_before, new_time, old_time);
+            if (!slave.isSet(IRPCClockSyncMasterDef::EventIDFlag::register_for_time_updating))
+            {
+                sync_channel->sendEvents(rpc_timeout);
+            }
+            return;
+        }
+
         toInt64(
             slave.syncTimeEvent(
                 static_cast<int>(IRPCClockSyncMasterDef::EventID::time_update_before),
@@ -139,8 +171,21 @@ void ClockMaster::createUpdateFunctions()
                 toString(old_time.count())));
     };
 
-    _func_time_updating = [](ClockSlave& slave, const Timestamp new_time) ->void
+    _func_time_updating = [rpc_timeout](ClockSlave& slave, const Timestamp new_time, const bool time_update_end_pending) ->void
     {
+        const auto sync_channel = slave.getSyncChannel();
+        if (sync_channel)
+        {
+            sync_channel->queueEvent(IRPCClockSyncMasterDef::EventID::time_updating, new_time, Timestamp{ 0 });
+            if (time_update_end_pending
+                && slave.isSet(IRPCClockSyncMasterDef::EventIDFlag::register_for_time_update_after))
+            {
+                sync_channel->queueEvent(IRPCClockSyncMasterDef::EventID::time_update_after, new_time, Timestamp{ 0 });
+            }
+            sync_channel->sendEvents(rpc_timeout);
+            return;
+        }
+
         toInt64(
             slave.syncTimeEvent(
                 static_cast<int>(IRPCClockSyncMasterDef::EventID::time_updating),
@@ -148,8 +193,21 @@ void ClockMaster::createUpdateFunctions()
                 toString(0)));
     };
 
-    _func_time_update_end = [](ClockSlave& slave, const Timestamp new_time) ->void
+    _func_time_update_end = [rpc_timeout](ClockSlave& slave, const Timestamp new_time, const bool sent_with_updating) ->void
     {
+        const auto sync_channel = slave.getSyncChannel();
+        if (sync_channel)
+        {
+            if (sent_with_updating
+                && slave.isSet(IRPCClockSyncMasterDef::EventIDFlag::register_for_time_updating))
+            {
+                return;
+            }
+            sync_channel->queueEvent(IRPCClockSyncMasterDef::EventID::time_update_after, new_time, Timestamp{ 0 });
+            sync_channel->sendEvents(rpc_timeout);
+            return;
+        }
+
         toInt64(
             slave.syncTimeEvent(
                 static_cast<int>(IRPCClockSyncMasterDef::EventID::time_update_after),
@@ -157,8 +215,16 @@ void ClockMaster::createUpdateFunctions()
                 toString(0)));
     };
 
-    _func_time_reset_begin = [](ClockSlave& slave, const Timestamp new_time, const Timestamp old_time) ->void
+    _func_time_reset_begin = [rpc_timeout](ClockSlave& slave, const Timestamp new_time, const Timestamp old_time) ->void
     {
+        const auto sync_channel = slave.getSyncChannel();
+        if (sync_channel)
+        {
+            sync_channel->queueEvent(IRPCClockSyncMasterDef::EventID::time_reset, new_time, old_time);
+            sync_channel->sendEvents(rpc_timeout);
+            return;
+        }
+
         toInt64(
             slave.syncTimeEvent(
                 static_cast<int>(IRPCClockSyncMasterDef::EventID::time_reset),
@@ -167,7 +233,10 @@ void ClockMaster::createUpdateFunctions()
     };
 }
 
-ClockMaster::~ClockMaster() = default;
+ClockMaster::~ClockMaster()
+{
+    closeSharedClock();
+}
 
 fep3::Result ClockMaster::registerSlave(const std::string& slave_name, int event_id_flag)
 {
@@ -182,6 +251,8 @@ fep3::Result ClockMaster::registerSlave(const std::string& slave_name, int event
     auto it = _slaves.find(slave_name);
     if (it != _slaves.end())
     {
+        // a registering slave has to negotiate its sync channel again
+        it->second->_slave->setSyncChannel(nullptr);
         it->second->_slave->setEventIDFlag(event_id_flag);
         it->second->_slave->activate();
     }
@@ -214,11 +285,157 @@ fep3::Result ClockMaster::unregisterSlave(const std::string& slave_name)
     RETURN_ERROR_DESCRIPTION(ERR_NOT_FOUND, format("a slave with name '%s' was not found", slave_name.c_str()).c_str());    
 }
 
+fep3::Result ClockMaster::registerSlaveSyncChannel(const std::string& slave_name, const std::string& channel_address)
+{
+    std::shared_ptr<ClockSlave> slave;
+    nanoseconds rpc_timeout;
+    {
+        std::lock_guard<std::mutex> lock(_slaves_mutex);
+        auto it = _slaves.find(slave_name);
+        if (it == _slaves.end())
+        {
+            RETURN_ERROR_DESCRIPTION(ERR_NOT_FOUND, format("a slave with name '%s' was not found", slave_name.c_str()).c_str());
+        }
+        slave = it->second->_slave;
+        rpc_timeout = _rpc_timeout;
+    }
+
+    // connecting may take up to the rpc timeout, the time events must not wait for it
+    auto sync_channel = std::make_shared<ClockSyncChannelClient>();
+    FEP3_RETURN_IF_FAILED(sync_channel->connect(channel_address, rpc_timeout));
+
+    std::lock_guard<std::mutex> lock(_slaves_mutex);
+    if (!slave->isActive())
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_INVALID_STATE,
+            format("the slave '%s' was unregistered while connecting its sync channel", slave_name.c_str()).c_str());
+    }
+    slave->setSyncChannel(sync_channel);
+
+    return{};
+}
+
+fep3::Result ClockMaster::openSharedClock(const std::string& system_name, const std::string& master_name)
+{
+    closeSharedClock();
+
+    auto shared_clock = std::make_shared<SharedClockSegment>();
+    FEP3_RETURN_IF_FAILED(shared_clock->create(system_name, master_name));
+
+    std::lock_guard<std::mutex> lock(_slaves_mutex);
+    _shared_clock = std::move(shared_clock);
+
+    return{};
+}
+
+void ClockMaster::closeSharedClock()
+{
+    stopSharedClock();
+
+    std::lock_guard<std::mutex> lock(_slaves_mutex);
+    _shared_clock.reset();
+}
+
+void ClockMaster::startSharedClock(const std::shared_ptr<IClock>& clock)
+{
+    stopSharedClock();
+
+    std::shared_ptr<SharedClockSegment> segment;
+    {
+        std::lock_guard<std::mutex> lock(_slaves_mutex);
+        segment = _shared_clock;
+    }
+    if (!segment || !clock)
+    {
+        return;
+    }
+
+    const auto clock_type = clock->getType();
+    if (clock_type == IClock::ClockType::continuous)
+    {
+        // getting the time may emit events to this master, so the slaves mutex must not be locked
+        segment->publishTime(clock->getTime());
+    }
+    segment->setRunning(true, clock_type);
+
+    if (clock_type == IClock::ClockType::continuous)
+    {
+        std::lock_guard<std::mutex> lock(_shared_clock_refresher_mutex);
+        _shared_clock_refresher_stop = false;
+        _shared_clock_refresher = std::thread(&ClockMaster::refreshSharedClock, this, segment, clock);
+    }
+}
+
+void ClockMaster::stopSharedClock()
+{
+    {
+        std::lock_guard<std::mutex> lock(_shared_clock_refresher_mutex);
+        _shared_clock_refresher_stop = true;
+    }
+    _shared_clock_refresher_condition.notify_all();
+    if (_shared_clock_refresher.joinable())
+    {
+        _shared_clock_refresher.join();
+    }
+
+    std::lock_guard<std::mutex> lock(_slaves_mutex);
+    if (_shared_clock)
+    {
+        _shared_clock->setRunning(false, _shared_clock->read()._clock_type);
+    }
+}
+
+void ClockMaster::refreshSharedClock(const std::shared_ptr<SharedClockSegment>& segment,
+    const std::shared_ptr<IClock>& clock)
+{
+    std::unique_lock<std::mutex> lock(_shared_clock_refresher_mutex);
+    while (!_shared_clock_refresher_stop)
+    {
+        lock.unlock();
+        segment->publishTime(clock->getTime());
+        lock.lock();
+
+        _shared_clock_refresher_condition.wait_for(lock, shared_clock::refresh_period,
+            [this] { return _shared_clock_refresher_stop; });
+    }
+}
+
+void ClockMaster::waitForSharedClockSlaves(const uint32_t event_sequence, const std::string& message) const
+{
+    if (!_shared_clock)
+    {
+        return;
+    }
+
+    const auto released_slaves = _shared_clock->waitForAcknowledgements(event_sequence, _rpc_timeout);
+    if (released_slaves > 0)
+    {
+        _logger->logError(format(
+            "%s: %d slave(s) of the shared clock did not acknowledge in time. "
+                "The slaves will not be waited for anymore until they acknowledge again"
+            , message.c_str()
+            , released_slaves));
+    }
+}
+
 fep3::Result ClockMaster::receiveSlaveSyncedEvent(const std::string& /*slave_name*/, Timestamp /*time*/)
 {
     return {};
 }
 
+std::map<std::string, SyncLatencyHistogram::Statistic> ClockMaster::getSlaveSyncLatencies()
+{
+    std::lock_guard<std::mutex> lock(_slaves_mutex);
+
+    std::map<std::string, SyncLatencyHistogram::Statistic> latencies;
+    for (const auto& slave : _slaves)
+    {
+        latencies[slave.first] = slave.second->_latencies.getStatistic();
+    }
+
+    return latencies;
+}
+
 fep3::Result ClockMaster::updateTimeout(const nanoseconds rpc_timeout)
 {    
     const auto safety_timeout = calculateSafetyTimeout(rpc_timeout);
@@ -235,6 +452,7 @@ fep3::Result ClockMaster::updateTimeout(const nanoseconds rpc_timeout)
 void ClockMaster::timeUpdateBegin(Timestamp old_time, Timestamp new_time)
 {
     std::lock_guard<std::mutex> lock(_slaves_mutex);
+    _time_update_end_pending = true;
 
     auto func_wrapper = [&](ClockSlave& slave) {
         _func_time_update_begin(slave, new_time, old_time);
@@ -249,21 +467,34 @@ void ClockMaster::timeUpdating(Timestamp new_time)
 {       
     std::lock_guard<std::mutex> lock(_slaves_mutex);
 
-    auto func_wrapper = [&](ClockSlave& slave){
-            _func_time_updating(slave, new_time);
+    // slaves of the shared clock process the event while the rpc slaves are synchronized
+    const auto shared_clock_event = _shared_clock
+        ? _shared_clock->publishEvent(IRPCClockSyncMasterDef::EventID::time_updating, new_time, Timestamp{ 0 })
+        : 0;
+
+    const auto time_update_end_pending = _time_update_end_pending;
+    _time_update_end_sent_with_updating = time_update_end_pending;
+    auto func_wrapper = [&, time_update_end_pending](ClockSlave& slave){
+            _func_time_updating(slave, new_time, time_update_end_pending);
     };    
         
     synchronizeEvent(func_wrapper
         , IRPCClockSyncMasterDef::EventIDFlag::register_for_time_updating
         , format("an error occured during time_updating at time %lld", new_time));
+
+    waitForSharedClockSlaves(shared_clock_event
+        , format("an error occured during time_updating at time %lld", new_time));
 }
 
 void ClockMaster::timeUpdateEnd(Timestamp new_time)
 {
     std::lock_guard<std::mutex> lock(_slaves_mutex);
+    _time_update_end_pending = false;
+    const auto sent_with_updating = _time_update_end_sent_with_updating;
+    _time_update_end_sent_with_updating = false;
 
-    auto func_wrapper = [&](ClockSlave& slave){
-        _func_time_update_end(slave, new_time);
+    auto func_wrapper = [&, sent_with_updating](ClockSlave& slave){
+        _func_time_update_end(slave, new_time, sent_with_updating);
     };
 
     synchronizeEvent(func_wrapper
@@ -275,6 +506,10 @@ void ClockMaster::timeResetBegin(Timestamp old_time, Timestamp new_time)
 {
     std::lock_guard<std::mutex> lock(_slaves_mutex);    
 
+    const auto shared_clock_event = _shared_clock
+        ? _shared_clock->publishEvent(IRPCClockSyncMasterDef::EventID::time_reset, new_time, old_time)
+        : 0;
+
     auto func_wrapper = [&](ClockSlave& slave) {
         _func_time_reset_begin(slave, new_time, old_time);
     };
@@ -282,6 +517,9 @@ void ClockMaster::timeResetBegin(Timestamp old_time, Timestamp new_time)
     synchronizeEvent(func_wrapper
         , IRPCClockSyncMasterDef::EventIDFlag::register_for_time_reset
         , format("an error occured during time_reset at old time %lld", old_time));
+
+    waitForSharedClockSlaves(shared_clock_event
+        , format("an error occured during time_reset at old time %lld", old_time));
 }
 
 void ClockMaster::timeResetEnd(Timestamp /*new_time*/)
@@ -306,44 +544,140 @@ void ClockMaster::synchronizeEvent(const std::function<void(ClockSlave&)>& sync_
     }
 }
 
-AsyncExecutor::AsyncExecutor()
+SynchronizationPool::SynchronizationPool(const size_t max_threads)
+    : _max_threads(std::max<size_t>(max_threads, 1))
+{
+}
+
+SynchronizationPool::~SynchronizationPool()
 {
-    _sync_thread = std::thread(&AsyncExecutor::executionLoop, this);
+    {
+        std::lock_guard<std::mutex> lock(_tasks_mutex);
+        _stop = true;
+    }
+    _condition_task_posted.notify_all();
+
+    for (auto& thread : _threads)
+    {
+        thread.join();
+    }
 }
 
+void SynchronizationPool::post(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(_tasks_mutex);
+        _tasks.push_back(std::move(task));
+
+        // every task has to be executed concurrently as long as the maximum is not reached
+        if (_tasks.size() > _idle_threads && _threads.size() < _max_threads)
+        {
+            _threads.emplace_back(&SynchronizationPool::executionLoop, this);
+            return;
+        }
+    }
+    _condition_task_posted.notify_one();
+}
 
-void AsyncExecutor::executionLoop()
+void SynchronizationPool::executionLoop()
 {
-    while (!_stop)
-    {           
+    std::unique_lock<std::mutex> lock(_tasks_mutex);
+    while (true)
+    {
+        ++_idle_threads;
+        _condition_task_posted.wait(lock, [this] { return _stop || !_tasks.empty(); });
+        --_idle_threads;
+
+        if (_stop)
         {
-            std::unique_lock<std::mutex> lock(_tasks_mutex);
-            /// using while because of spurious wakeups
-            if (_tasks.empty())
-            {           
-                _condition_sync_start.wait(lock);
-            }
-        }              
+            return;
+        }
 
-        /// we check here again because we can be woken up by destructor        
-        if (!_stop)
-        {                      
-            std::packaged_task<void()> task;
+        auto task = std::move(_tasks.front());
+        _tasks.pop_front();
 
+        lock.unlock();
+        task();
+        lock.lock();
+    }
+}
+
+constexpr std::array<microseconds::rep, 12> SyncLatencyHistogram::bucket_upper_bounds_us;
+
+void SyncLatencyHistogram::add(const nanoseconds latency)
+{
+    const auto bucket = std::lower_bound(bucket_upper_bounds_us.begin(), bucket_upper_bounds_us.end(),
+        duration_cast<microseconds>(latency).count());
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_statistic._count == 0 || latency < _statistic._min)
+    {
+        _statistic._min = latency;
+    }
+    if (latency > _statistic._max)
+    {
+        _statistic._max = latency;
+    }
+    ++_statistic._count;
+    _statistic._total += latency;
+    ++_statistic._buckets[static_cast<size_t>(bucket - bucket_upper_bounds_us.begin())];
+}
+
+SyncLatencyHistogram::Statistic SyncLatencyHistogram::getStatistic() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _statistic;
+}
+
+std::future<void> ClockMaster::SlaveEntry::enqueueTask(SynchronizationPool& pool, std::function<void()> task)
+{
+    auto measured_task = std::packaged_task<void()>([this, task]()
+    {
+        const auto begin = steady_clock::now();
+        try
+        {
+            task();
+        }
+        catch (...)
+        {
+            _latencies.add(steady_clock::now() - begin);
+            throw;
+        }
+        _latencies.add(steady_clock::now() - begin);
+    });
+    auto future = measured_task.get_future();
+
+    {
+        std::lock_guard<std::mutex> lock(_tasks_mutex);
+        _tasks.push(std::move(measured_task));
+        if (_executing)
+        {
+            // a previous task of this slave is still executing, e.g. after a safety timeout
+            return future;
+        }
+        _executing = true;
+    }
+    pool.post([this]() { executeTasks(); });
+
+    return future;
+}
+
+void ClockMaster::SlaveEntry::executeTasks()
+{
+    while (true)
+    {
+        std::packaged_task<void()> task;
+        {
+            std::lock_guard<std::mutex> lock(_tasks_mutex);
+            if (_tasks.empty())
             {
-                std::unique_lock<std::mutex> lock(_tasks_mutex);
-                if (!_tasks.empty())
-                {                
-                    task = std::move(_tasks.front());
-                    _tasks.pop();                   
-                }
-            }            
-
-            if (task.valid())
-            {
-                (task)();
-            }                        
+                _executing = false;
+                return;
+            }
+            task = std::move(_tasks.front());
+            _tasks.pop();
         }
+        task();
     }
 }
 
@@ -352,6 +686,7 @@ ClockMaster::MultipleSlavesSynchronizer::MultipleSlavesSynchronizer(
     const std::shared_ptr<const ILoggingService::ILogger>& logger)
     : _safety_timeout(timeout)
     , _logger(logger)
+    , _pool(max_synchronization_threads)
 {
 }
 
@@ -367,7 +702,6 @@ void ClockMaster::MultipleSlavesSynchronizer::synchronize(
     {
         const auto& slave_entry = it.second;
         auto clock_slave = it.second->_slave;
-        auto& slave_synchronizer = it.second->_async_executor;
 
         if (!clock_slave->isActive())
         {
@@ -382,7 +716,7 @@ void ClockMaster::MultipleSlavesSynchronizer::synchronize(
             };
 
             synchronizations.emplace_back(
-                *slave_entry, slave_synchronizer.enqueueTask(sync_func_slave_binded));            
+                *slave_entry, slave_entry->enqueueTask(_pool, sync_func_slave_binded));
         }
     }
 
@@ -392,7 +726,8 @@ void ClockMaster::MultipleSlavesSynchronizer::synchronize(
 void ClockMaster::MultipleSlavesSynchronizer::waitUntilSyncFinish(
     std::vector<std::pair<SlaveEntry&, std::future<void>>>& current_synchronizations) const
 {
-    const auto timeout_until = system_clock::now() + _safety_timeout;
+    // all slaves are synchronized concurrently, so they share one deadline
+    const auto timeout_until = steady_clock::now() + _safety_timeout;
 
     for (auto& synchronization : current_synchronizations)
     {
@@ -425,7 +760,19 @@ void ClockMaster::MultipleSlavesSynchronizer::waitUntilSyncFinish(
                 _logger->logError(message);
 
                 synchronization.first._slave->deactivate();
-            }         
+            }
+            catch (const ClockSyncChannelError& ex)
+            {
+                const auto message = format(
+                    "an error occured during synchronization of slave '%s' via its sync channel. "
+                        "Could be a timeout. Slave will be deactivated: %s"
+                    , slave_name.c_str()
+                    , ex.what());
+
+                _logger->logError(message);
+
+                synchronization.first._slave->deactivate();
+            }
         }
         else
         {
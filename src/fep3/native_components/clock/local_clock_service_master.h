@@ -11,6 +11,11 @@
 
 #pragma once
 
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -18,12 +23,15 @@
 #include <condition_variable>
 #include <future>
 #include <queue>
+#include <vector>
 
 #include <fep3/rpc_services/clock_sync/clock_sync_slave_client_stub.h>
 #include <fep3/rpc_services/clock_sync/clock_sync_service_rpc_intf_def.h>
 #include <fep3/components/service_bus/rpc/fep_rpc_stubs_client.h>
 #include "fep3/components/clock/clock_service_intf.h"
 #include <fep3/components/logging/logging_service_intf.h>
+#include <fep3/native_components/clock_sync/clock_sync_channel.h>
+#include <fep3/native_components/clock_sync/shared_clock_segment.h>
 
 #include "fep3/components/service_bus/service_bus_intf.h"
 
@@ -32,48 +40,61 @@ namespace fep3
 namespace rpc
 {
 
-class AsyncExecutor
+/**
+ * Bounded pool of threads synchronizing the slaves.
+ * Threads are started on demand up to @p max_threads, so a master with a few slaves keeps a few threads only.
+ */
+class SynchronizationPool
 {
 public:
-    AsyncExecutor();
-    ~AsyncExecutor()
-    {
-        _stop = true;
-        _condition_sync_start.notify_one();
-        if (_sync_thread.joinable())
-        {
-            _sync_thread.join();
-        }
-    }
-    AsyncExecutor(AsyncExecutor&) = delete;
-    AsyncExecutor(AsyncExecutor&&) = delete;
-    AsyncExecutor& operator=(AsyncExecutor&) = delete;
-    AsyncExecutor& operator=(AsyncExecutor&&) = delete;
-
-    template<typename F, typename R = std::result_of_t<F && ()>>
-    std::future<void> enqueueTask(F&& f)
-    {
-        auto task = std::packaged_task<R()>(std::forward<F>(f));
-        auto future = task.get_future();
+    explicit SynchronizationPool(size_t max_threads);
+    ~SynchronizationPool();
+    SynchronizationPool(SynchronizationPool&) = delete;
+    SynchronizationPool(SynchronizationPool&&) = delete;
+    SynchronizationPool& operator=(SynchronizationPool&) = delete;
+    SynchronizationPool& operator=(SynchronizationPool&&) = delete;
 
-        {
-            std::unique_lock<std::mutex> lock(_tasks_mutex);
-            _tasks.push(std::move(task));
-        }
-        _condition_sync_start.notify_one();
-
-        return future;
-    }    
+    void post(std::function<void()> task);
 
 private:
-    void executionLoop();   
+    void executionLoop();
 
 private:
-    std::thread _sync_thread{};
-    std::condition_variable _condition_sync_start{};
+    const size_t _max_threads;
+    std::vector<std::thread> _threads;
+    std::condition_variable _condition_task_posted{};
     std::mutex _tasks_mutex{};
-    std::queue<std::packaged_task<void()>> _tasks;
-    std::atomic_bool _stop{ false };
+    std::deque<std::function<void()>> _tasks;
+    size_t _idle_threads{ 0 };
+    bool _stop{ false };
+};
+
+/**
+ * Histogram of the durations the synchronizations of one slave took.
+ */
+class SyncLatencyHistogram
+{
+public:
+    /// upper bounds of the buckets, the last bucket takes all longer latencies
+    static constexpr std::array<std::chrono::microseconds::rep, 12> bucket_upper_bounds_us{ {
+        100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 1000000 } };
+
+    struct Statistic
+    {
+        uint64_t _count{ 0 };
+        std::chrono::nanoseconds _min{ 0 };
+        std::chrono::nanoseconds _max{ 0 };
+        std::chrono::nanoseconds _total{ 0 };
+        std::array<uint64_t, bucket_upper_bounds_us.size() + 1> _buckets{ {} };
+    };
+
+public:
+    void add(std::chrono::nanoseconds latency);
+    Statistic getStatistic() const;
+
+private:
+    mutable std::mutex _mutex;
+    Statistic _statistic;
 };
 
 class ClockSlave
@@ -84,6 +105,10 @@ public:
     ~ClockSlave() = default;
 
     void activate();
+    /**
+     * Deactivates the slave and drops its sync channel together with the events queued for it,
+     * a slave has to register again and negotiate a new channel to be synchronized again.
+     */
     void deactivate();
     bool isActive();
 
@@ -91,10 +116,18 @@ public:
     void setEventIDFlag(int event_id_flag);   
     std::string getName();
 
+    /**
+     * Sets the binary channel used instead of the rpc calls to synchronize this slave,
+     * nullptr to use the rpc calls again.
+     */
+    void setSyncChannel(std::shared_ptr<ClockSyncChannelClient> sync_channel);
+    std::shared_ptr<ClockSyncChannelClient> getSyncChannel();
+
 private:
     bool _active;
     int _event_id_flag;
     std::string _name;
+    std::shared_ptr<ClockSyncChannelClient> _sync_channel;
     std::mutex _mutex;
 };
 
@@ -111,9 +144,40 @@ public:
 
 public:
     Result registerSlave(const std::string& slave_name, int event_id_flag);
+    /**
+     * Connects to the binary clock sync channel of an already registered slave.
+     * On success all time events of one time step are sent to the slave in one frame via the channel,
+     * otherwise the slave is still synchronized by rpc calls.
+     *
+     * @param slave_name the name of the registered slave
+     * @param channel_address the address of the channel server of the slave ("host:port")
+     * @return ERR_NOERROR if the channel is used for the slave, an error otherwise
+     */
+    Result registerSlaveSyncChannel(const std::string& slave_name, const std::string& channel_address);
     Result unregisterSlave(const std::string& slave_name);
     Result receiveSlaveSyncedEvent(const std::string& slave_name, Timestamp time);
     Result updateTimeout(std::chrono::nanoseconds rpc_timeout);
+    /**
+     * @return the latencies of synchronizing the registered slaves by slave name
+     */
+    std::map<std::string, SyncLatencyHistogram::Statistic> getSlaveSyncLatencies();
+
+    /**
+     * Creates the shared clock segment of this master, all time events are published to it additionally.
+     * Slaves on the same host read the time from the segment and the master waits for the discrete ones
+     * like it waits for the rpc slaves.
+     *
+     * @param system_name the name of the system of the master participant, the segment is named after it
+     * @param master_name the name of the master participant, the segment is named after it
+     * @return ERR_NOERROR if the segment is used, an error otherwise
+     */
+    Result openSharedClock(const std::string& system_name, const std::string& master_name);
+    void closeSharedClock();
+    /**
+     * Marks the shared clock as running. The time of a continuous @p clock is published periodically.
+     */
+    void startSharedClock(const std::shared_ptr<IClock>& clock);
+    void stopSharedClock();
 
 public:
     void timeUpdateBegin(Timestamp old_time, Timestamp new_time) override;
@@ -137,9 +201,23 @@ public:
         SlaveEntry& operator=(SlaveEntry&) = delete;
         SlaveEntry& operator=(SlaveEntry&&) = delete;     
 
+        /**
+         * Executes @p task in the @p pool after all tasks enqueued before for this slave,
+         * so the events of one slave never overtake each other. The duration of the task is added to the latencies.
+         */
+        std::future<void> enqueueTask(SynchronizationPool& pool, std::function<void()> task);
+
+    private:
+        void executeTasks();
+
     public:
-        std::shared_ptr<ClockSlave> _slave;      
-        AsyncExecutor _async_executor;
+        std::shared_ptr<ClockSlave> _slave;
+        SyncLatencyHistogram _latencies;
+
+    private:
+        std::mutex _tasks_mutex;
+        std::queue<std::packaged_task<void()>> _tasks;
+        bool _executing{ false };
     };
 
     class MultipleSlavesSynchronizer
@@ -165,6 +243,8 @@ public:
         
         private:
             std::shared_ptr<const ILoggingService::ILogger> _logger;
+            // the pool is destroyed before the slave entries its tasks refer to
+            mutable SynchronizationPool _pool;
     };
 
 private:    
@@ -172,6 +252,9 @@ private:
     void synchronizeEvent(const std::function<void(ClockSlave&)>& sync_func
         , const IRPCClockSyncMasterDef::EventIDFlag event_id_flag
         , const std::string& message) const;
+    void waitForSharedClockSlaves(uint32_t event_sequence, const std::string& message) const;
+    void refreshSharedClock(const std::shared_ptr<SharedClockSegment>& segment,
+        const std::shared_ptr<IClock>& clock);
 
 private:
     std::shared_ptr<IServiceBus> _service_bus;
@@ -180,14 +263,26 @@ private:
     std::chrono::nanoseconds _rpc_timeout;
     MultipleSlavesSynchronizer _slaves_synchronizer;
     std::mutex _slaves_mutex;
+    bool _time_update_end_pending{ false };
+    // the time update end event was sent with the time updating event to the slaves with a sync channel
+    bool _time_update_end_sent_with_updating{ false };
     std::function<Result()> _set_participant_to_error_state;
     const std::function<const std::shared_ptr<IRPCRequester>(
         const std::string& service_participant_name)> _get_rpc_requester_by_name;
 
     std::function<void(ClockSlave&, Timestamp, Timestamp)> _func_time_update_begin;
-    std::function<void(ClockSlave&, Timestamp)> _func_time_updating;
-    std::function<void(ClockSlave&, Timestamp)> _func_time_update_end;
+    // the last parameter tells whether a time update end event follows the time updating event
+    std::function<void(ClockSlave&, Timestamp, bool)> _func_time_updating;
+    // the last parameter tells whether the time update end event was sent with the time updating event
+    std::function<void(ClockSlave&, Timestamp, bool)> _func_time_update_end;
     std::function<void(ClockSlave&, Timestamp, Timestamp)> _func_time_reset_begin;    
+
+    // guarded by the slaves mutex
+    std::shared_ptr<SharedClockSegment> _shared_clock;
+    std::thread _shared_clock_refresher;
+    std::mutex _shared_clock_refresher_mutex;
+    std::condition_variable _shared_clock_refresher_condition;
+    bool _shared_clock_refresher_stop{ true };
 };
 
 } // namespace rpc
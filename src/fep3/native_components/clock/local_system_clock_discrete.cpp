@@ -14,6 +14,7 @@
 #include <iostream>
 
 #include <fep3/components/clock/clock_service_intf.h>
+#include <fep3/base/thread/thread.h>
 
 namespace
 {
@@ -47,6 +48,7 @@ void DiscreteClockUpdater::startWorking()
     _next_request_gettime = time_point<steady_clock>{Timestamp{ 0 }};
     _stop = false;
     _worker = std::thread([this] { work();  });
+    _thread_configuration_result = thread::configure(_worker, "__discrete_clock", _thread_configuration);
 }
 
 void DiscreteClockUpdater::stopWorking()
@@ -113,6 +115,16 @@ void DiscreteClockUpdater::updateConfiguration(const Duration cycle_time, const
     _time_factor = time_factor;
 }
 
+void DiscreteClockUpdater::updateThreadConfiguration(const ThreadConfiguration& thread_configuration)
+{
+    _thread_configuration = thread_configuration;
+}
+
+fep3::Result DiscreteClockUpdater::getThreadConfigurationResult() const
+{
+    return _thread_configuration_result;
+}
+
 LocalSystemSimClock::LocalSystemSimClock()
     : DiscreteClockUpdater()
     , DiscreteClock(FEP3_CLOCK_LOCAL_SYSTEM_SIM_TIME)
@@ -18,6 +18,7 @@
 #include <thread>
 
 #include <fep3/components/clock/clock_base.h>
+#include <fep3/base/thread/thread_configuration.h>
 #include <fep3/fep3_duration.h>
 
 namespace fep3
@@ -76,6 +77,10 @@ private:
     /// Thread to update the clock time
     std::thread                                         _worker;
     std::atomic_bool                                    _stop;
+    /// Cpu affinity and scheduling of the worker thread
+    ThreadConfiguration                                 _thread_configuration;
+    /// Result of configuring the worker thread on the last start
+    fep3::Result                                        _thread_configuration_result;
 
     std::mutex                                          _clock_updater_mutex;
     std::condition_variable                             _cycle_wait_condition;
@@ -89,6 +94,20 @@ public:
     */
     void updateConfiguration(Duration cycle_time,
                              double time_factor);
+
+    /**
+    * @brief Update the configuration of the worker thread, used on the next start of the clock.
+    *
+    * @param thread_configuration cpu affinity and scheduling of the worker thread
+    */
+    void updateThreadConfiguration(const ThreadConfiguration& thread_configuration);
+
+    /**
+    * @brief Get the result of configuring the worker thread on the last start of the clock.
+    *
+    * @return the error if the worker thread could not be configured
+    */
+    fep3::Result getThreadConfigurationResult() const;
 };
 
 /**
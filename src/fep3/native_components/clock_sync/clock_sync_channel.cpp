@@ -0,0 +1,561 @@
+/**
+* @file
+* Copyright &copy; Audi AG. All rights reserved.
+*
+* This Source Code Form is subject to the terms of the
+* Mozilla Public License, v. 2.0.
+* If a copy of the MPL was not distributed with this
+* file, You can obtain one at https://mozilla.org/MPL/2.0/.
+*
+*/
+
+#include "clock_sync_channel.h"
+
+#include <fep3/base/thread/thread.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include <a_util/result/error_def.h>
+#include <a_util/strings/strings_format.h>
+
+#ifdef WIN32
+    #include <winsock2.h>
+    #include <ws2tcpip.h>
+    #define closeSocket(fd_socket) closesocket(fd_socket)
+    using socket_length = int;
+#else
+    #include <arpa/inet.h>
+    #include <fcntl.h>
+    #include <netdb.h>
+    #include <netinet/in.h>
+    #include <netinet/tcp.h>
+    #include <poll.h>
+    #include <sys/socket.h>
+    #include <unistd.h>
+    #define SOCKET int
+    #define INVALID_SOCKET (-1)
+    #define closeSocket(fd_socket) close(fd_socket)
+    using socket_length = socklen_t;
+#endif
+
+using namespace std::chrono;
+
+namespace fep3
+{
+namespace rpc
+{
+
+namespace
+{
+
+constexpr size_t handshake_size = 5;
+constexpr size_t request_header_size = 5;
+constexpr size_t event_size = 17;
+constexpr size_t reply_size = 12;
+constexpr milliseconds server_poll_interval{ 100 };
+constexpr milliseconds server_handshake_timeout{ 1000 };
+#ifdef MSG_NOSIGNAL
+// a closed connection has to be reported by send instead of raising SIGPIPE
+constexpr int send_flags = MSG_NOSIGNAL;
+#else
+constexpr int send_flags = 0;
+#endif
+
+void initializeSockets()
+{
+#ifdef WIN32
+    static const int startup_result = []()
+    {
+        WSADATA wsa_data = { 0 };
+        return WSAStartup(MAKEWORD(2, 2), &wsa_data);
+    }();
+    (void)startup_result;
+#endif
+}
+
+SOCKET toSocket(intptr_t socket_handle)
+{
+    return static_cast<SOCKET>(socket_handle);
+}
+
+void closeSocketHandle(intptr_t& socket_handle)
+{
+    if (socket_handle != -1)
+    {
+        closeSocket(toSocket(socket_handle));
+        socket_handle = -1;
+    }
+}
+
+void setNoDelay(SOCKET socket_handle)
+{
+    int opt = 1;
+    setsockopt(socket_handle, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<char*>(&opt), sizeof(opt));
+}
+
+/**
+ * Waits until the socket is ready for the @p events (data can be read by default) but at most @p timeout.
+ */
+bool waitForSocket(SOCKET socket_handle, nanoseconds timeout, short events = POLLIN)
+{
+    pollfd poll_socket;
+    poll_socket.fd = socket_handle;
+    poll_socket.events = events;
+    poll_socket.revents = 0;
+
+    // round up, so a remaining timeout below one millisecond does not busy wait
+    const auto timeout_ms = duration_cast<milliseconds>(timeout + milliseconds(1) - nanoseconds(1)).count();
+#ifdef WIN32
+    return WSAPoll(&poll_socket, 1, static_cast<int>(timeout_ms)) > 0;
+#else
+    return poll(&poll_socket, 1, static_cast<int>(timeout_ms)) > 0;
+#endif
+}
+
+bool setNonBlocking(SOCKET socket_handle, bool non_blocking)
+{
+#ifdef WIN32
+    u_long mode = non_blocking ? 1 : 0;
+    return ioctlsocket(socket_handle, FIONBIO, &mode) == 0;
+#else
+    const auto flags = fcntl(socket_handle, F_GETFL, 0);
+    return flags != -1
+        && fcntl(socket_handle, F_SETFL, non_blocking ? (flags | O_NONBLOCK) : (flags & ~O_NONBLOCK)) == 0;
+#endif
+}
+
+/**
+ * Connects the socket but waits at most until @p deadline for the peer to accept the connection.
+ */
+bool connectUntil(SOCKET socket_handle, const sockaddr* address, socket_length address_length,
+    steady_clock::time_point deadline)
+{
+    if (!setNonBlocking(socket_handle, true))
+    {
+        return false;
+    }
+    if (::connect(socket_handle, address, address_length) != 0)
+    {
+#ifdef WIN32
+        const bool in_progress = WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+        const bool in_progress = errno == EINPROGRESS;
+#endif
+        const auto now = steady_clock::now();
+        if (!in_progress || now >= deadline || !waitForSocket(socket_handle, deadline - now, POLLOUT))
+        {
+            return false;
+        }
+        int socket_error = 0;
+        socket_length socket_error_length = sizeof(socket_error);
+        if (getsockopt(socket_handle, SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&socket_error), &socket_error_length) != 0
+            || socket_error != 0)
+        {
+            return false;
+        }
+    }
+    // sending and receiving wait by poll with their own deadlines
+    return setNonBlocking(socket_handle, false);
+}
+
+bool sendAll(SOCKET socket_handle, const uint8_t* data, size_t size)
+{
+    while (size > 0)
+    {
+        const auto sent = send(socket_handle, reinterpret_cast<const char*>(data), static_cast<int>(size), send_flags);
+        if (sent <= 0)
+        {
+            return false;
+        }
+        data += sent;
+        size -= static_cast<size_t>(sent);
+    }
+    return true;
+}
+
+/**
+ * Receives exactly @p size bytes. Fails if the data is not complete until @p deadline.
+ */
+bool receiveAll(SOCKET socket_handle, uint8_t* data, size_t size, steady_clock::time_point deadline)
+{
+    while (size > 0)
+    {
+        const auto now = steady_clock::now();
+        if (now >= deadline || !waitForSocket(socket_handle, deadline - now))
+        {
+            return false;
+        }
+        const auto received = recv(socket_handle, reinterpret_cast<char*>(data), static_cast<int>(size), 0);
+        if (received <= 0)
+        {
+            return false;
+        }
+        data += received;
+        size -= static_cast<size_t>(received);
+    }
+    return true;
+}
+
+void writeUInt32(uint8_t* buffer, uint32_t value)
+{
+    for (size_t index = 0; index < 4; ++index)
+    {
+        buffer[index] = static_cast<uint8_t>(value >> (8 * index));
+    }
+}
+
+uint32_t readUInt32(const uint8_t* buffer)
+{
+    uint32_t value = 0;
+    for (size_t index = 0; index < 4; ++index)
+    {
+        value |= static_cast<uint32_t>(buffer[index]) << (8 * index);
+    }
+    return value;
+}
+
+void writeInt64(uint8_t* buffer, int64_t value)
+{
+    const auto unsigned_value = static_cast<uint64_t>(value);
+    for (size_t index = 0; index < 8; ++index)
+    {
+        buffer[index] = static_cast<uint8_t>(unsigned_value >> (8 * index));
+    }
+}
+
+int64_t readInt64(const uint8_t* buffer)
+{
+    uint64_t value = 0;
+    for (size_t index = 0; index < 8; ++index)
+    {
+        value |= static_cast<uint64_t>(buffer[index]) << (8 * index);
+    }
+    return static_cast<int64_t>(value);
+}
+
+void writeHandshake(uint8_t* buffer)
+{
+    writeUInt32(buffer, clock_sync_channel::magic);
+    buffer[4] = clock_sync_channel::version;
+}
+
+bool isValidHandshake(const uint8_t* buffer)
+{
+    return readUInt32(buffer) == clock_sync_channel::magic && buffer[4] == clock_sync_channel::version;
+}
+
+bool isValidEventID(uint8_t event_id)
+{
+    return event_id >= static_cast<uint8_t>(IRPCClockSyncMasterDef::EventID::time_update_before)
+        && event_id <= static_cast<uint8_t>(IRPCClockSyncMasterDef::EventID::time_reset);
+}
+
+} // namespace
+
+ClockSyncChannelClient::~ClockSyncChannelClient()
+{
+    disconnect();
+}
+
+fep3::Result ClockSyncChannelClient::connect(const std::string& address, nanoseconds timeout)
+{
+    disconnect();
+    initializeSockets();
+
+    const auto port_separator = address.rfind(':');
+    if (port_separator == std::string::npos || port_separator == 0)
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_INVALID_ARG, "invalid clock sync channel address '%s'", address.c_str());
+    }
+    const auto host = address.substr(0, port_separator);
+    const auto port = address.substr(port_separator + 1);
+
+    addrinfo hints;
+    std::memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* address_info = nullptr;
+    if (getaddrinfo(host.c_str(), port.c_str(), &hints, &address_info) != 0 || !address_info)
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_NOT_FOUND, "unable to resolve clock sync channel address '%s'", address.c_str());
+    }
+
+    const auto socket_handle = socket(address_info->ai_family, address_info->ai_socktype, address_info->ai_protocol);
+    if (socket_handle == INVALID_SOCKET)
+    {
+        freeaddrinfo(address_info);
+        RETURN_ERROR_DESCRIPTION(ERR_FAILED, "unable to create a socket for the clock sync channel");
+    }
+    _socket = static_cast<intptr_t>(socket_handle);
+
+    // the timeout covers connecting and the handshake, an unreachable slave must not block the master
+    const auto deadline = steady_clock::now() + timeout;
+    const auto connected = connectUntil(socket_handle,
+        address_info->ai_addr,
+        static_cast<socket_length>(address_info->ai_addrlen),
+        deadline);
+    freeaddrinfo(address_info);
+    if (!connected)
+    {
+        disconnect();
+        RETURN_ERROR_DESCRIPTION(ERR_NOT_CONNECTED, "unable to connect to the clock sync channel '%s'", address.c_str());
+    }
+    setNoDelay(socket_handle);
+
+    uint8_t handshake[handshake_size];
+    writeHandshake(handshake);
+    if (!sendAll(socket_handle, handshake, handshake_size)
+        || !receiveAll(socket_handle, handshake, handshake_size, deadline)
+        || !isValidHandshake(handshake))
+    {
+        disconnect();
+        RETURN_ERROR_DESCRIPTION(ERR_FAILED, "clock sync channel handshake with '%s' failed", address.c_str());
+    }
+
+    return {};
+}
+
+void ClockSyncChannelClient::queueEvent(IRPCClockSyncMasterDef::EventID event_id,
+    Timestamp new_time,
+    Timestamp old_time)
+{
+    _queued_events.push_back({ event_id, new_time, old_time });
+}
+
+Timestamp ClockSyncChannelClient::sendEvents(nanoseconds timeout)
+{
+    if (_queued_events.size() > clock_sync_channel::max_events_per_frame)
+    {
+        _queued_events.clear();
+        throw ClockSyncChannelError("too many events queued for one clock sync channel frame");
+    }
+    if (_socket == -1)
+    {
+        _queued_events.clear();
+        throw ClockSyncChannelError("clock sync channel is not connected");
+    }
+
+    uint8_t frame[request_header_size + clock_sync_channel::max_events_per_frame * event_size];
+    const auto sequence = ++_sequence;
+    writeUInt32(frame, sequence);
+    frame[4] = static_cast<uint8_t>(_queued_events.size());
+    auto event_buffer = frame + request_header_size;
+    for (const auto& queued_event : _queued_events)
+    {
+        event_buffer[0] = static_cast<uint8_t>(queued_event._event_id);
+        writeInt64(event_buffer + 1, queued_event._new_time.count());
+        writeInt64(event_buffer + 9, queued_event._old_time.count());
+        event_buffer += event_size;
+    }
+    const auto frame_size = request_header_size + _queued_events.size() * event_size;
+    _queued_events.clear();
+
+    const auto socket_handle = toSocket(_socket);
+    uint8_t reply[reply_size];
+    if (!sendAll(socket_handle, frame, frame_size)
+        || !receiveAll(socket_handle, reply, reply_size, steady_clock::now() + timeout))
+    {
+        // the reply of this frame may still arrive, so the connection can not be used anymore
+        disconnect();
+        throw ClockSyncChannelError("clock sync channel timeout or connection lost");
+    }
+    if (readUInt32(reply) != sequence)
+    {
+        disconnect();
+        throw ClockSyncChannelError("clock sync channel received an unexpected acknowledgement");
+    }
+
+    return Timestamp{ readInt64(reply + 4) };
+}
+
+void ClockSyncChannelClient::disconnect()
+{
+    closeSocketHandle(_socket);
+}
+
+ClockSyncChannelServer::ClockSyncChannelServer(EventHandler event_handler)
+    : _event_handler(std::move(event_handler))
+{
+}
+
+ClockSyncChannelServer::~ClockSyncChannelServer()
+{
+    close();
+}
+
+fep3::Result ClockSyncChannelServer::open(const ThreadConfiguration& thread_configuration)
+{
+    close();
+    initializeSockets();
+
+    const auto socket_handle = socket(AF_INET, SOCK_STREAM, 0);
+    if (socket_handle == INVALID_SOCKET)
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_FAILED, "unable to create a socket for the clock sync channel");
+    }
+    _listen_socket = static_cast<intptr_t>(socket_handle);
+
+    sockaddr_in server_address;
+    std::memset(&server_address, 0, sizeof(server_address));
+    server_address.sin_family = AF_INET;
+    server_address.sin_addr.s_addr = INADDR_ANY;
+    // port 0 lets the system choose a free port
+    server_address.sin_port = 0;
+
+    socket_length address_length = sizeof(server_address);
+    if (bind(socket_handle, reinterpret_cast<sockaddr*>(&server_address), sizeof(server_address)) != 0
+        || listen(socket_handle, 1) != 0
+        || getsockname(socket_handle, reinterpret_cast<sockaddr*>(&server_address), &address_length) != 0)
+    {
+        closeSocketHandle(_listen_socket);
+        RETURN_ERROR_DESCRIPTION(ERR_FAILED, "unable to listen for the clock sync channel");
+    }
+    _port = ntohs(server_address.sin_port);
+
+    _stop = false;
+    _thread = std::thread([this]() { serve(); });
+
+    const auto result = fep3::thread::configure(_thread, "__clock_sync_ch", thread_configuration);
+    if (isFailed(result))
+    {
+        close();
+    }
+    return result;
+}
+
+void ClockSyncChannelServer::close()
+{
+    _stop = true;
+    if (_thread.joinable())
+    {
+        _thread.join();
+    }
+    closeSocketHandle(_listen_socket);
+    _port = 0;
+}
+
+uint16_t ClockSyncChannelServer::getPort() const
+{
+    return _port;
+}
+
+void ClockSyncChannelServer::serve()
+{
+    const auto listen_socket = toSocket(_listen_socket);
+    while (!_stop)
+    {
+        if (!waitForSocket(listen_socket, server_poll_interval))
+        {
+            continue;
+        }
+        const auto connection = accept(listen_socket, nullptr, nullptr);
+        if (connection == INVALID_SOCKET)
+        {
+            continue;
+        }
+        setNoDelay(connection);
+
+        auto connection_handle = static_cast<intptr_t>(connection);
+        serveConnection(connection_handle);
+        closeSocketHandle(connection_handle);
+    }
+}
+
+void ClockSyncChannelServer::serveConnection(intptr_t connection_handle)
+{
+    const auto connection = toSocket(connection_handle);
+
+    uint8_t handshake[handshake_size];
+    if (!receiveAll(connection, handshake, handshake_size, steady_clock::now() + server_handshake_timeout)
+        || !isValidHandshake(handshake))
+    {
+        return;
+    }
+    writeHandshake(handshake);
+    if (!sendAll(connection, handshake, handshake_size))
+    {
+        return;
+    }
+
+    uint8_t frame[request_header_size + clock_sync_channel::max_events_per_frame * event_size];
+    uint8_t reply[reply_size];
+    while (!_stop)
+    {
+        if (!waitForSocket(connection, server_poll_interval))
+        {
+            continue;
+        }
+        // a started frame is small and sent at once, so it is received completely within the handshake timeout
+        const auto deadline = steady_clock::now() + server_handshake_timeout;
+        if (!receiveAll(connection, frame, request_header_size, deadline))
+        {
+            return;
+        }
+        const auto event_count = frame[4];
+        if (event_count > clock_sync_channel::max_events_per_frame
+            || !receiveAll(connection, frame + request_header_size, event_count * event_size, deadline))
+        {
+            return;
+        }
+
+        Timestamp time{ 0 };
+        const uint8_t* event_buffer = frame + request_header_size;
+        for (uint8_t index = 0; index < event_count; ++index, event_buffer += event_size)
+        {
+            if (!isValidEventID(event_buffer[0]))
+            {
+                return;
+            }
+            try
+            {
+                time = _event_handler(static_cast<IRPCClockSyncMasterDef::EventID>(event_buffer[0]),
+                    Timestamp{ readInt64(event_buffer + 1) },
+                    Timestamp{ readInt64(event_buffer + 9) });
+            }
+            catch (const std::exception&)
+            {
+                // closing the connection lets the master handle it like a failed rpc call
+                return;
+            }
+        }
+
+        std::memcpy(reply, frame, 4);
+        writeInt64(reply + 4, time.count());
+        if (!sendAll(connection, reply, reply_size))
+        {
+            return;
+        }
+    }
+}
+
+std::string createClockSyncChannelAddress(const std::string& server_url, uint16_t port)
+{
+    if (server_url.empty() || port == 0)
+    {
+        return {};
+    }
+
+    // the url has the form scheme://host:port
+    auto host_begin = server_url.find("://");
+    host_begin = (host_begin == std::string::npos) ? 0 : host_begin + 3;
+    const auto host_end = server_url.find_first_of(":/", host_begin);
+    auto host = server_url.substr(host_begin,
+        host_end == std::string::npos ? std::string::npos : host_end - host_begin);
+
+    if (host.empty() || host == "0.0.0.0")
+    {
+        initializeSockets();
+        char host_name[256] = { 0 };
+        if (gethostname(host_name, sizeof(host_name) - 1) != 0)
+        {
+            return {};
+        }
+        host = host_name;
+    }
+
+    return host + ":" + std::to_string(port);
+}
+
+} // namespace rpc
+} // namespace fep3
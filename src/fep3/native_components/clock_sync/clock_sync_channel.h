@@ -0,0 +1,183 @@
+/**
+* @file
+* Copyright &copy; Audi AG. All rights reserved.
+*
+* This Source Code Form is subject to the terms of the
+* Mozilla Public License, v. 2.0.
+* If a copy of the MPL was not distributed with this
+* file, You can obtain one at https://mozilla.org/MPL/2.0/.
+*
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fep3/fep3_duration.h>
+#include <fep3/fep3_errors.h>
+#include <fep3/base/thread/thread_configuration.h>
+#include <fep3/rpc_services/clock_sync/clock_sync_service_rpc_intf_def.h>
+
+namespace fep3
+{
+namespace rpc
+{
+
+/**
+ * Binary clock sync channel between a clock sync master and one of its slaves.
+ *
+ * The slave listens for the master (@ref ClockSyncChannelServer) and announces the address
+ * via the master rpc service (registerSyncChannel). The master connects (@ref ClockSyncChannelClient)
+ * and sends all time events of one time step in one frame, the slave processes them in order and acknowledges
+ * the whole frame with one reply. If the channel can not be established the rpc path is used.
+ *
+ * Frame layout (little endian):
+ * @li handshake (both directions): uint32 magic, uint8 version
+ * @li request: uint32 sequence, uint8 event count, event count * (uint8 event id, int64 new time, int64 old time)
+ * @li reply: uint32 sequence, int64 time of the slave after processing the events
+ */
+namespace clock_sync_channel
+{
+/// handshake magic ("FCSC")
+constexpr uint32_t magic = 0x43534346;
+/// protocol version
+constexpr uint8_t version = 1;
+/// maximum number of events within one frame (before, updating, after, reset)
+constexpr uint8_t max_events_per_frame = 4;
+} // namespace clock_sync_channel
+
+/**
+ * Thrown by the @ref ClockSyncChannelClient if the slave does not acknowledge a frame in time
+ * or the connection broke.
+ */
+class ClockSyncChannelError : public std::runtime_error
+{
+public:
+    using std::runtime_error::runtime_error;
+};
+
+/**
+ * One time event transmitted via the clock sync channel.
+ */
+struct ClockSyncChannelEvent
+{
+    IRPCClockSyncMasterDef::EventID _event_id;
+    Timestamp _new_time;
+    Timestamp _old_time;
+};
+
+/**
+ * Master side of the clock sync channel.
+ * Not thread-safe, the clock master uses one instance per slave from the slave's executor only.
+ */
+class ClockSyncChannelClient
+{
+public:
+    ClockSyncChannelClient() = default;
+    ~ClockSyncChannelClient();
+    ClockSyncChannelClient(const ClockSyncChannelClient&) = delete;
+    ClockSyncChannelClient(ClockSyncChannelClient&&) = delete;
+    ClockSyncChannelClient& operator=(const ClockSyncChannelClient&) = delete;
+    ClockSyncChannelClient& operator=(ClockSyncChannelClient&&) = delete;
+
+    /**
+     * Connects to the slave listening at @p address and performs the handshake.
+     *
+     * @param address the address of the slave in the form "host:port"
+     * @param timeout the timeout for connecting and the handshake together, the call does not block longer
+     * @return ERR_NOERROR if the channel can be used, an error otherwise
+     */
+    fep3::Result connect(const std::string& address, std::chrono::nanoseconds timeout);
+
+    /**
+     * Queues an event to be sent with the next @ref sendEvents call.
+     */
+    void queueEvent(IRPCClockSyncMasterDef::EventID event_id, Timestamp new_time, Timestamp old_time);
+
+    /**
+     * Sends all queued events in one frame and waits for the acknowledgement of the slave.
+     *
+     * @param timeout the maximum time to wait for the acknowledgement
+     * @return the time of the slave after processing the events
+     * @throw ClockSyncChannelError if the acknowledgement is not received in time or the connection broke
+     */
+    Timestamp sendEvents(std::chrono::nanoseconds timeout);
+
+private:
+    void disconnect();
+
+private:
+    intptr_t _socket{ -1 };
+    uint32_t _sequence{ 0 };
+    std::vector<ClockSyncChannelEvent> _queued_events;
+};
+
+/**
+ * Slave side of the clock sync channel.
+ * Listens on a free port and serves one connected master at a time in its own thread.
+ */
+class ClockSyncChannelServer
+{
+public:
+    /**
+     * Handler processing one received event, returns the time of the slave.
+     */
+    using EventHandler = std::function<Timestamp(IRPCClockSyncMasterDef::EventID event_id,
+        Timestamp new_time,
+        Timestamp old_time)>;
+
+    explicit ClockSyncChannelServer(EventHandler event_handler);
+    ~ClockSyncChannelServer();
+    ClockSyncChannelServer(const ClockSyncChannelServer&) = delete;
+    ClockSyncChannelServer(ClockSyncChannelServer&&) = delete;
+    ClockSyncChannelServer& operator=(const ClockSyncChannelServer&) = delete;
+    ClockSyncChannelServer& operator=(ClockSyncChannelServer&&) = delete;
+
+    /**
+     * Starts listening on a free port of all interfaces.
+     *
+     * @param thread_configuration cpu affinity and scheduling of the thread serving the master
+     * @return ERR_NOERROR if listening, an error otherwise (also if the thread could not be configured)
+     */
+    fep3::Result open(const ThreadConfiguration& thread_configuration = {});
+    /**
+     * Stops listening and closes the connection to the master.
+     */
+    void close();
+
+    /**
+     * @return the port the server listens on, 0 if not open
+     */
+    uint16_t getPort() const;
+
+private:
+    void serve();
+    void serveConnection(intptr_t connection);
+
+private:
+    EventHandler _event_handler;
+    intptr_t _listen_socket{ -1 };
+    uint16_t _port{ 0 };
+    std::atomic<bool> _stop{ true };
+    std::thread _thread;
+};
+
+/**
+ * Creates the address a master uses to connect to a channel server of this host.
+ * The host is taken from the @p server_url of the local rpc server, a wildcard host is replaced by the host name.
+ *
+ * @param server_url the url of the local participant server, e.g. "http://host:9090"
+ * @param port the port of the channel server
+ * @return the address in the form "host:port", empty if the @p server_url is empty or the host can not be determined
+ */
+std::string createClockSyncChannelAddress(const std::string& server_url, uint16_t port);
+
+} // namespace rpc
+} // namespace fep3
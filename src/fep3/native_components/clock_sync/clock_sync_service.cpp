@@ -18,8 +18,10 @@
 #include <a_util/result/result_type.h>
 #include <a_util/result/error_def.h>
 
+#include <fep3/base/thread/thread.h>
 #include <fep3/components/scheduler/scheduler_service_intf.h>
 #include <fep3/native_components/clock_sync/master_on_demand_clock_client.h>
+#include <fep3/native_components/clock_sync/shared_clock_client.h>
 #include "fep3/components/service_bus/service_bus_intf.h"
 
 #include <a_util/strings.h> 
@@ -38,6 +40,9 @@ fep3::Result ClockSyncServiceConfiguration::registerPropertyVariables()
 {
     FEP3_RETURN_IF_FAILED(registerPropertyVariable(_timing_master_name, FEP3_TIMING_MASTER_PROPERTY));
     FEP3_RETURN_IF_FAILED(registerPropertyVariable(_slave_sync_cycle_time, FEP3_SLAVE_SYNC_CYCLE_TIME_PROPERTY));
+    FEP3_RETURN_IF_FAILED(registerPropertyVariable(_interpolation, FEP3_SLAVE_INTERPOLATION_PROPERTY));
+    FEP3_RETURN_IF_FAILED(registerPropertyVariable(_interpolation_window_size, FEP3_SLAVE_INTERPOLATION_WINDOW_SIZE_PROPERTY));
+    FEP3_RETURN_IF_FAILED(registerPropertyVariable(_thread_configuration, FEP3_CLOCKSYNC_THREAD_CONFIGURATION_PROPERTY));
 
     return {};
 }
@@ -46,6 +51,9 @@ fep3::Result ClockSyncServiceConfiguration::unregisterPropertyVariables()
 {
     FEP3_RETURN_IF_FAILED(unregisterPropertyVariable(_timing_master_name, FEP3_TIMING_MASTER_PROPERTY));
     FEP3_RETURN_IF_FAILED(unregisterPropertyVariable(_slave_sync_cycle_time, FEP3_SLAVE_SYNC_CYCLE_TIME_PROPERTY));
+    FEP3_RETURN_IF_FAILED(unregisterPropertyVariable(_interpolation, FEP3_SLAVE_INTERPOLATION_PROPERTY));
+    FEP3_RETURN_IF_FAILED(unregisterPropertyVariable(_interpolation_window_size, FEP3_SLAVE_INTERPOLATION_WINDOW_SIZE_PROPERTY));
+    FEP3_RETURN_IF_FAILED(unregisterPropertyVariable(_thread_configuration, FEP3_CLOCKSYNC_THREAD_CONFIGURATION_PROPERTY));
     return {};
 }
 
@@ -53,10 +61,12 @@ std::pair<bool, fep3::Result>  ClockSyncServiceConfiguration::validateConfigurat
     const std::string& main_clock_name,
     const ILoggingService::ILogger& logger) const
 {
-    //clock synchronization requires one of the master on demand clocks to be configured
+    //clock synchronization requires one of the master on demand or shared clocks to be configured
     //on the timing slave side
     if (main_clock_name == FEP3_CLOCK_SLAVE_MASTER_ONDEMAND
-        || main_clock_name == FEP3_CLOCK_SLAVE_MASTER_ONDEMAND_DISCRETE)
+        || main_clock_name == FEP3_CLOCK_SLAVE_MASTER_ONDEMAND_DISCRETE
+        || main_clock_name == FEP3_CLOCK_SLAVE_SHARED_CLOCK
+        || main_clock_name == FEP3_CLOCK_SLAVE_SHARED_CLOCK_DISCRETE)
     {
 
         if (static_cast<std::string>(_timing_master_name).empty())
@@ -89,6 +99,41 @@ std::pair<bool, fep3::Result>  ClockSyncServiceConfiguration::validateConfigurat
             return { true, result };
         }
 
+        const std::string interpolation = _interpolation;
+        if (interpolation != FEP3_SLAVE_INTERPOLATION_CRISTIAN
+            && interpolation != FEP3_SLAVE_INTERPOLATION_DRIFT_COMPENSATION)
+        {
+            auto result = CREATE_ERROR_DESCRIPTION(ERR_INVALID_ARG,
+                a_util::strings::format(
+                    "Invalid interpolation '%s'. Interpolation has to be '%s' or '%s'.",
+                    interpolation.c_str(),
+                    FEP3_SLAVE_INTERPOLATION_CRISTIAN,
+                    FEP3_SLAVE_INTERPOLATION_DRIFT_COMPENSATION)
+                .c_str());
+
+            if (logger.isErrorEnabled())
+            {
+                result |= logger.logError(std::string(result.getDescription()));
+            }
+            return { true, result };
+        }
+
+        if (interpolation == FEP3_SLAVE_INTERPOLATION_DRIFT_COMPENSATION
+            && 2 > static_cast<int32_t>(_interpolation_window_size))
+        {
+            auto result = CREATE_ERROR_DESCRIPTION(ERR_INVALID_ARG,
+                a_util::strings::format(
+                    "Invalid interpolation window size of %d. Interpolation window size has to be >= 2.",
+                    static_cast<int32_t>(_interpolation_window_size))
+                .c_str());
+
+            if (logger.isErrorEnabled())
+            {
+                result |= logger.logError(std::string(result.getDescription()));
+            }
+            return { true, result };
+        }
+
         return { true, {} };
     }
     else
@@ -259,6 +304,16 @@ fep3::Result ClockSynchronizationService::setupSlaveClock(
     {
         RETURN_ERROR_DESCRIPTION(ERR_NOT_FOUND, "RPC Requester not found");
     }
+    ThreadConfiguration thread_configuration;
+    const std::string thread_configuration_string = _configuration._thread_configuration;
+    const auto thread_configuration_result = thread::parseConfiguration(thread_configuration_string, thread_configuration);
+    if (isFailed(thread_configuration_result))
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_INVALID_ARG, "Invalid value '%s' of property '%s': %s",
+            thread_configuration_string.c_str(),
+            FEP3_CLOCKSYNC_SERVICE_CONFIG_THREAD_CONFIGURATION,
+            thread_configuration_result.getDescription());
+    }
 
     if (FEP3_CLOCK_SLAVE_MASTER_ONDEMAND == main_clock_name)
     {
@@ -267,8 +322,9 @@ fep3::Result ClockSynchronizationService::setupSlaveClock(
             rpc_server,
             rpc_requester,
             _logger,
-            std::make_unique<fep3::InterpolationTime>(),
+            createInterpolationTime(),
             rpc_server->getName());
+        clock_synchronizer->setThreadConfiguration(thread_configuration);
         _slave_clock.first = clock_synchronizer;
         _slave_clock.second = clock_synchronizer.get();
     }
@@ -281,9 +337,31 @@ fep3::Result ClockSynchronizationService::setupSlaveClock(
             false,
             _logger,
             rpc_server->getName());
+        clock_synchronizer->setThreadConfiguration(thread_configuration);
         _slave_clock.first = clock_synchronizer;
         _slave_clock.second = clock_synchronizer.get();
     }
+    else if (FEP3_CLOCK_SLAVE_SHARED_CLOCK == main_clock_name)
+    {
+        // the shared clocks do not use rpc, they read the segment published by the timing master
+        _slave_clock.first = std::make_shared<rpc::arya::SharedClockInterpolating>(
+            rpc::getSystemName(*rpc_server),
+            _configuration._timing_master_name,
+            Duration{ std::chrono::milliseconds{_configuration._slave_sync_cycle_time} },
+            _logger);
+        _slave_clock.second = nullptr;
+    }
+    else if (FEP3_CLOCK_SLAVE_SHARED_CLOCK_DISCRETE == main_clock_name)
+    {
+        const auto shared_clock = std::make_shared<rpc::arya::SharedClockDiscrete>(
+            rpc::getSystemName(*rpc_server),
+            _configuration._timing_master_name,
+            Duration{ std::chrono::milliseconds{_configuration._slave_sync_cycle_time} },
+            _logger);
+        shared_clock->setThreadConfiguration(thread_configuration);
+        _slave_clock.first = shared_clock;
+        _slave_clock.second = nullptr;
+    }
     if (_slave_clock.first)
     {
         FEP3_RETURN_IF_FAILED(clock_service->registerClock(_slave_clock.first));
@@ -292,6 +370,16 @@ fep3::Result ClockSynchronizationService::setupSlaveClock(
     return {};
 }
 
+std::unique_ptr<IInterpolationTime> ClockSynchronizationService::createInterpolationTime() const
+{
+    if (FEP3_SLAVE_INTERPOLATION_DRIFT_COMPENSATION == static_cast<std::string>(_configuration._interpolation))
+    {
+        return std::make_unique<DriftCompensatingInterpolationTime>(
+            static_cast<size_t>(static_cast<int32_t>(_configuration._interpolation_window_size)));
+    }
+    return std::make_unique<InterpolationTime>();
+}
+
 fep3::Result ClockSynchronizationService::logError(const fep3::Result& error) const
 {
     if (_logger && _logger->isErrorEnabled())
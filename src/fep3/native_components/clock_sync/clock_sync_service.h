@@ -42,6 +42,9 @@ struct ClockSyncServiceConfiguration : public Configuration
 
     PropertyVariable<std::string> _timing_master_name{ "" };
     PropertyVariable<int32_t>     _slave_sync_cycle_time{ FEP3_SLAVE_SYNC_CYCLE_TIME_DEFAULT_VALUE };
+    PropertyVariable<std::string> _interpolation{ FEP3_SLAVE_INTERPOLATION_DEFAULT_VALUE };
+    PropertyVariable<int32_t>     _interpolation_window_size{ FEP3_SLAVE_INTERPOLATION_WINDOW_SIZE_DEFAULT_VALUE };
+    PropertyVariable<std::string> _thread_configuration{ "" };
 };
 
 /**
@@ -76,6 +79,7 @@ private:
     fep3::Result setupSlaveClock(
         const IComponents& components,
         const std::string& main_clock_name);
+    std::unique_ptr<IInterpolationTime> createInterpolationTime() const;
 
     fep3::Result logError(const fep3::Result& error) const;
     fep3::Result logError(const std::string& message) const;
@@ -11,11 +11,30 @@
 
 #include "interpolation_time.h"
 
+#include <algorithm>
+#include <vector>
+
 #include <a_util/system/system.h>
 
 namespace fep3
 {
 
+namespace
+{
+// number of roundtrip times necessary to detect outliers
+constexpr size_t min_roundtrip_times_for_outlier_detection = 3;
+// a roundtrip time exceeding the median by more than the median (at least by this tolerance) is an outlier
+constexpr Duration min_outlier_tolerance = std::chrono::microseconds(100);
+// minimal time span of the window to estimate the rate, a shorter span only provides jitter
+constexpr Duration min_rate_estimation_span = std::chrono::milliseconds(1);
+
+Duration getLocalTime()
+{
+    return std::chrono::steady_clock::now().time_since_epoch();
+}
+
+} // namespace
+
 InterpolationTime::InterpolationTime() 
     : _last_interpolated_time(0)
     , _offset(0)
@@ -69,4 +88,137 @@ void InterpolationTime::resetTime(const Timestamp time)
     _last_interpolated_time = time;
 }
 
+DriftCompensatingInterpolationTime::DriftCompensatingInterpolationTime(const size_t window_size)
+    : _window_size(std::max<size_t>(window_size, 2))
+    , _local_time_reference(0)
+    , _master_time_reference(0)
+    , _rate(1.0)
+    , _last_interpolated_time(0)
+    , _last_raw_time(0)
+{
+}
+
+Timestamp DriftCompensatingInterpolationTime::getTime() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (_master_time_reference.count() > 0)
+    {
+        const auto elapsed = static_cast<double>((getLocalTime() - _local_time_reference).count());
+        const auto time = _master_time_reference + Duration(static_cast<int64_t>(_rate * elapsed));
+        if (_last_interpolated_time < time)
+        {
+            _last_interpolated_time = time;
+        }
+        return _last_interpolated_time;
+    }
+    else
+    {
+        return _master_time_reference; //not yet received a time!!
+    }
+}
+
+void DriftCompensatingInterpolationTime::setTime(const Timestamp time, const Duration roundtrip_time)
+{
+    const auto local_time = getLocalTime();
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    //autodetection of a reset
+    if (time < _last_raw_time)
+    {
+        resetSamples(time, local_time);
+    }
+    _last_raw_time = time;
+
+    if (isOutlier(roundtrip_time))
+    {
+        return;
+    }
+
+    _samples.push_back({ local_time, time + roundtrip_time / 2 });
+    if (_samples.size() > _window_size)
+    {
+        _samples.pop_front();
+    }
+    estimate();
+}
+
+void DriftCompensatingInterpolationTime::resetTime(const Timestamp time)
+{
+    const auto local_time = getLocalTime();
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _last_raw_time = time;
+    resetSamples(time, local_time);
+}
+
+void DriftCompensatingInterpolationTime::resetSamples(const Timestamp time, const Duration local_time)
+{
+    // the rate of the master clock does not change by a reset, only the samples are invalid
+    _samples.clear();
+    _samples.push_back({ local_time, time });
+    _local_time_reference = local_time;
+    _master_time_reference = time;
+    _last_interpolated_time = time;
+}
+
+bool DriftCompensatingInterpolationTime::isOutlier(const Duration roundtrip_time)
+{
+    // the median is taken from all roundtrip times, so a permanently increased roundtrip time
+    // is not discarded anymore after half of the window
+    _roundtrip_times.push_back(roundtrip_time);
+    if (_roundtrip_times.size() > _window_size)
+    {
+        _roundtrip_times.pop_front();
+    }
+    if (_roundtrip_times.size() < min_roundtrip_times_for_outlier_detection)
+    {
+        return false;
+    }
+
+    std::vector<Duration> roundtrip_times(_roundtrip_times.begin(), _roundtrip_times.end());
+    const auto median = roundtrip_times.begin() + roundtrip_times.size() / 2;
+    std::nth_element(roundtrip_times.begin(), median, roundtrip_times.end());
+
+    return roundtrip_time > *median + std::max(*median, min_outlier_tolerance);
+}
+
+void DriftCompensatingInterpolationTime::estimate()
+{
+    const auto& last_sample = _samples.back();
+    if (_samples.size() < 2
+        || last_sample._local_time - _samples.front()._local_time < min_rate_estimation_span)
+    {
+        _local_time_reference = last_sample._local_time;
+        _master_time_reference = last_sample._master_time;
+        return;
+    }
+
+    // least squares fit of the master times over the local times,
+    // the values are taken relative to the last sample to keep the precision of double
+    double sum_local = 0.0, sum_master = 0.0;
+    for (const auto& sample : _samples)
+    {
+        sum_local += static_cast<double>((sample._local_time - last_sample._local_time).count());
+        sum_master += static_cast<double>((sample._master_time - last_sample._master_time).count());
+    }
+    const auto count = static_cast<double>(_samples.size());
+    const auto mean_local = sum_local / count;
+    const auto mean_master = sum_master / count;
+
+    double covariance = 0.0, variance = 0.0;
+    for (const auto& sample : _samples)
+    {
+        const auto local = static_cast<double>((sample._local_time - last_sample._local_time).count()) - mean_local;
+        const auto master = static_cast<double>((sample._master_time - last_sample._master_time).count()) - mean_master;
+        covariance += local * master;
+        variance += local * local;
+    }
+
+    // a master clock does not run backwards, a negative rate is noise of a stopped master
+    _rate = std::max(covariance / variance, 0.0);
+    _local_time_reference = last_sample._local_time + Duration(static_cast<int64_t>(mean_local));
+    _master_time_reference = last_sample._master_time + Duration(static_cast<int64_t>(mean_master));
+}
+
 } // namespace fep3
@@ -11,6 +11,10 @@
 
 #pragma once
 
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
 #include <fep3/fep3_timestamp.h>
 #include <fep3/fep3_duration.h>
 
@@ -87,4 +91,69 @@ private:
     Timestamp _last_raw_time;
 };
 
+/**
+ * This class extrapolates a timestamp relative to reference times like @ref InterpolationTime does,
+ * but additionally estimates the rate of the master clock relative to the local steady clock.
+ * The reference times (extrapolated to the moment of reception by Cristian's Algorithm) of a sliding window
+ * are fitted by a linear regression, so drifting clocks and master clocks with a time factor are followed
+ * without requesting the master time frequently.
+ * Reference times received with a roundtrip time far above the median roundtrip time are discarded,
+ * because their delay is asymmetric most likely.
+ **/
+class DriftCompensatingInterpolationTime : public IInterpolationTime
+{
+public:
+    /**
+     * CTOR
+     * @param [in] window_size  number of reference times the rate and offset are estimated from, at least 2
+     */
+    explicit DriftCompensatingInterpolationTime(size_t window_size);
+
+    /**
+    *\copydoc IInterpolationTime::getTime
+    **/
+    Timestamp getTime() const override;
+
+    /**
+    *\copydoc IInterpolationTime::setTime
+    **/
+    void setTime(Timestamp time, Duration roundtrip_time) override;
+
+    /**
+    *\copydoc IInterpolationTime::resetTime
+    **/
+    void resetTime(Timestamp time) override;
+
+private:
+    struct Sample
+    {
+        // local steady clock time of the reception
+        Duration _local_time;
+        // reference time extrapolated to the moment of reception
+        Timestamp _master_time;
+    };
+
+    bool isOutlier(Duration roundtrip_time);
+    void estimate();
+    void resetSamples(Timestamp time, Duration local_time);
+
+private:
+    const size_t _window_size;
+
+    mutable std::mutex _mutex;
+    std::deque<Sample> _samples;
+    // roundtrip times of all received reference times, including the discarded ones
+    std::deque<Duration> _roundtrip_times;
+
+    // the estimation: master time = _master_time_reference + _rate * (local time - _local_time_reference)
+    Duration _local_time_reference;
+    Timestamp _master_time_reference;
+    double _rate;
+
+    // Stores the last value calculated by \c getTime
+    mutable Timestamp _last_interpolated_time;
+    // Stores the raw time value of the reference time
+    Timestamp _last_raw_time;
+};
+
 } // namespace fep3
\ No newline at end of file
@@ -17,6 +17,7 @@
 #include <a_util/strings/strings_convert_decl.h>
 #include <a_util/strings/strings_format.h>
 
+#include <fep3/base/thread/thread.h>
 #include <fep3/native_components/clock_sync/clock_sync_service.h>
 
 using namespace std::chrono;
@@ -87,6 +88,11 @@ void FarClockUpdater::stopRPC()
     unregisterFromRPC();
 }
 
+void FarClockUpdater::setThreadConfiguration(const ThreadConfiguration& thread_configuration)
+{
+    _thread_configuration = thread_configuration;
+}
+
 void FarClockUpdater::registerToRPC()
 {
     _participant_server->registerService(IRPCClockSyncSlaveDef::getRPCDefaultName(), shared_from_this());
@@ -108,6 +114,11 @@ void FarClockUpdater::startWorking()
         _started = true;
         _next_request_gettime = time_point<steady_clock>{ Timestamp{ 0 } };
         _worker = std::thread([this] { work();  });
+        const auto result = fep3::thread::configure(_worker, "__clock_sync", _thread_configuration);
+        if (isFailed(result))
+        {
+            _logger->logWarning(a_util::strings::format("Configuring the clock sync thread failed: %s", result.getDescription()));
+        }
     }
 }
 
@@ -153,9 +164,58 @@ void FarClockUpdater::registerToMaster()
     {
         _master_type = -1;
         _logger->logWarning(exception.what());
+        return;
+    }
+
+    // time events are only sent by discrete masters
+    if (_master_type == static_cast<int>(IClock::ClockType::discrete))
+    {
+        registerSyncChannel();
     }
 }
 
+void FarClockUpdater::registerSyncChannel()
+{
+    const auto server_url = _participant_server->getUrl();
+    if (server_url.empty())
+    {
+        return;
+    }
+
+    if (!_sync_channel)
+    {
+        _sync_channel = std::make_unique<ClockSyncChannelServer>(
+            [this](IRPCClockSyncMasterDef::EventID event_id, Timestamp new_time, Timestamp old_time)
+            {
+                return masterTimeEvent(event_id, new_time, old_time);
+            });
+    }
+
+    const auto open_result = _sync_channel->open(_thread_configuration);
+    if (fep3::isOk(open_result))
+    {
+        const auto channel_address = createClockSyncChannelAddress(server_url, _sync_channel->getPort());
+        try
+        {
+            if (!channel_address.empty()
+                && 0 == _far_clock_master.registerSyncChannel(channel_address, _local_participant_name))
+            {
+                return;
+            }
+        }
+        catch (const std::exception&)
+        {
+            // masters not supporting the sync channel keep on calling syncTimeEvent
+        }
+    }
+    else
+    {
+        _logger->logWarning(a_util::strings::format("Opening the clock sync channel failed, the master calls syncTimeEvent instead: %s",
+            open_result.getDescription()));
+    }
+    _sync_channel->close();
+}
+
 void FarClockUpdater::unregisterFromMaster()
 {
     try
@@ -166,6 +226,11 @@ void FarClockUpdater::unregisterFromMaster()
     {
         _logger->logWarning(exception.what());
     }
+
+    if (_sync_channel)
+    {
+        _sync_channel->close();
+    }
 }
 
 std::string FarClockUpdater::syncTimeEvent(int event_id,
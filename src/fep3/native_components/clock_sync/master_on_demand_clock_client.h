@@ -26,6 +26,8 @@
 #include <fep3/components/service_bus/rpc/fep_rpc_stubs_service.h>
 #include <fep3/components/logging/logging_service_intf.h>
 #include <fep3/components/service_bus/service_bus_intf.h>
+#include <fep3/base/thread/thread_configuration.h>
+#include "clock_sync_channel.h"
 #include "interpolation_time.h"
 
 namespace fep3
@@ -54,6 +56,11 @@ protected:
 public:
     void startRPC();
     void stopRPC();
+    /**
+     * Sets the cpu affinity and scheduling of the threads requesting and receiving the time of the master,
+     * used when they are started next. Failing to configure them is logged as warning.
+     */
+    void setThreadConfiguration(const ThreadConfiguration& thread_configuration);
 
 protected:
     virtual void updateTime(Timestamp new_time, Duration round_trip_time) = 0;
@@ -71,6 +78,7 @@ protected:
    
     void registerToMaster();
     void unregisterFromMaster();
+    void registerSyncChannel();
 
 protected:
     std::mutex _update_mutex;
@@ -92,10 +100,13 @@ private:
     std::atomic_bool _stop;
     std::atomic_bool _started;
     int _master_type;   
+    ThreadConfiguration _thread_configuration;
 
     Duration _on_demand_step_size;
     std::chrono::time_point<std::chrono::steady_clock> _next_request_gettime;
     std::shared_ptr<IServiceBus::IParticipantServer> _participant_server;    
+    // binary channel the master uses instead of syncTimeEvent calls, if supported by the master
+    std::unique_ptr<ClockSyncChannelServer> _sync_channel;
 
     const std::shared_ptr<const ILoggingService::ILogger> _logger;
     std::string _local_participant_name;
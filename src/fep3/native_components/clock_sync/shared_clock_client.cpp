@@ -0,0 +1,275 @@
+/**
+* @file
+* Copyright &copy; Audi AG. All rights reserved.
+*
+* This Source Code Form is subject to the terms of the
+* Mozilla Public License, v. 2.0.
+* If a copy of the MPL was not distributed with this
+* file, You can obtain one at https://mozilla.org/MPL/2.0/.
+*
+*/
+
+#include "shared_clock_client.h"
+
+#include <a_util/strings/strings_format.h>
+
+#include <fep3/base/thread/thread.h>
+#include <fep3/native_components/clock_sync/clock_sync_service.h>
+
+using namespace std::chrono;
+
+namespace fep3
+{
+namespace rpc
+{
+namespace arya
+{
+
+namespace
+{
+
+Timestamp getCurrentTime(const SharedClockSegment::State& state)
+{
+    if (state._running && state._clock_type == IClock::ClockType::continuous)
+    {
+        return state._new_time
+            + (duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()) - state._published_at);
+    }
+    return state._new_time;
+}
+
+} // namespace
+
+SharedClockInterpolating::SharedClockInterpolating(
+    const std::string& system_name,
+    const std::string& master_name,
+    const Duration open_retry_period,
+    const std::shared_ptr<const ILoggingService::ILogger>& logger)
+    : ContinuousClock(FEP3_CLOCK_SLAVE_SHARED_CLOCK)
+    , _system_name(system_name)
+    , _master_name(master_name)
+    , _open_retry_period(open_retry_period)
+    , _logger(logger)
+{
+}
+
+void SharedClockInterpolating::start(const std::weak_ptr<IEventSink>& event_sink)
+{
+    {
+        std::lock_guard<std::mutex> lock(_segment_mutex);
+        _next_segment_check = steady_clock::time_point{};
+    }
+    ContinuousClock::start(event_sink);
+}
+
+void SharedClockInterpolating::stop()
+{
+    ContinuousClock::stop();
+
+    std::lock_guard<std::mutex> lock(_segment_mutex);
+    _segment.close();
+}
+
+void SharedClockInterpolating::openSegmentIfNecessary() const
+{
+    // the segment is checked for a vanished master periodically, a closed segment is recognized immediately
+    const auto now = steady_clock::now();
+    if (now < _next_segment_check && !_segment.isClosed())
+    {
+        return;
+    }
+    _next_segment_check = now + _open_retry_period;
+    if (_segment.isMasterAlive())
+    {
+        return;
+    }
+
+    const auto result = _segment.open(_system_name, _master_name);
+    if (isFailed(result) && _logger && _logger->isDebugEnabled())
+    {
+        _logger->logDebug(a_util::strings::format("Shared clock of timing master '%s' is not available: %s",
+            _master_name.c_str(), result.getDescription()));
+    }
+}
+
+Timestamp SharedClockInterpolating::getNewTime() const
+{
+    std::lock_guard<std::mutex> lock(_segment_mutex);
+    openSegmentIfNecessary();
+    if (!_segment.isOpen())
+    {
+        return _last_time;
+    }
+
+    const auto state = _segment.read();
+    auto time = getCurrentTime(state);
+    // a newly published time must not let the clock jump back, only a time event of the master may do so
+    if (state._event_sequence == _last_event_sequence && time < _last_time)
+    {
+        time = _last_time;
+    }
+    _last_event_sequence = state._event_sequence;
+    _last_time = time;
+
+    return time;
+}
+
+Timestamp SharedClockInterpolating::resetTime()
+{
+    return getNewTime();
+}
+
+SharedClockDiscrete::SharedClockDiscrete(
+    const std::string& system_name,
+    const std::string& master_name,
+    const Duration sync_cycle_time,
+    const std::shared_ptr<const ILoggingService::ILogger>& logger)
+    : DiscreteClock(FEP3_CLOCK_SLAVE_SHARED_CLOCK_DISCRETE)
+    , _system_name(system_name)
+    , _master_name(master_name)
+    , _sync_cycle_time(sync_cycle_time)
+    , _logger(logger)
+{
+}
+
+SharedClockDiscrete::~SharedClockDiscrete()
+{
+    stopWorking();
+}
+
+void SharedClockDiscrete::start(const std::weak_ptr<IEventSink>& event_sink)
+{
+    stopWorking();
+    DiscreteClock::start(event_sink);
+
+    _stop = false;
+    _worker = std::thread([this] { work(); });
+    const auto result = fep3::thread::configure(_worker, "__clock_sync", _thread_configuration);
+    if (isFailed(result))
+    {
+        logWarning(a_util::strings::format("Configuring the clock sync thread failed: %s", result.getDescription()));
+    }
+}
+
+void SharedClockDiscrete::setThreadConfiguration(const ThreadConfiguration& thread_configuration)
+{
+    _thread_configuration = thread_configuration;
+}
+
+void SharedClockDiscrete::stop()
+{
+    stopWorking();
+    DiscreteClock::stop();
+}
+
+void SharedClockDiscrete::stopWorking()
+{
+    {
+        std::lock_guard<std::mutex> lock(_stop_mutex);
+        _stop = true;
+    }
+    _stop_condition.notify_all();
+
+    if (_worker.joinable())
+    {
+        _worker.join();
+    }
+}
+
+void SharedClockDiscrete::waitForRetry()
+{
+    std::unique_lock<std::mutex> lock(_stop_mutex);
+    _stop_condition.wait_for(lock, _sync_cycle_time, [this] { return _stop.load(); });
+}
+
+void SharedClockDiscrete::work()
+{
+    int slot = -1;
+    bool synchronized = false;
+    uint32_t last_event_sequence = 0;
+
+    while (!_stop)
+    {
+        if (!_segment.isOpen())
+        {
+            if (isFailed(_segment.open(_system_name, _master_name)))
+            {
+                waitForRetry();
+                continue;
+            }
+            slot = _segment.acquireSlot();
+            if (slot == -1)
+            {
+                logWarning(a_util::strings::format(
+                    "No free slot in the shared clock of timing master '%s', the master will not wait for this slave",
+                    _master_name.c_str()));
+            }
+            synchronized = false;
+        }
+
+        const auto state = _segment.read();
+        if (!synchronized || state._event_sequence != last_event_sequence)
+        {
+            // the current time of the master is taken right after opening the segment
+            if (state._event_sequence != 0)
+            {
+                processEvent(state);
+            }
+            synchronized = true;
+            last_event_sequence = state._event_sequence;
+
+            if (slot != -1 && !_segment.acknowledge(slot, last_event_sequence))
+            {
+                logWarning(a_util::strings::format(
+                    "Timing master '%s' stopped waiting for this slave, probably because of a timeout",
+                    _master_name.c_str()));
+                slot = _segment.acquireSlot();
+            }
+        }
+
+        const auto event_received = _segment.waitForEvent(last_event_sequence, _sync_cycle_time);
+        if (_segment.isClosed() || (!event_received && !_segment.isMasterAlive()))
+        {
+            _segment.releaseSlot(slot);
+            _segment.close();
+            slot = -1;
+            continue;
+        }
+
+        if (!event_received)
+        {
+            const auto current_state = _segment.read();
+            if (current_state._running && current_state._clock_type == IClock::ClockType::continuous)
+            {
+                DiscreteClock::setNewTime(getCurrentTime(current_state), false);
+            }
+        }
+    }
+
+    _segment.releaseSlot(slot);
+    _segment.close();
+}
+
+void SharedClockDiscrete::processEvent(const SharedClockSegment::State& state)
+{
+    if (state._event_id == IRPCClockSyncMasterDef::EventID::time_reset)
+    {
+        DiscreteClock::setResetTime(state._new_time);
+    }
+    else
+    {
+        DiscreteClock::setNewTime(state._new_time, false);
+    }
+}
+
+void SharedClockDiscrete::logWarning(const std::string& message) const
+{
+    if (_logger && _logger->isWarningEnabled())
+    {
+        _logger->logWarning(message);
+    }
+}
+
+} // namespace arya
+} // namespace rpc
+} // namespace fep3
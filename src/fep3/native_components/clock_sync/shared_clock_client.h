@@ -0,0 +1,124 @@
+/**
+* @file
+* Copyright &copy; Audi AG. All rights reserved.
+*
+* This Source Code Form is subject to the terms of the
+* Mozilla Public License, v. 2.0.
+* If a copy of the MPL was not distributed with this
+* file, You can obtain one at https://mozilla.org/MPL/2.0/.
+*
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <fep3/fep3_duration.h>
+#include <fep3/components/clock/clock_base.h>
+#include <fep3/components/logging/logging_service_intf.h>
+#include <fep3/base/thread/thread_configuration.h>
+#include "shared_clock_segment.h"
+
+namespace fep3
+{
+namespace rpc
+{
+namespace arya
+{
+
+/**
+ * Continuous slave clock reading the time of a timing master on the same host from its shared clock segment.
+ * The time published by the master is extrapolated by the steady clock, reading it does not need a system call.
+ * If the segment does not exist (yet) or the master closed it, opening it is retried every @p open_retry_period.
+ */
+class SharedClockInterpolating : public base::ContinuousClock
+{
+public:
+    SharedClockInterpolating(
+        const std::string& system_name,
+        const std::string& master_name,
+        Duration open_retry_period,
+        const std::shared_ptr<const ILoggingService::ILogger>& logger);
+
+    void start(const std::weak_ptr<IEventSink>& event_sink) override;
+    void stop() override;
+
+protected:
+    Timestamp getNewTime() const override;
+    Timestamp resetTime() override;
+
+private:
+    void openSegmentIfNecessary() const;
+
+private:
+    const std::string _system_name;
+    const std::string _master_name;
+    const Duration _open_retry_period;
+    const std::shared_ptr<const ILoggingService::ILogger> _logger;
+
+    mutable std::mutex _segment_mutex;
+    mutable SharedClockSegment _segment;
+    mutable std::chrono::steady_clock::time_point _next_segment_check;
+    mutable uint32_t _last_event_sequence{ 0 };
+    mutable Timestamp _last_time{ 0 };
+};
+
+/**
+ * Discrete slave clock following the time events of a timing master on the same host via its shared clock segment.
+ * A worker thread waits for the events of the master and acknowledges every processed event,
+ * so the master waits for this slave like it waits for the rpc based slaves.
+ * If the master is a continuous clock, its time is taken in discrete steps every @p sync_cycle_time.
+ */
+class SharedClockDiscrete : public base::DiscreteClock
+{
+public:
+    SharedClockDiscrete(
+        const std::string& system_name,
+        const std::string& master_name,
+        Duration sync_cycle_time,
+        const std::shared_ptr<const ILoggingService::ILogger>& logger);
+    ~SharedClockDiscrete();
+
+    void start(const std::weak_ptr<IEventSink>& event_sink) override;
+    void stop() override;
+
+    /**
+     * Sets the cpu affinity and scheduling of the worker thread, used on the next start.
+     * Failing to configure the thread is logged as warning.
+     */
+    void setThreadConfiguration(const ThreadConfiguration& thread_configuration);
+
+private:
+    void stopWorking();
+    void work();
+    void waitForRetry();
+    void processEvent(const SharedClockSegment::State& state);
+    void logWarning(const std::string& message) const;
+
+private:
+    const std::string _system_name;
+    const std::string _master_name;
+    const Duration _sync_cycle_time;
+    const std::shared_ptr<const ILoggingService::ILogger> _logger;
+
+    // only used by the worker thread
+    SharedClockSegment _segment;
+
+    std::thread _worker;
+    std::mutex _stop_mutex;
+    std::condition_variable _stop_condition;
+    std::atomic_bool _stop{ true };
+    ThreadConfiguration _thread_configuration;
+};
+
+} // namespace arya
+using arya::SharedClockDiscrete;
+using arya::SharedClockInterpolating;
+} // namespace rpc
+} // namespace fep3
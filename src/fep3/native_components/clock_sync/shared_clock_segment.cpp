@@ -0,0 +1,581 @@
+/**
+* @file
+* Copyright &copy; Audi AG. All rights reserved.
+*
+* This Source Code Form is subject to the terms of the
+* Mozilla Public License, v. 2.0.
+* If a copy of the MPL was not distributed with this
+* file, You can obtain one at https://mozilla.org/MPL/2.0/.
+*
+*/
+
+#include "shared_clock_segment.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <climits>
+#include <iterator>
+#include <cstring>
+#include <new>
+#include <thread>
+
+#include <a_util/result/error_def.h>
+#include <a_util/strings/strings_format.h>
+#include <fep3/components/service_bus/service_registry_base.hpp>
+
+#ifndef WIN32
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <signal.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+#ifdef __linux__
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <time.h>
+#endif
+
+using namespace std::chrono;
+
+namespace fep3
+{
+namespace rpc
+{
+
+static_assert(ATOMIC_INT_LOCK_FREE == 2 && ATOMIC_LLONG_LOCK_FREE == 2,
+    "the shared clock segment requires lock-free atomics to be used between processes");
+
+struct SharedClockSlot
+{
+    /// token of the slave using the slot, 0 if free
+    std::atomic<uint32_t> _owner;
+    std::atomic<uint32_t> _acknowledged_sequence;
+};
+
+struct SharedClockData
+{
+    /// stored last on creation, the segment must not be used before
+    std::atomic<uint32_t> _magic;
+    uint32_t _version;
+    std::atomic<int32_t> _master_process_id;
+    std::atomic<uint32_t> _closed;
+
+    /// odd while the master writes the published time
+    std::atomic<uint32_t> _seqlock;
+    std::atomic<uint32_t> _running;
+    std::atomic<int32_t> _clock_type;
+    std::atomic<uint32_t> _event_sequence;
+    std::atomic<int32_t> _event_id;
+    std::atomic<int64_t> _new_time;
+    std::atomic<int64_t> _old_time;
+    std::atomic<int64_t> _published_at;
+
+    /// incremented by every acknowledgement, the master waits on it
+    std::atomic<uint32_t> _acknowledgement_counter;
+    SharedClockSlot _slots[shared_clock::max_slaves];
+};
+
+namespace
+{
+
+constexpr uint32_t segment_magic = 0x4b4c4346; // "FCLK"
+constexpr uint32_t segment_version = 1;
+// used to wait if there is no futex
+constexpr microseconds poll_interval{ 100 };
+
+void appendEscaped(std::string& name, const std::string& part)
+{
+    for (const auto character : part)
+    {
+        const bool allowed = std::isalnum(static_cast<unsigned char>(character))
+            || character == '_' || character == '-' || character == '.';
+        name += allowed ? character : '_';
+    }
+}
+
+/// participants of different systems may use the same name, '@' is never part of an escaped name
+std::string getSegmentName(const std::string& system_name, const std::string& master_name)
+{
+    std::string name = "/fep3_clock_";
+    appendEscaped(name, system_name);
+    name += '@';
+    appendEscaped(name, master_name);
+    return name;
+}
+
+int64_t getSteadyTime()
+{
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+/// waits while @p word has the value @p expected, may return spuriously
+void waitWhileEqual(const std::atomic<uint32_t>& word, uint32_t expected, nanoseconds timeout)
+{
+#ifdef __linux__
+    const auto timeout_seconds = duration_cast<seconds>(timeout);
+    timespec relative_timeout{};
+    relative_timeout.tv_sec = static_cast<time_t>(timeout_seconds.count());
+    relative_timeout.tv_nsec = static_cast<long>((timeout - timeout_seconds).count());
+    // not a private futex, the word is shared between processes
+    syscall(SYS_futex, reinterpret_cast<const uint32_t*>(&word), FUTEX_WAIT, expected, &relative_timeout, nullptr, 0);
+#else
+    if (word.load(std::memory_order_acquire) == expected)
+    {
+        std::this_thread::sleep_for(std::min<nanoseconds>(timeout, poll_interval));
+    }
+#endif
+}
+
+void wakeAll(const std::atomic<uint32_t>& word)
+{
+#ifdef __linux__
+    syscall(SYS_futex, reinterpret_cast<const uint32_t*>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#else
+    (void)word;
+#endif
+}
+
+template<typename WRITE>
+void writeSeqlocked(SharedClockData& data, WRITE write)
+{
+    const auto sequence = data._seqlock.load(std::memory_order_relaxed);
+    data._seqlock.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    write();
+    data._seqlock.store(sequence + 2, std::memory_order_release);
+}
+
+uint32_t createSlotToken()
+{
+    static std::atomic<uint32_t> token_counter{ 0 };
+#ifdef WIN32
+    const uint32_t process_id = 0;
+#else
+    const auto process_id = static_cast<uint32_t>(getpid());
+#endif
+    const auto token = (process_id << 12) ^ ++token_counter;
+    return token == 0 ? 1 : token;
+}
+
+} // namespace
+
+SharedClockSegment::~SharedClockSegment()
+{
+    close();
+}
+
+fep3::Result SharedClockSegment::create(const std::string& system_name, const std::string& master_name)
+{
+    close();
+
+#ifdef WIN32
+    (void)system_name;
+    (void)master_name;
+    RETURN_ERROR_DESCRIPTION(ERR_NOT_SUPPORTED, "shared clock segments are not supported on this platform");
+#else
+    const auto name = getSegmentName(system_name, master_name);
+    // a segment left by a master which does not exist anymore is replaced once
+    for (int attempt = 0; attempt < 2; ++attempt)
+    {
+        // only participants of the same user may attach, others are synchronized via rpc
+        const int file_descriptor = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (file_descriptor == -1)
+        {
+            if (errno != EEXIST)
+            {
+                RETURN_ERROR_DESCRIPTION(ERR_FAILED, "creating the shared clock segment '%s' failed: %s",
+                    name.c_str(), std::strerror(errno));
+            }
+
+            SharedClockSegment existing_segment;
+            if (isOk(existing_segment.open(system_name, master_name)) && existing_segment.isMasterAlive())
+            {
+                RETURN_ERROR_DESCRIPTION(ERR_RESOURCE_IN_USE,
+                    "the shared clock segment '%s' is used by another running master", name.c_str());
+            }
+            existing_segment.close();
+            shm_unlink(name.c_str());
+            continue;
+        }
+
+        if (ftruncate(file_descriptor, sizeof(SharedClockData)) != 0)
+        {
+            const auto error = errno;
+            ::close(file_descriptor);
+            shm_unlink(name.c_str());
+            RETURN_ERROR_DESCRIPTION(ERR_FAILED, "resizing the shared clock segment '%s' failed: %s",
+                name.c_str(), std::strerror(error));
+        }
+
+        void* address = mmap(nullptr, sizeof(SharedClockData), PROT_READ | PROT_WRITE, MAP_SHARED, file_descriptor, 0);
+        const auto error = errno;
+        ::close(file_descriptor);
+        if (address == MAP_FAILED)
+        {
+            shm_unlink(name.c_str());
+            RETURN_ERROR_DESCRIPTION(ERR_FAILED, "mapping the shared clock segment '%s' failed: %s",
+                name.c_str(), std::strerror(error));
+        }
+
+        _data = new (address) SharedClockData();
+        _data->_version = segment_version;
+        _data->_master_process_id.store(static_cast<int32_t>(getpid()), std::memory_order_relaxed);
+        _data->_clock_type.store(static_cast<int32_t>(IClock::ClockType::continuous), std::memory_order_relaxed);
+        _data->_magic.store(segment_magic, std::memory_order_release);
+        _name = name;
+        _created = true;
+
+        return {};
+    }
+
+    RETURN_ERROR_DESCRIPTION(ERR_FAILED, "creating the shared clock segment '%s' failed: segment exists", name.c_str());
+#endif
+}
+
+fep3::Result SharedClockSegment::open(const std::string& system_name, const std::string& master_name)
+{
+    close();
+
+#ifdef WIN32
+    (void)system_name;
+    (void)master_name;
+    RETURN_ERROR_DESCRIPTION(ERR_NOT_SUPPORTED, "shared clock segments are not supported on this platform");
+#else
+    const auto name = getSegmentName(system_name, master_name);
+    const int file_descriptor = shm_open(name.c_str(), O_RDWR, 0);
+    if (file_descriptor == -1)
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_NOT_FOUND, "the shared clock segment '%s' does not exist", name.c_str());
+    }
+
+    struct stat file_status{};
+    if (fstat(file_descriptor, &file_status) != 0
+        || static_cast<size_t>(file_status.st_size) < sizeof(SharedClockData))
+    {
+        ::close(file_descriptor);
+        RETURN_ERROR_DESCRIPTION(ERR_NOT_FOUND, "the shared clock segment '%s' is not initialized yet", name.c_str());
+    }
+
+    void* address = mmap(nullptr, sizeof(SharedClockData), PROT_READ | PROT_WRITE, MAP_SHARED, file_descriptor, 0);
+    ::close(file_descriptor);
+    if (address == MAP_FAILED)
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_FAILED, "mapping the shared clock segment '%s' failed", name.c_str());
+    }
+
+    auto data = static_cast<SharedClockData*>(address);
+    if (data->_magic.load(std::memory_order_acquire) != segment_magic)
+    {
+        munmap(address, sizeof(SharedClockData));
+        RETURN_ERROR_DESCRIPTION(ERR_NOT_FOUND, "the shared clock segment '%s' is not initialized yet", name.c_str());
+    }
+    if (data->_version != segment_version)
+    {
+        munmap(address, sizeof(SharedClockData));
+        RETURN_ERROR_DESCRIPTION(ERR_INVALID_VERSION, "the shared clock segment '%s' has version %u, expected %u",
+            name.c_str(), data->_version, segment_version);
+    }
+
+    _data = data;
+    _name = name;
+    _created = false;
+
+    return {};
+#endif
+}
+
+void SharedClockSegment::close()
+{
+    if (!_data)
+    {
+        return;
+    }
+
+#ifndef WIN32
+    if (_created)
+    {
+        _data->_closed.store(1, std::memory_order_release);
+        wakeAll(_data->_event_sequence);
+        shm_unlink(_name.c_str());
+    }
+    munmap(_data, sizeof(SharedClockData));
+#endif
+    _data = nullptr;
+    _name.clear();
+    _created = false;
+}
+
+bool SharedClockSegment::isOpen() const
+{
+    return _data != nullptr;
+}
+
+bool SharedClockSegment::isClosed() const
+{
+    return _data && _data->_closed.load(std::memory_order_acquire) != 0;
+}
+
+bool SharedClockSegment::isMasterAlive() const
+{
+    if (!_data || isClosed())
+    {
+        return false;
+    }
+#ifdef WIN32
+    return true;
+#else
+    const auto master_process_id = static_cast<pid_t>(_data->_master_process_id.load(std::memory_order_relaxed));
+    return kill(master_process_id, 0) == 0 || errno == EPERM;
+#endif
+}
+
+void SharedClockSegment::setRunning(bool running, IClock::ClockType clock_type)
+{
+    std::lock_guard<std::mutex> lock(_publish_mutex);
+    if (!_data)
+    {
+        return;
+    }
+
+    writeSeqlocked(*_data, [&]()
+    {
+        _data->_running.store(running ? 1 : 0, std::memory_order_relaxed);
+        _data->_clock_type.store(static_cast<int32_t>(clock_type), std::memory_order_relaxed);
+    });
+    // slaves waiting for the next event have to recognize the stop
+    wakeAll(_data->_event_sequence);
+}
+
+void SharedClockSegment::publishTime(Timestamp time)
+{
+    std::lock_guard<std::mutex> lock(_publish_mutex);
+    if (!_data)
+    {
+        return;
+    }
+
+    const auto published_at = getSteadyTime();
+    writeSeqlocked(*_data, [&]()
+    {
+        _data->_new_time.store(time.count(), std::memory_order_relaxed);
+        _data->_published_at.store(published_at, std::memory_order_relaxed);
+    });
+}
+
+uint32_t SharedClockSegment::publishEvent(IRPCClockSyncMasterDef::EventID event_id, Timestamp new_time, Timestamp old_time)
+{
+    std::lock_guard<std::mutex> lock(_publish_mutex);
+    if (!_data)
+    {
+        return 0;
+    }
+
+    auto event_sequence = _data->_event_sequence.load(std::memory_order_relaxed) + 1;
+    // 0 is the sequence before the first event
+    if (event_sequence == 0)
+    {
+        event_sequence = 1;
+    }
+
+    const auto published_at = getSteadyTime();
+    writeSeqlocked(*_data, [&]()
+    {
+        _data->_event_id.store(static_cast<int32_t>(event_id), std::memory_order_relaxed);
+        _data->_new_time.store(new_time.count(), std::memory_order_relaxed);
+        _data->_old_time.store(old_time.count(), std::memory_order_relaxed);
+        _data->_published_at.store(published_at, std::memory_order_relaxed);
+        _data->_event_sequence.store(event_sequence, std::memory_order_relaxed);
+    });
+    wakeAll(_data->_event_sequence);
+
+    return event_sequence;
+}
+
+int SharedClockSegment::waitForAcknowledgements(uint32_t event_sequence, nanoseconds timeout)
+{
+    if (!_data)
+    {
+        return 0;
+    }
+
+    const auto timeout_until = steady_clock::now() + timeout;
+    while (true)
+    {
+        const auto acknowledgement_counter = _data->_acknowledgement_counter.load(std::memory_order_acquire);
+
+        bool pending = false;
+        for (const auto& slot : _data->_slots)
+        {
+            if (slot._owner.load(std::memory_order_acquire) != 0
+                && slot._acknowledged_sequence.load(std::memory_order_acquire) != event_sequence)
+            {
+                pending = true;
+                break;
+            }
+        }
+        if (!pending)
+        {
+            return 0;
+        }
+
+        const auto now = steady_clock::now();
+        if (now >= timeout_until)
+        {
+            int released_slaves = 0;
+            for (auto& slot : _data->_slots)
+            {
+                auto owner = slot._owner.load(std::memory_order_acquire);
+                if (owner != 0
+                    && slot._acknowledged_sequence.load(std::memory_order_acquire) != event_sequence
+                    && slot._owner.compare_exchange_strong(owner, 0, std::memory_order_acq_rel))
+                {
+                    ++released_slaves;
+                }
+            }
+            return released_slaves;
+        }
+
+        waitWhileEqual(_data->_acknowledgement_counter, acknowledgement_counter, timeout_until - now);
+    }
+}
+
+int SharedClockSegment::getAcquiredSlots() const
+{
+    if (!_data)
+    {
+        return 0;
+    }
+
+    return static_cast<int>(std::count_if(std::begin(_data->_slots), std::end(_data->_slots),
+        [](const SharedClockSlot& slot) { return slot._owner.load(std::memory_order_acquire) != 0; }));
+}
+
+SharedClockSegment::State SharedClockSegment::read() const
+{
+    State state{ false, IClock::ClockType::continuous, 0, IRPCClockSyncMasterDef::EventID::time_reset,
+        Timestamp{ 0 }, Timestamp{ 0 }, nanoseconds{ 0 } };
+    if (!_data)
+    {
+        return state;
+    }
+
+    while (true)
+    {
+        const auto sequence = _data->_seqlock.load(std::memory_order_acquire);
+        if (sequence & 1)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        state._running = _data->_running.load(std::memory_order_relaxed) != 0;
+        state._clock_type = static_cast<IClock::ClockType>(_data->_clock_type.load(std::memory_order_relaxed));
+        state._event_sequence = _data->_event_sequence.load(std::memory_order_relaxed);
+        state._event_id = static_cast<IRPCClockSyncMasterDef::EventID>(_data->_event_id.load(std::memory_order_relaxed));
+        state._new_time = Timestamp{ _data->_new_time.load(std::memory_order_relaxed) };
+        state._old_time = Timestamp{ _data->_old_time.load(std::memory_order_relaxed) };
+        state._published_at = nanoseconds{ _data->_published_at.load(std::memory_order_relaxed) };
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (_data->_seqlock.load(std::memory_order_relaxed) == sequence)
+        {
+            return state;
+        }
+    }
+}
+
+bool SharedClockSegment::waitForEvent(uint32_t event_sequence, nanoseconds timeout) const
+{
+    if (!_data)
+    {
+        return false;
+    }
+
+    const auto timeout_until = steady_clock::now() + timeout;
+    while (true)
+    {
+        if (_data->_closed.load(std::memory_order_acquire) != 0
+            || _data->_event_sequence.load(std::memory_order_acquire) != event_sequence)
+        {
+            return true;
+        }
+
+        const auto now = steady_clock::now();
+        if (now >= timeout_until)
+        {
+            return false;
+        }
+        waitWhileEqual(_data->_event_sequence, event_sequence, timeout_until - now);
+    }
+}
+
+int SharedClockSegment::acquireSlot()
+{
+    if (!_data)
+    {
+        return -1;
+    }
+
+    _slot_token = createSlotToken();
+    for (int slot_index = 0; slot_index < shared_clock::max_slaves; ++slot_index)
+    {
+        auto& slot = _data->_slots[slot_index];
+        uint32_t free_owner = 0;
+        if (slot._owner.compare_exchange_strong(free_owner, _slot_token, std::memory_order_acq_rel))
+        {
+            // the current event is processed by the slave right after acquiring the slot anyway
+            slot._acknowledged_sequence.store(_data->_event_sequence.load(std::memory_order_acquire),
+                std::memory_order_release);
+            return slot_index;
+        }
+    }
+
+    return -1;
+}
+
+bool SharedClockSegment::acknowledge(int slot_index, uint32_t event_sequence)
+{
+    if (!_data || slot_index < 0 || slot_index >= shared_clock::max_slaves)
+    {
+        return false;
+    }
+
+    auto& slot = _data->_slots[slot_index];
+    if (slot._owner.load(std::memory_order_acquire) != _slot_token)
+    {
+        return false;
+    }
+    slot._acknowledged_sequence.store(event_sequence, std::memory_order_release);
+    _data->_acknowledgement_counter.fetch_add(1, std::memory_order_acq_rel);
+    wakeAll(_data->_acknowledgement_counter);
+
+    return slot._owner.load(std::memory_order_acquire) == _slot_token;
+}
+
+void SharedClockSegment::releaseSlot(int slot_index)
+{
+    if (!_data || slot_index < 0 || slot_index >= shared_clock::max_slaves)
+    {
+        return;
+    }
+
+    auto owner = _slot_token;
+    if (_data->_slots[slot_index]._owner.compare_exchange_strong(owner, 0, std::memory_order_acq_rel))
+    {
+        // the master may wait for the acknowledgement of this slot
+        _data->_acknowledgement_counter.fetch_add(1, std::memory_order_acq_rel);
+        wakeAll(_data->_acknowledgement_counter);
+    }
+}
+
+std::string getSystemName(const IServiceBus::IParticipantServer& server)
+{
+    const auto registry = dynamic_cast<const base::arya::ServiceRegistryBase*>(&server);
+    return registry ? registry->getSystemName() : std::string();
+}
+
+} // namespace rpc
+} // namespace fep3
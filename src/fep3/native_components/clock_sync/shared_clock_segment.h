@@ -0,0 +1,186 @@
+/**
+* @file
+* Copyright &copy; Audi AG. All rights reserved.
+*
+* This Source Code Form is subject to the terms of the
+* Mozilla Public License, v. 2.0.
+* If a copy of the MPL was not distributed with this
+* file, You can obtain one at https://mozilla.org/MPL/2.0/.
+*
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#include <fep3/fep3_errors.h>
+#include <fep3/fep3_timestamp.h>
+#include <fep3/components/clock/clock_intf.h>
+#include <fep3/components/service_bus/service_bus_intf.h>
+#include <fep3/rpc_services/clock_sync/clock_sync_service_rpc_intf_def.h>
+
+namespace fep3
+{
+namespace rpc
+{
+
+namespace shared_clock
+{
+/// maximum number of discrete slaves acknowledging the time events of one master
+constexpr int max_slaves = 32;
+/// period in which the time of a continuous master clock is published
+constexpr std::chrono::milliseconds refresh_period{ 10 };
+} // namespace shared_clock
+
+struct SharedClockData;
+
+/**
+ * Shared memory segment a clock master publishes its time to, read by slaves on the same host.
+ *
+ * The time is protected by a seqlock, so reading it does not need any system call.
+ * Every time event (time updating, time reset) increments the event sequence, which discrete slaves
+ * wait for (futex on Linux, polling elsewhere). Discrete slaves acquire a slot and acknowledge
+ * every event they processed, the master waits for these acknowledgements like it waits for rpc slaves.
+ * The time of a continuous master is published periodically together with the steady clock time
+ * it was taken at, so slaves extrapolate it.
+ *
+ * The segment is named after the system and the master participant, it is only supported on POSIX systems.
+ * The publishing methods may be called concurrently, @ref create, @ref open and @ref close
+ * must not be called concurrently to any other method.
+ */
+class SharedClockSegment
+{
+public:
+    /**
+     * Consistent snapshot of the published time.
+     */
+    struct State
+    {
+        /// false if the master is not started
+        bool _running;
+        IClock::ClockType _clock_type;
+        /// incremented by every time event
+        uint32_t _event_sequence;
+        IRPCClockSyncMasterDef::EventID _event_id;
+        Timestamp _new_time;
+        Timestamp _old_time;
+        /// steady clock time (since epoch) the time was published at
+        std::chrono::nanoseconds _published_at;
+    };
+
+public:
+    SharedClockSegment() = default;
+    ~SharedClockSegment();
+    SharedClockSegment(const SharedClockSegment&) = delete;
+    SharedClockSegment(SharedClockSegment&&) = delete;
+    SharedClockSegment& operator=(const SharedClockSegment&) = delete;
+    SharedClockSegment& operator=(SharedClockSegment&&) = delete;
+
+    /**
+     * Creates the segment of the master @p master_name. A segment left by a terminated process is replaced.
+     *
+     * @param system_name the name of the system the master participant belongs to
+     * @param master_name the name of the master participant
+     * @return ERR_NOERROR if created, ERR_RESOURCE_IN_USE if another running master uses the segment,
+     *         ERR_NOT_SUPPORTED if shared memory is not supported on this platform, ERR_FAILED otherwise
+     */
+    fep3::Result create(const std::string& system_name, const std::string& master_name);
+    /**
+     * Opens the segment of the master @p master_name created by @ref create.
+     *
+     * @param system_name the name of the system the master participant belongs to
+     * @param master_name the name of the master participant
+     * @return ERR_NOERROR if opened, ERR_NOT_FOUND if the master did not create the segment (yet),
+     *         ERR_NOT_SUPPORTED if shared memory is not supported on this platform
+     */
+    fep3::Result open(const std::string& system_name, const std::string& master_name);
+    /**
+     * Closes the segment. If created by this instance it is marked as closed and removed,
+     * waiting slaves are woken up.
+     */
+    void close();
+    bool isOpen() const;
+    /**
+     * @return true if the master closed the segment, a new one has to be opened
+     */
+    bool isClosed() const;
+    /**
+     * @return true if the master which created the segment still uses it, checks whether its process exists
+     */
+    bool isMasterAlive() const;
+
+public: // master side
+    /**
+     * Marks the master as started or stopped.
+     */
+    void setRunning(bool running, IClock::ClockType clock_type);
+    /**
+     * Publishes the current time of a continuous clock, does not increment the event sequence.
+     */
+    void publishTime(Timestamp time);
+    /**
+     * Publishes a time event and wakes up the waiting slaves.
+     *
+     * @return the event sequence of the published event, 0 if the segment is not open
+     */
+    uint32_t publishEvent(IRPCClockSyncMasterDef::EventID event_id, Timestamp new_time, Timestamp old_time);
+    /**
+     * Waits until all slaves acknowledged the event @p event_sequence.
+     * Slaves not acknowledging in time are released from their slot.
+     *
+     * @return the number of released slaves
+     */
+    int waitForAcknowledgements(uint32_t event_sequence, std::chrono::nanoseconds timeout);
+    /**
+     * @return the number of slots acquired by slaves
+     */
+    int getAcquiredSlots() const;
+
+public: // slave side
+    /**
+     * Reads the published time without any system call.
+     */
+    State read() const;
+    /**
+     * Waits until an event with another sequence than @p event_sequence was published
+     * or the segment was closed by the master.
+     *
+     * @return false on timeout
+     */
+    bool waitForEvent(uint32_t event_sequence, std::chrono::nanoseconds timeout) const;
+    /**
+     * Acquires a slot, the master waits for the acknowledgements of all acquired slots.
+     *
+     * @return the slot, -1 if no slot is free
+     */
+    int acquireSlot();
+    /**
+     * Acknowledges the event @p event_sequence for the slot @p slot.
+     *
+     * @return false if the slot was released by the master in the meantime
+     */
+    bool acknowledge(int slot, uint32_t event_sequence);
+    void releaseSlot(int slot);
+
+private:
+    std::mutex _publish_mutex;
+    SharedClockData* _data{ nullptr };
+    std::string _name;
+    bool _created{ false };
+    uint32_t _slot_token{ 0 };
+};
+
+/**
+ * Returns the name of the system the participant of @p server belongs to, which names its shared clock segment.
+ * The participant interface does not provide it, only the servers of the native service bus know it.
+ *
+ * @param server the participant server
+ * @return the system name, empty if the server does not provide it
+ */
+std::string getSystemName(const IServiceBus::IParticipantServer& server);
+
+} // namespace rpc
+} // namespace fep3
@@ -0,0 +1,172 @@
+/**
+* @file
+* Copyright &copy; AUDI AG. All rights reserved.
+*
+* This Source Code Form is subject to the terms of the
+* Mozilla Public License, v. 2.0.
+* If a copy of the MPL was not distributed with this
+* file, You can obtain one at https://mozilla.org/MPL/2.0/.
+*
+*/
+
+#include "data_receive_dispatcher.h"
+
+#include <fep3/base/thread/thread.h>
+
+#include <algorithm>
+
+using namespace fep3;
+using namespace fep3::native;
+
+DataReceiveDispatcher::DataReceiveDispatcher(size_t thread_count,
+                                             std::chrono::microseconds min_idle_wait,
+                                             std::chrono::microseconds max_idle_wait)
+    : _min_idle_wait(min_idle_wait)
+    , _max_idle_wait(std::max(min_idle_wait, max_idle_wait))
+{
+    if (thread_count == 0)
+    {
+        thread_count = 1;
+    }
+    for (size_t count = 0; count < thread_count; ++count)
+    {
+        _workers.push_back(std::make_unique<Worker>());
+    }
+}
+
+DataReceiveDispatcher::~DataReceiveDispatcher()
+{
+    stop();
+}
+
+void DataReceiveDispatcher::add(ISimulationBus::IDataReader& reader, ISimulationBus::IDataReceiver& receiver)
+{
+    if (_next_worker >= _workers.size())
+    {
+        _next_worker = 0;
+    }
+    auto& worker = *_workers[_next_worker++];
+
+    auto notifying_reader = dynamic_cast<INotifyingDataReader*>(&reader);
+    {
+        std::lock_guard<std::mutex> lock(worker.entries_mutex);
+        worker.entries.push_back(Entry{ &reader, &receiver, notifying_reader });
+        if (notifying_reader)
+        {
+            notifying_reader->setItemNotification(worker.notification);
+        }
+        else
+        {
+            ++worker.polled_entry_count;
+        }
+    }
+    // items pushed before the notification was set are picked up by the next pass
+    worker.notification->notify();
+}
+
+void DataReceiveDispatcher::remove(ISimulationBus::IDataReader& reader)
+{
+    for (auto& worker : _workers)
+    {
+        // the worker holds the lock during a whole pass, so the reader is not in use anymore afterwards
+        std::lock_guard<std::mutex> lock(worker->entries_mutex);
+        worker->entries.remove_if([&worker, &reader](const Entry& entry)
+        {
+            if (entry.reader != &reader)
+            {
+                return false;
+            }
+            if (entry.notifying_reader)
+            {
+                entry.notifying_reader->setItemNotification(nullptr);
+            }
+            else
+            {
+                --worker->polled_entry_count;
+            }
+            return true;
+        });
+    }
+}
+
+fep3::Result DataReceiveDispatcher::start(const ThreadConfiguration& thread_configuration)
+{
+    if (_running.exchange(true))
+    {
+        return {};
+    }
+    for (auto& worker : _workers)
+    {
+        Worker* current = worker.get();
+        current->thread = std::thread([this, current]() { work(*current); });
+    }
+    for (size_t index = 0; index < _workers.size(); ++index)
+    {
+        const auto result = thread::configure(_workers[index]->thread,
+            "__data_rx_" + std::to_string(index),
+            thread_configuration);
+        if (isFailed(result))
+        {
+            stop();
+            return result;
+        }
+    }
+    return {};
+}
+
+void DataReceiveDispatcher::stop()
+{
+    if (!_running.exchange(false))
+    {
+        return;
+    }
+    for (auto& worker : _workers)
+    {
+        worker->notification->notify();
+    }
+    for (auto& worker : _workers)
+    {
+        if (worker->thread.joinable())
+        {
+            worker->thread.join();
+        }
+    }
+}
+
+size_t DataReceiveDispatcher::getThreadCount() const
+{
+    return _workers.size();
+}
+
+void DataReceiveDispatcher::work(Worker& worker)
+{
+    auto idle_wait = _min_idle_wait;
+    while (_running)
+    {
+        bool received = false;
+        bool polling = false;
+        {
+            std::lock_guard<std::mutex> lock(worker.entries_mutex);
+            for (auto& entry : worker.entries)
+            {
+                received |= entry.reader->pop(*entry.receiver);
+            }
+            polling = worker.polled_entry_count > 0;
+        }
+
+        if (received)
+        {
+            idle_wait = _min_idle_wait;
+        }
+        else if (polling)
+        {
+            worker.notification->waitFor(idle_wait);
+            idle_wait = std::min(idle_wait * 2, _max_idle_wait);
+        }
+        else
+        {
+            // every reader signals the notification on push, stop signals it as well
+            worker.notification->wait();
+        }
+    }
+}
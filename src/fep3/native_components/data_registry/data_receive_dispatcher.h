@@ -0,0 +1,115 @@
+/**
+* @file
+* Copyright &copy; AUDI AG. All rights reserved.
+*
+* This Source Code Form is subject to the terms of the
+* Mozilla Public License, v. 2.0.
+* If a copy of the MPL was not distributed with this
+* file, You can obtain one at https://mozilla.org/MPL/2.0/.
+*
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "fep3/components/simulation_bus/simulation_bus_intf.h"
+#include <fep3/native_components/simulation_bus/item_notification.h>
+#include <fep3/base/thread/thread_configuration.h>
+
+namespace fep3
+{
+namespace native
+{
+namespace arya
+{
+/**
+ * Dispatches incoming data of many simulation bus readers with a fixed number of worker threads
+ * instead of one blocking receive thread per reader.
+ *
+ * Readers are distributed round robin to the workers. Each worker pops one item of each of its readers per pass
+ * and passes it to the corresponding receiver. Readers of the native simulation bus signal the worker on every push
+ * (see @ref INotifyingDataReader), so a worker without incoming data blocks until the next push.
+ * Other readers do not provide a readiness notification, a worker serving one of them waits with an increasing
+ * backoff (starting at @p min_idle_wait, up to @p max_idle_wait) before the next pass.
+ */
+class DataReceiveDispatcher
+{
+public:
+    DataReceiveDispatcher(size_t thread_count,
+                          std::chrono::microseconds min_idle_wait = std::chrono::microseconds(10),
+                          std::chrono::microseconds max_idle_wait = std::chrono::microseconds(1000));
+    ~DataReceiveDispatcher();
+    DataReceiveDispatcher(const DataReceiveDispatcher&) = delete;
+    DataReceiveDispatcher(DataReceiveDispatcher&&) = delete;
+    DataReceiveDispatcher& operator=(const DataReceiveDispatcher&) = delete;
+    DataReceiveDispatcher& operator=(DataReceiveDispatcher&&) = delete;
+
+    /**
+     * Adds a reader whose items will be passed to @p receiver. Both must stay valid until @ref remove is called.
+     *
+     * @param reader the simulation bus reader to pop items from
+     * @param receiver the receiver to pass the items to
+     */
+    void add(ISimulationBus::IDataReader& reader, ISimulationBus::IDataReceiver& receiver);
+
+    /**
+     * Removes the @p reader. If the reader is dispatched at the moment, this blocks until the dispatching returned.
+     *
+     * @param reader the reader to remove
+     */
+    void remove(ISimulationBus::IDataReader& reader);
+
+    /**
+     * Starts the worker threads. Does nothing if already started.
+     *
+     * @param thread_configuration cpu affinity and scheduling of the worker threads
+     * @return the error if a worker thread could not be configured, the workers are stopped in that case
+     */
+    fep3::Result start(const ThreadConfiguration& thread_configuration = {});
+
+    /**
+     * Stops and joins the worker threads. Does nothing if not started.
+     */
+    void stop();
+
+    size_t getThreadCount() const;
+
+private:
+    struct Entry
+    {
+        ISimulationBus::IDataReader* reader;
+        ISimulationBus::IDataReceiver* receiver;
+        // nullptr if the reader does not support notifications and has to be polled
+        INotifyingDataReader* notifying_reader;
+    };
+
+    struct Worker
+    {
+        std::mutex entries_mutex;
+        std::list<Entry> entries;
+        size_t polled_entry_count{ 0 };
+        const std::shared_ptr<ItemNotification> notification{ std::make_shared<ItemNotification>() };
+        std::thread thread;
+    };
+
+    void work(Worker& worker);
+
+private:
+    std::vector<std::unique_ptr<Worker>> _workers;
+    size_t _next_worker{ 0 };
+    const std::chrono::microseconds _min_idle_wait;
+    const std::chrono::microseconds _max_idle_wait;
+
+    std::atomic<bool> _running{ false };
+};
+} // namespace arya
+using arya::DataReceiveDispatcher;
+} // namespace native
+} // namespace fep3
@@ -15,8 +15,11 @@
 
 #include "data_io.h"
 #include "data_signal.h"
+#include "data_receive_dispatcher.h"
+#include <fep3/base/thread/thread.h>
 #include "fep3/fep3_errors.h"
 #include "fep3/components/service_bus/service_bus_intf.h"
+#include "fep3/components/configuration/configuration_service_intf.h"
 
 using namespace fep3;
 using namespace fep3::native;
@@ -42,6 +45,27 @@ Json::Value RPCDataRegistryService::getStreamType(const std::string& signal_name
     return value;
 }
 
+DataRegistryConfiguration::DataRegistryConfiguration()
+    : Configuration(FEP3_DATA_REGISTRY_CONFIG)
+{
+}
+
+fep3::Result DataRegistryConfiguration::registerPropertyVariables()
+{
+    FEP3_RETURN_IF_FAILED(registerPropertyVariable(_receive_thread_count, FEP3_DATA_REGISTRY_RECEIVE_THREAD_COUNT_PROPERTY));
+    FEP3_RETURN_IF_FAILED(registerPropertyVariable(_receive_thread_configuration, FEP3_DATA_REGISTRY_RECEIVE_THREAD_CONFIGURATION_PROPERTY));
+
+    return {};
+}
+
+fep3::Result DataRegistryConfiguration::unregisterPropertyVariables()
+{
+    FEP3_RETURN_IF_FAILED(unregisterPropertyVariable(_receive_thread_count, FEP3_DATA_REGISTRY_RECEIVE_THREAD_COUNT_PROPERTY));
+    FEP3_RETURN_IF_FAILED(unregisterPropertyVariable(_receive_thread_configuration, FEP3_DATA_REGISTRY_RECEIVE_THREAD_CONFIGURATION_PROPERTY));
+
+    return {};
+}
+
 DataRegistry::DataRegistry() : ComponentBase()
 {
 }
@@ -76,6 +100,13 @@ fep3::Result DataRegistry::create()
         {
             RETURN_ERROR_DESCRIPTION(ERR_POINTER, "Service Bus is not registered");
         }
+
+        //the configuration is optional, without it the defaults are used
+        auto configuration_service = components->getComponent<IConfigurationService>();
+        if (configuration_service)
+        {
+            FEP3_RETURN_IF_FAILED(_configuration.initConfiguration(*configuration_service));
+        }
     }
     else
     {
@@ -84,6 +115,12 @@ fep3::Result DataRegistry::create()
     return{};
 }
 
+fep3::Result DataRegistry::destroy()
+{
+    _configuration.deinitConfiguration();
+    return{};
+}
+
 fep3::Result DataRegistry::tense()
 {
     // Get simulation bus connection
@@ -98,15 +135,40 @@ fep3::Result DataRegistry::tense()
         RETURN_ERROR_DESCRIPTION(ERR_POINTER, "Simulation Bus is not registered");
     }
 
+    _configuration.updatePropertyVariables();
+    const int32_t receive_thread_count = _configuration._receive_thread_count;
+    if (receive_thread_count < 0)
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_INVALID_ARG, "Invalid value %d for property '%s', the thread count must not be negative",
+            receive_thread_count, FEP3_DATA_REGISTRY_RECEIVE_THREAD_COUNT);
+    }
+    const std::string receive_thread_configuration_string = _configuration._receive_thread_configuration;
+    ThreadConfiguration receive_thread_configuration;
+    const auto thread_configuration_result = thread::parseConfiguration(receive_thread_configuration_string, receive_thread_configuration);
+    if (fep3::isFailed(thread_configuration_result))
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_INVALID_ARG, "Invalid value '%s' for property '%s': %s",
+            receive_thread_configuration_string.c_str(), FEP3_DATA_REGISTRY_RECEIVE_THREAD_CONFIGURATION,
+            thread_configuration_result.getDescription());
+    }
+    if (receive_thread_count > 0)
+    {
+        _receive_dispatcher = std::make_shared<DataReceiveDispatcher>(static_cast<size_t>(receive_thread_count));
+    }
+
     // Register ALL signals IN
     for (auto& current_in : _ins)
     {
-        auto res = current_in.second->registerAtSimulationBus(*simulation_bus);
+        auto res = current_in.second->registerAtSimulationBus(*simulation_bus, _receive_dispatcher, receive_thread_configuration);
         if (fep3::isFailed(res))
         {
             return res;
         }
     }
+    if (_receive_dispatcher)
+    {
+        FEP3_RETURN_IF_FAILED(_receive_dispatcher->start(receive_thread_configuration));
+    }
     // Register ALL signals OUT
     for (auto& current_out : _outs)
     {
@@ -126,11 +188,16 @@ fep3::Result DataRegistry::relax()
     {
         current_out.second->unregisterFromSimulationBus();
     }
+    if (_receive_dispatcher)
+    {
+        _receive_dispatcher->stop();
+    }
     // Unregister ALL signals IN
     for (auto& current_in : _ins)
     {
         current_in.second->unregisterFromSimulationBus();
     }
+    _receive_dispatcher.reset();
     return{};
 }
 
@@ -200,6 +267,19 @@ fep3::Result DataRegistry::unregisterDataReceiveListener(const std::string& name
     RETURN_ERROR_DESCRIPTION(ERR_NOT_FOUND, description.c_str());
 }
 
+fep3::Result DataRegistry::waitForDelivery(const std::string& signal_name, std::chrono::nanoseconds timeout)
+{
+    DataSignalIn* found = getDataIn(signal_name);
+    if (found && !found->waitForDelivery(timeout))
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_TIMEOUT,
+            "The data received for the input signal %s was not passed to its readers within %lld ms",
+            signal_name.c_str(),
+            static_cast<long long>(std::chrono::duration_cast<std::chrono::milliseconds>(timeout).count()));
+    }
+    return {};
+}
+
 std::unique_ptr<IDataRegistry::IDataReader> DataRegistry::getReader(const std::string& name)
 {
     return getReader(name, size_t(1));
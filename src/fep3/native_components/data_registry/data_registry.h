@@ -21,10 +21,12 @@
 #include "fep3/base/streamtype/default_streamtype.h"
 #include "fep3/base/streamtype/streamtype_intf.h"
 #include "fep3/components/base/component_base.h"
+#include "fep3/components/configuration/propertynode.h"
 #include "fep3/components/data_registry/data_registry_intf.h"
 #include "fep3/rpc_services/data_registry/data_registry_service_stub.h"
 #include "fep3/components/service_bus/rpc/fep_rpc.h"
 #include "fep3/rpc_services/data_registry/data_registry_rpc_intf_def.h"
+#include "delivery_tracking.h"
 
 namespace fep3
 {
@@ -33,6 +35,7 @@ namespace native
 namespace arya
 {
 class DataRegistry;
+class DataReceiveDispatcher;
 
 class RPCDataRegistryService : public rpc::RPCService<fep3::rpc_stubs::RPCDataRegistryServiceStub, fep3::rpc::IRPCDataRegistryDef>
 {
@@ -48,14 +51,31 @@ private:
     DataRegistry& _data_registry;
 };
 
+/**
+* @brief Configuration for the DataRegistry
+*/
+struct DataRegistryConfiguration : public Configuration
+{
+    DataRegistryConfiguration();
+    ~DataRegistryConfiguration() = default;
+
+    fep3::Result registerPropertyVariables() override;
+    fep3::Result unregisterPropertyVariables() override;
+
+    PropertyVariable<int32_t> _receive_thread_count{ FEP3_DATA_REGISTRY_RECEIVE_THREAD_COUNT_DEFAULT_VALUE };
+    PropertyVariable<std::string> _receive_thread_configuration{ "" };
+};
+
 /**
  * Native implementation of the data registry. Manages an internal list of
  * input and output signals which will be registered to the simulation bus
  * all at once during initialization.
  *
  * This class also provides getter functions for readers and writers to these signals.
+ * The received data is passed to the readers asynchronously by receive threads,
+ * @ref waitForDelivery waits for them.
  */
-class DataRegistry : public ComponentBase<IDataRegistry>
+class DataRegistry : public ComponentBase<IDataRegistry>, public IDeliveryTrackingDataRegistry
 {
 public:
     DataRegistry();
@@ -64,6 +84,7 @@ public:
 
 protected:
     fep3::Result create() override;
+    fep3::Result destroy() override;
 
 public:
     fep3::Result registerDataIn(const std::string& name,
@@ -87,6 +108,9 @@ public:
     std::unique_ptr<IDataRegistry::IDataWriter> getWriter(const std::string& name,
         size_t queue_capacity) override;
 
+public: //implementation of IDeliveryTrackingDataRegistry
+    fep3::Result waitForDelivery(const std::string& signal_name, std::chrono::nanoseconds timeout) override;
+
 public:
     std::vector<std::string> getSignalInNames();
     std::vector<std::string> getSignalOutNames();
@@ -116,6 +140,9 @@ private:
     std::unordered_map<std::string, std::shared_ptr<DataSignalIn>> _ins{};
     std::unordered_map<std::string, std::shared_ptr<DataSignalOut>> _outs{};
     std::shared_ptr<rpc::IRPCServer::IRPCService> _rpc_service{ nullptr };
+
+    DataRegistryConfiguration _configuration;
+    std::shared_ptr<DataReceiveDispatcher> _receive_dispatcher{ nullptr };
 };
 } // namespace arya
 using arya::RPCDataRegistryService;
@@ -11,7 +11,10 @@
 
 #include "data_signal.h"
 
+#include <fep3/base/thread/thread.h>
+
 #include <algorithm>
+#include <iterator>
 
 using namespace fep3;
 using namespace fep3::native;
@@ -46,24 +49,35 @@ DataRegistry::DataSignalIn::~DataSignalIn()
 
 void DataRegistry::DataSignalIn::registerDataListener(const std::shared_ptr<IDataReceiver>& listener)
 {
-    for (auto& current_listener : _listeners)
+    auto listeners = std::atomic_load(&_listeners);
+    std::shared_ptr<const ListenerList> new_listeners;
+    do
     {
-        if (current_listener == listener)
+        if (std::find(listeners->begin(), listeners->end(), listener) != listeners->end())
         {
             return;
         }
-    }
-    _listeners.push_back(listener);
+        auto changed_listeners = std::make_shared<ListenerList>(*listeners);
+        changed_listeners->push_back(listener);
+        new_listeners = std::move(changed_listeners);
+    } while (!std::atomic_compare_exchange_weak(&_listeners, &listeners, new_listeners));
 }
 
 void DataRegistry::DataSignalIn::unregisterDataListener(const std::shared_ptr<IDataReceiver>& listener)
 {
-    auto listener_it = std::find_if(_listeners.begin(), _listeners.end(),
-        [&listener](std::shared_ptr<IDataReceiver> current_listener) {return current_listener == listener;});
-    if (listener_it != _listeners.end())
+    auto listeners = std::atomic_load(&_listeners);
+    std::shared_ptr<const ListenerList> new_listeners;
+    do
     {
-        _listeners.erase(listener_it);
-    }
+        auto listener_it = std::find(listeners->begin(), listeners->end(), listener);
+        if (listener_it == listeners->end())
+        {
+            return;
+        }
+        auto changed_listeners = std::make_shared<ListenerList>(listeners->begin(), listener_it);
+        changed_listeners->insert(changed_listeners->end(), std::next(listener_it), listeners->end());
+        new_listeners = std::move(changed_listeners);
+    } while (!std::atomic_compare_exchange_weak(&_listeners, &listeners, new_listeners));
 }
 
 size_t DataRegistry::DataSignalIn::getMaxQueueSize() const 
@@ -85,8 +99,12 @@ size_t DataRegistry::DataSignalIn::getMaxQueueSize() const
     return size_result;
 }
 
-fep3::Result DataRegistry::DataSignalIn::registerAtSimulationBus(ISimulationBus& simulation_bus)
+fep3::Result DataRegistry::DataSignalIn::registerAtSimulationBus(ISimulationBus& simulation_bus,
+    const std::shared_ptr<DataReceiveDispatcher>& receive_dispatcher,
+    const ThreadConfiguration& receive_thread_configuration)
 {
+    _receive_dispatcher = receive_dispatcher;
+    _receive_thread_configuration = receive_thread_configuration;
     try
     {
         if (hasDynamicType())
@@ -126,15 +144,26 @@ fep3::Result DataRegistry::DataSignalIn::startReceiving()
 {
     if (_sim_bus_reader)
     {
+        if (_receive_dispatcher)
+        {
+            _receive_dispatcher->add(*_sim_bus_reader, *this);
+            return{};
+        }
         ISimulationBus::IDataReader* reader = _sim_bus_reader.get();
-        // Fix me: This will create a new thread for every data reader and can cause
-        // a out-of-memory situation if a lot of readers get created!!!
-        // but this can only be fixed if simulationbus changes!
+        // This creates a new thread for every data reader which can cause
+        // an out-of-memory situation if a lot of readers get created.
+        // Use the receive dispatcher (FEP3_DATA_REGISTRY_RECEIVE_THREAD_COUNT) in that case.
         _receive_thread = std::thread([reader, this]()
         {
             reader->receive(*this);
         });
-        return{};
+        const auto result = thread::configure(_receive_thread, "__rx_" + getName(), _receive_thread_configuration);
+        if (isFailed(result))
+        {
+            _sim_bus_reader->stop();
+            _receive_thread.join();
+        }
+        return result;
     }
     RETURN_ERROR_DESCRIPTION(ERR_NOT_INITIALISED, "Data Registry is not initialised");
 }
@@ -144,6 +173,12 @@ fep3::Result DataRegistry::DataSignalIn::stopReceiving()
 {
     if (_sim_bus_reader)
     {
+        if (_receive_dispatcher)
+        {
+            _receive_dispatcher->remove(*_sim_bus_reader);
+            _receive_dispatcher.reset();
+            return{};
+        }
         _sim_bus_reader->stop();
         if (_receive_thread.joinable())
         {
@@ -173,6 +208,12 @@ std::unique_ptr<IDataRegistry::IDataReader> DataRegistry::DataSignalIn::getReade
     return std::make_unique<DataRegistry::DataReaderProxy>(reader);
 }
 
+bool DataRegistry::DataSignalIn::waitForDelivery(std::chrono::nanoseconds timeout)
+{
+    auto delivery_tracking_reader = dynamic_cast<IDeliveryTrackingDataReader*>(_sim_bus_reader.get());
+    return !delivery_tracking_reader || delivery_tracking_reader->waitForDelivery(timeout);
+}
+
 void DataRegistry::DataSignalIn::operator()(const data_read_ptr<const IStreamType>& type)
 {
     //first of all we receive for the queues 
@@ -187,7 +228,8 @@ void DataRegistry::DataSignalIn::operator()(const data_read_ptr<const IStreamTyp
             locked_reader->operator()(type);
         }
     }
-    for (auto& listener : _listeners)
+    const auto listeners = std::atomic_load(&_listeners);
+    for (auto& listener : *listeners)
     {
         (*listener)(type);
     }
@@ -206,7 +248,8 @@ void DataRegistry::DataSignalIn::operator()(const data_read_ptr<const IDataSampl
             locked_reader->operator()(sample);
         }
     }
-    for (auto& listener : _listeners)
+    const auto listeners = std::atomic_load(&_listeners);
+    for (auto& listener : *listeners)
     {
         (*listener)(sample);
     }
@@ -11,11 +11,13 @@
 
 #pragma once
 
+#include <chrono>
 #include <utility>
 #include <vector>
 
 #include "data_io.h"
 #include "data_registry.h"
+#include "data_receive_dispatcher.h"
 
 namespace fep3
 {
@@ -65,7 +67,9 @@ public:
     DataSignalIn(const std::string& name, const IStreamType& type, bool dynamic_type) : DataSignal(name, type, dynamic_type) {}
     ~DataSignalIn() override;
 
-    fep3::Result registerAtSimulationBus(ISimulationBus& simulation_bus);
+    fep3::Result registerAtSimulationBus(ISimulationBus& simulation_bus,
+        const std::shared_ptr<DataReceiveDispatcher>& receive_dispatcher = nullptr,
+        const ThreadConfiguration& receive_thread_configuration = {});
     void unregisterFromSimulationBus();
 
     void registerDataListener(const std::shared_ptr<IDataReceiver>& listener);
@@ -73,6 +77,12 @@ public:
 
     std::unique_ptr<IDataRegistry::IDataReader> getReader(const size_t queue_capacity);
 
+    /**
+     * Blocks until the data received so far was passed to the readers and listeners.
+     * Returns true immediately if the reader of the simulation bus does not track the delivery.
+     */
+    bool waitForDelivery(std::chrono::nanoseconds timeout);
+
 public:
     void operator()(const data_read_ptr<const IStreamType>& type) override;
     void operator()(const data_read_ptr<const IDataSample>& sample) override;
@@ -82,8 +92,12 @@ private:
 
     typedef std::list<std::weak_ptr<DataRegistry::DataReader>> DataReaderList;
     std::shared_ptr<DataReaderList> _readers{ std::make_shared<DataReaderList>() };
-    std::vector<std::shared_ptr<IDataReceiver>> _listeners{};
+    // copy on write, so the receiving threads iterate over a snapshot while listeners are (un)registered
+    typedef std::vector<std::shared_ptr<IDataReceiver>> ListenerList;
+    std::shared_ptr<const ListenerList> _listeners{ std::make_shared<const ListenerList>() };
     std::thread _receive_thread;
+    std::shared_ptr<DataReceiveDispatcher> _receive_dispatcher;
+    ThreadConfiguration _receive_thread_configuration;
 
     size_t getMaxQueueSize() const;
     fep3::Result startReceiving();
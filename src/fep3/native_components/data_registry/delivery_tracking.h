@@ -0,0 +1,51 @@
+/**
+* @file
+* Copyright &copy; AUDI AG. All rights reserved.
+*
+* This Source Code Form is subject to the terms of the
+* Mozilla Public License, v. 2.0.
+* If a copy of the MPL was not distributed with this
+* file, You can obtain one at https://mozilla.org/MPL/2.0/.
+*
+*/
+
+#pragma once
+
+#include <chrono>
+#include <string>
+
+#include <fep3/fep3_errors.h>
+
+namespace fep3
+{
+namespace native
+{
+
+/**
+ * @brief Optional extension of IDataRegistry for registries passing the received data
+ * to their readers asynchronously
+ */
+class IDeliveryTrackingDataRegistry
+{
+protected:
+    /**
+     * @brief DTOR
+     */
+    virtual ~IDeliveryTrackingDataRegistry() = default;
+
+public:
+    /**
+     * @brief Blocks until the data received for the input signal @p signal_name so far
+     * has been passed to the readers and listeners of the signal
+     *
+     * @param signal_name name of the input signal
+     * @param timeout maximum time to wait
+     * @return ERR_NOERROR if the data was passed on or there is nothing to wait for
+     *         (no input signal @p signal_name is registered or the simulation bus does not track the delivery),
+     *         ERR_TIMEOUT if @p timeout elapsed before
+     */
+    virtual fep3::Result waitForDelivery(const std::string& signal_name, std::chrono::nanoseconds timeout) = 0;
+};
+
+} // namespace native
+} // namespace fep3
@@ -56,6 +56,12 @@ Json::Value RPCJobRegistry::getJobInfo(const std::string& job_name)
         json_value["job_configuration"]["runtime_violation_strategy"] = job_configuration.timeViolationStrategyAsString();
         json_value["job_configuration"]["jobs_this_depends_on"] = a_util::strings::join(
             job_configuration._jobs_this_depends_on, ",");
+        json_value["job_configuration"]["trigger_signals"] = a_util::strings::join(
+            job_configuration._trigger_signals, ",");
+        json_value["job_configuration"]["input_signals"] = a_util::strings::join(
+            job_configuration._input_signals, ",");
+        json_value["job_configuration"]["output_signals"] = a_util::strings::join(
+            job_configuration._output_signals, ",");
 
         return json_value;
     }
@@ -14,6 +14,7 @@
 
 #include <a_util/xml/dom.h>
 #include "a_util/filesystem.h"
+#include <fep3/base/thread/thread.h>
 
 using namespace a_util::xml;
 
@@ -40,6 +41,10 @@ constexpr auto timing_cfg_node_job_cycle_delay_time = "cycle_delay_time";
 constexpr auto timing_cfg_node_job_max_run_realtime = "max_run_realtime";
 constexpr auto timing_cfg_node_job_run_realtime_violation = "run_realtime_violation";
 constexpr auto timing_cfg_node_input_queue_size = "queue_size";
+constexpr auto timing_cfg_node_job_thread = "thread";
+constexpr auto timing_cfg_node_thread_cpu_affinity = "cpu_affinity";
+constexpr auto timing_cfg_node_thread_scheduling_policy = "scheduling_policy";
+constexpr auto timing_cfg_node_thread_priority = "priority";
 
 std::string err_msg_node_missing{ "Invalid timing configuration. Missing %s subnode \"%s\"." };
 std::string err_msg_node_empty{ "Invalid timing configuration. Invalid %s node value \"%s\". Node may not be empty." };
@@ -47,10 +52,12 @@ std::string err_msg_node_invalid{ "Invalid timing configuration. Invalid %s node
 
 
 Result reconfigureJobInfoByJobConfiguration(JobInfo& job_info,
-    const JobConfiguration& job_configuration)
+    const DataJobConfiguration& data_job_configuration)
 {
     using namespace std::chrono;
 
+    const auto& job_configuration = data_job_configuration._job_configuration;
+
     JobConfiguration config(Duration{ duration_cast<nanoseconds>(milliseconds{100}) });
     if (job_configuration._cycle_sim_time.count() <= 0)
     {
@@ -91,6 +98,25 @@ Result reconfigureJobInfoByJobConfiguration(JobInfo& job_info,
     }
     config._runtime_violation_strategy = job_configuration._runtime_violation_strategy;
 
+    const auto thread_configuration_validation = thread::validateConfiguration(job_configuration._thread_configuration);
+    if (isFailed(thread_configuration_validation))
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_INVALID_ARG,
+            a_util::strings::format("Invalid timing configuration. Invalid %s node value. %s.",
+                timing_cfg_node_job_thread, thread_configuration_validation.getDescription()).c_str());
+    }
+    config._thread_configuration = job_configuration._thread_configuration;
+
+    // the data references let a data flow scheduler derive the dependencies between the jobs
+    for (const auto& input : data_job_configuration._job_input_configurations)
+    {
+        config._input_signals.push_back(input.first);
+    }
+    for (const auto& output : data_job_configuration._job_output_configurations)
+    {
+        config._output_signals.push_back(output.first);
+    }
+
     FEP3_RETURN_IF_FAILED(job_info.reconfigure(config));
 
     return {};
@@ -218,6 +244,55 @@ Result parseRunTimeViolationStrategyNode(const DOMElement& dom_element, const st
     return {};
 }
 
+Result parseThreadNode(const DOMElement& job_dom_element, ThreadConfiguration& configuration_value)
+{
+    configuration_value = ThreadConfiguration();
+
+    // the thread node and all of its subnodes are optional
+    const auto thread_element = job_dom_element.getChild(timing_cfg_node_job_thread);
+    if (thread_element.isNull())
+    {
+        return {};
+    }
+
+    const auto cpu_affinity_element = thread_element.getChild(timing_cfg_node_thread_cpu_affinity);
+    if (!cpu_affinity_element.isNull())
+    {
+        if (isFailed(thread::parseCpuList(cpu_affinity_element.getData(), configuration_value._cpu_affinity)))
+        {
+            RETURN_ERROR_DESCRIPTION(ERR_INVALID_ARG, a_util::strings::format(err_msg_node_invalid.c_str(),
+                "thread", timing_cfg_node_thread_cpu_affinity, "Value has to be a list of cpus like '0,2-3'").c_str());
+        }
+    }
+
+    const auto scheduling_policy_element = thread_element.getChild(timing_cfg_node_thread_scheduling_policy);
+    if (!scheduling_policy_element.isNull())
+    {
+        configuration_value._scheduling_policy = ThreadConfiguration::schedulingPolicyFromString(scheduling_policy_element.getData());
+        if (ThreadConfiguration::SchedulingPolicy::unknown == configuration_value._scheduling_policy)
+        {
+            RETURN_ERROR_DESCRIPTION(ERR_INVALID_ARG, a_util::strings::format(err_msg_node_invalid.c_str(),
+                "thread", timing_cfg_node_thread_scheduling_policy, "Value has to be one of inherit, other, fifo or round_robin").c_str());
+        }
+    }
+
+    const auto priority_element = thread_element.getChild(timing_cfg_node_thread_priority);
+    if (!priority_element.isNull())
+    {
+        FEP3_RETURN_IF_FAILED(convertToIntegerIfValidValue(priority_element.getData(), [](const int value) {return value >= 0; },
+            configuration_value._priority, a_util::strings::format(err_msg_node_invalid.c_str(), "thread", timing_cfg_node_thread_priority, "Value has to be >= 0")));
+    }
+
+    const auto validation = thread::validateConfiguration(configuration_value);
+    if (isFailed(validation))
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_INVALID_ARG, a_util::strings::format(err_msg_node_invalid.c_str(),
+            "job", timing_cfg_node_job_thread, validation.getDescription()).c_str());
+    }
+
+    return {};
+}
+
 Result readInputInformationFromJobDOMElement(const DOMElement& job_dom_element,
     DataJobConfiguration& data_job_configuration)
 {
@@ -296,6 +371,8 @@ Result readJobInformationFromDOM(const DOMElement& participant_element,
             FEP3_RETURN_IF_FAILED(parseRunTimeViolationStrategyNode(job_element, timing_cfg_node_job_run_realtime_violation,
                 job_configuration._runtime_violation_strategy));
 
+            FEP3_RETURN_IF_FAILED(parseThreadNode(job_element, job_configuration._thread_configuration));
+
             DataJobConfiguration data_job_configuration{ job_configuration };
 
             FEP3_RETURN_IF_FAILED(readInputInformationFromJobDOMElement(job_element, data_job_configuration));
@@ -445,7 +522,7 @@ Result configureJobsByTimingConfiguration(Jobs& jobs,
                 participant_name.c_str(),
                 job.second.job_info.getName().c_str());
         }
-        FEP3_RETURN_IF_FAILED(reconfigureJobInfoByJobConfiguration(job.second.job_info, data_job_configuration->second._job_configuration));
+        FEP3_RETURN_IF_FAILED(reconfigureJobInfoByJobConfiguration(job.second.job_info, data_job_configuration->second));
     }
 
     return {};
@@ -14,7 +14,7 @@
 using namespace fep3;
 using namespace fep3::native;
 
-LoggingConfigTree::Node::Node(std::vector<std::string>& name, const LoggerFilterConfig& config, const Node& parent)
+LoggingConfigTree::Node::Node(std::vector<std::string>& name, const std::shared_ptr<const LoggerFilterConfig>& config, const Node& parent)
 {
     if (name.empty())
     {
@@ -30,7 +30,7 @@ LoggingConfigTree::Node::Node(std::vector<std::string>& name, const LoggerFilter
     }
 }
 
-void LoggingConfigTree::Node::setLoggerConfig(std::vector<std::string>& name, const LoggerFilterConfig& config)
+void LoggingConfigTree::Node::setLoggerConfig(std::vector<std::string>& name, const std::shared_ptr<const LoggerFilterConfig>& config)
 {
     if (name.empty())
     {
@@ -57,7 +57,7 @@ void LoggingConfigTree::Node::setLoggerConfig(std::vector<std::string>& name, co
     }
 }
 
-const LoggerFilterConfig& LoggingConfigTree::Node::getLoggerConfig(std::vector<std::string>& name) const
+const std::shared_ptr<const LoggerFilterConfig>& LoggingConfigTree::Node::getLoggerConfig(std::vector<std::string>& name) const
 {
     if (name.empty())
     {
@@ -81,20 +81,30 @@ const LoggerFilterConfig& LoggingConfigTree::Node::getLoggerConfig(std::vector<s
 
 
 LoggingConfigTree::LoggingConfigTree()
+    : _generation(std::make_shared<std::atomic<uint64_t>>(1))
 {
     //TODO: Do not define the default hard coded here
     LoggerFilterConfig default_config = { logging::Severity::info, {} };
-    _root_node = std::make_unique<Node>(default_config);
+    _root_node = std::make_unique<Node>(std::make_shared<const LoggerFilterConfig>(default_config));
 }
 
 void LoggingConfigTree::setLoggerConfig(const std::string& logger_name, const LoggerFilterConfig& config)
 {
     std::vector<std::string> name_parts = a_util::strings::split(logger_name, ".");
-    _root_node->setLoggerConfig(name_parts, config);
+    const auto shared_config = std::make_shared<const LoggerFilterConfig>(config);
+    std::lock_guard<std::mutex> lock(_sync_nodes);
+    _root_node->setLoggerConfig(name_parts, shared_config);
+    _generation->fetch_add(1, std::memory_order_acq_rel);
 }
 
-const LoggerFilterConfig& LoggingConfigTree::getLoggerConfig(const std::string& logger_name) const
+std::shared_ptr<const LoggerFilterConfig> LoggingConfigTree::getLoggerConfig(const std::string& logger_name) const
 {
     std::vector<std::string> name_parts = a_util::strings::split(logger_name, ".");
+    std::lock_guard<std::mutex> lock(_sync_nodes);
     return _root_node->getLoggerConfig(name_parts);
+}
+
+std::shared_ptr<const std::atomic<uint64_t>> LoggingConfigTree::getGeneration() const
+{
+    return _generation;
 }
\ No newline at end of file
@@ -14,8 +14,10 @@
 
 #include <a_util/concurrency/mutex.h>
 
+#include <atomic>
 #include <map>
 #include <memory>   // unique_ptr
+#include <mutex>
 #include <vector>
 
 namespace fep3
@@ -34,14 +36,15 @@ private:
     class Node
     {
     public:
-        Node(const LoggerFilterConfig& config) : _config(config) {}
-        Node(std::vector<std::string>& name, const LoggerFilterConfig& config, const Node& parent);
+        Node(const std::shared_ptr<const LoggerFilterConfig>& config) : _config(config) {}
+        Node(std::vector<std::string>& name, const std::shared_ptr<const LoggerFilterConfig>& config, const Node& parent);
 
-        void setLoggerConfig(std::vector<std::string>& name, const LoggerFilterConfig& config);
-        const LoggerFilterConfig& getLoggerConfig(std::vector<std::string>& name) const;
+        void setLoggerConfig(std::vector<std::string>& name, const std::shared_ptr<const LoggerFilterConfig>& config);
+        const std::shared_ptr<const LoggerFilterConfig>& getLoggerConfig(std::vector<std::string>& name) const;
 
     private:
-        LoggerFilterConfig _config;
+        /// shared with the child nodes inheriting it, never modified once set
+        std::shared_ptr<const LoggerFilterConfig> _config;
         std::map<std::string, Node> _child_nodes;
     };
 
@@ -59,20 +62,36 @@ public:
     void setLoggerConfig(const std::string& logger_name, const LoggerFilterConfig& config);
 
     /**
-    * @brief Returns a reference to the logging configuration set for the logger name.
+    * @brief Returns the logging configuration set for the logger name.
     *
     * If no specific configuration has been set, it will return the configuration of the next higher hierarchy level and so on.
     * If there is no configuration for any level it will return the default.
+    * The returned configuration is never modified, setLoggerConfig replaces it.
+    * So it may be used after the configuration was changed, i.e. until a log record is logged by the sinks.
     *
     * @param [in] logger_name The logger domain name for which configuration will be returned
     *
-    * @return A reference to a logging configuration.
+    * @return The logging configuration.
     */
-    const LoggerFilterConfig& getLoggerConfig(const std::string& logger_name) const;
+    std::shared_ptr<const LoggerFilterConfig> getLoggerConfig(const std::string& logger_name) const;
+
+    /**
+    * @brief Returns the generation counter of the configuration.
+    *
+    * The counter is incremented by every call of setLoggerConfig, so a configuration resolved by
+    * getLoggerConfig is still valid as long as the counter has the value read before resolving it.
+    * The counter is shared and may be read after the tree was destroyed.
+    *
+    * @return The generation counter.
+    */
+    std::shared_ptr<const std::atomic<uint64_t>> getGeneration() const;
 
 private:
     /// The root node holds the default configuration and has no name
     std::unique_ptr<Node> _root_node;
+    /// Incremented after every change of the configuration
+    std::shared_ptr<std::atomic<uint64_t>> _generation;
+    mutable std::mutex _sync_nodes;
 
 };
 } // namespace native
@@ -8,84 +8,266 @@
 * file, You can obtain one at https://mozilla.org/MPL/2.0/.
 */
 
-#include <cassert>
+#include <cstddef>
 
 #include "logging_queue.h"
 
+#include <fep3/base/thread/thread.h>
+
 using namespace fep3;
 using namespace fep3::native;
 
-static const uint32_t internal_max_msg_size = 255;
-static const uint64_t timer_intervall_us = 1000;
+constexpr size_t LoggingQueue::default_capacity;
 
-#pragma warning(disable:4355) // 'this' used in base member initializer list
-LoggingQueue::LoggingQueue()
-    : _log_timer(timer_intervall_us, &LoggingQueue::timerFunc, *this),
-    _internal_msg(internal_max_msg_size, '\0'),
-    _max_queue_slot_num(200),
-    _next_slot(0),
-    _queue_lvl(0)
+LoggingQueue::LoggingQueue(const std::function<void(const LogRecord&)>& handle_record,
+    size_t capacity,
+    OverflowPolicy overflow_policy,
+    const std::function<void(uint64_t)>& report_dropped)
+    : _handle_record(handle_record),
+    _capacity(capacity > 0 ? capacity : 1),
+    _overflow_policy(overflow_policy),
+    _report_dropped(report_dropped),
+    _slots(new Slot[_capacity])
 {
-    // these are for initialization only and should be statics....
-    // (which they were before anyway.)
-    _max_message_length = internal_max_msg_size;
-                                             // message + log level
-    _max_queue_mem_size = _max_queue_slot_num * (_max_message_length + sizeof(uint8_t));
-
-    if (!_message_mem.allocate(_max_queue_mem_size))
+    for (size_t index = 0; index < _capacity; ++index)
     {
-        assert(!"System out of memory!");
+        _slots[index].sequence.store(index, std::memory_order_relaxed);
     }
-    a_util::memory::set(_message_mem, 0, _message_mem.getSize());
-    _log_timer.start();
+    _consumer = std::thread([this]() { consume(); });
 }
 
 LoggingQueue::~LoggingQueue()
 {
-    _log_timer.stop();
+    {
+        std::lock_guard<std::mutex> lock(_wait_mutex);
+        _stop = true;
+    }
+    _record_available.notify_all();
+    _room_available.notify_all();
+    _consumer.join();
 }
 
-void LoggingQueue::timerFunc()
+fep3::Result LoggingQueue::add(LogRecord&& record)
 {
-    collectAndExecute();
+    while (!tryPush(record))
+    {
+        if (_overflow_policy == OverflowPolicy::drop_oldest)
+        {
+            LogRecord dropped;
+            if (tryPop(dropped))
+            {
+                _dropped_count.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        else if (_overflow_policy == OverflowPolicy::block
+            && std::this_thread::get_id() != _consumer.get_id()
+            && waitForRoom())
+        {
+            //try again
+        }
+        else
+        {
+            _dropped_count.fetch_add(1, std::memory_order_relaxed);
+            return ERR_MEMORY;
+        }
+    }
+
+    notifyConsumer();
+    return {};
+}
+
+uint64_t LoggingQueue::getDroppedCount() const
+{
+    return _dropped_count.load(std::memory_order_relaxed);
 }
 
-fep3::Result LoggingQueue::add(const std::function<void()>& fcn)
+size_t LoggingQueue::getCapacity() const
 {
-    a_util::concurrency::unique_lock<a_util::concurrency::recursive_mutex> oSync(_queue_guard);
+    return _capacity;
+}
 
-    fep3::Result res = ERR_NOERROR;
+LoggingQueue::OverflowPolicy LoggingQueue::getOverflowPolicy() const
+{
+    return _overflow_policy;
+}
 
-    if (_queue_lvl == _max_queue_slot_num)
+fep3::Result LoggingQueue::configureConsumerThread(const ThreadConfiguration& thread_configuration)
+{
+    FEP3_RETURN_IF_FAILED(thread::configure(_consumer, "__logging", thread_configuration));
+    _consumer_thread_configuration = thread_configuration;
+    return {};
+}
+
+ThreadConfiguration LoggingQueue::getConsumerThreadConfiguration() const
+{
+    return _consumer_thread_configuration;
+}
+
+bool LoggingQueue::parseOverflowPolicy(const std::string& name, OverflowPolicy& overflow_policy)
+{
+    if (name == "drop_oldest")
+    {
+        overflow_policy = OverflowPolicy::drop_oldest;
+    }
+    else if (name == "drop_newest")
+    {
+        overflow_policy = OverflowPolicy::drop_newest;
+    }
+    else if (name == "block")
+    {
+        overflow_policy = OverflowPolicy::block;
+    }
+    else
     {
-        // theres not even place for the warning message.
-        res = ERR_MEMORY;
+        return false;
     }
+    return true;
+}
 
-    if (isOk(res))
+bool LoggingQueue::tryPush(LogRecord& record)
+{
+    size_t position = _enqueue_position.load(std::memory_order_relaxed);
+    while (true)
     {
-        _function_queue.enqueue(std::move(fcn));
+        Slot& slot = _slots[position % _capacity];
+        const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+        if (difference == 0)
+        {
+            if (_enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                slot.record = std::move(record);
+                slot.sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (difference < 0)
+        {
+            //full
+            return false;
+        }
+        else
+        {
+            position = _enqueue_position.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool LoggingQueue::tryPop(LogRecord& record)
+{
+    size_t position = _dequeue_position.load(std::memory_order_relaxed);
+    while (true)
+    {
+        Slot& slot = _slots[position % _capacity];
+        const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+        if (difference == 0)
+        {
+            if (_dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                record = std::move(slot.record);
+                // release the filter of the slot, otherwise it is kept alive until the slot is overwritten
+                slot.record._filter.reset();
+                slot.sequence.store(position + _capacity, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (difference < 0)
+        {
+            //empty or the front record is not published yet
+            return false;
+        }
+        else
+        {
+            position = _dequeue_position.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool LoggingQueue::hasRecord() const
+{
+    const size_t position = _dequeue_position.load(std::memory_order_acquire);
+    return _slots[position % _capacity].sequence.load(std::memory_order_acquire) == position + 1;
+}
+
+bool LoggingQueue::hasRoom() const
+{
+    const size_t position = _enqueue_position.load(std::memory_order_acquire);
+    return _slots[position % _capacity].sequence.load(std::memory_order_acquire) == position;
+}
+
+bool LoggingQueue::waitForRoom()
+{
+    std::unique_lock<std::mutex> lock(_wait_mutex);
+    _waiting_producers.fetch_add(1, std::memory_order_acq_rel);
+    _room_available.wait(lock, [this]() { return _stop || hasRoom(); });
+    _waiting_producers.fetch_sub(1, std::memory_order_acq_rel);
+    //the consumer does not make room anymore after it was stopped
+    return !_stop;
+}
 
-        if (++_next_slot == _max_queue_slot_num)
+void LoggingQueue::notifyConsumer()
+{
+    // read-modify-write pairs with the increment in consume, so either the consumer sees the record or we see the consumer
+    if (_consumer_waiting.fetch_add(0, std::memory_order_acq_rel) > 0)
+    {
         {
-            // Circular queue overrun.
-            _next_slot = 0;
+            std::lock_guard<std::mutex> lock(_wait_mutex);
         }
-        ++_queue_lvl;
+        _record_available.notify_one();
     }
+}
 
-    return res;
+void LoggingQueue::notifyProducers()
+{
+    if (_waiting_producers.fetch_add(0, std::memory_order_acq_rel) > 0)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_wait_mutex);
+        }
+        _room_available.notify_all();
+    }
 }
 
-fep3::Result LoggingQueue::collectAndExecute()
+void LoggingQueue::consume()
 {
-    std::function<void()> entry = NULL;
-    if (_function_queue.tryDequeue(entry))
+    LogRecord record;
+    while (true)
     {
-        entry();
+        //handle everything pending in one go
+        while (tryPop(record))
+        {
+            notifyProducers();
+            _handle_record(record);
+        }
+        reportDropped();
+
+        std::unique_lock<std::mutex> lock(_wait_mutex);
+        _consumer_waiting.fetch_add(1, std::memory_order_acq_rel);
+        _record_available.wait(lock, [this]() { return _stop || hasRecord(); });
+        _consumer_waiting.fetch_sub(1, std::memory_order_acq_rel);
+        if (_stop)
+        {
+            lock.unlock();
+            while (tryPop(record))
+            {
+                _handle_record(record);
+            }
+            reportDropped();
+            return;
+        }
+    }
+}
 
-        --_queue_lvl;
-        return ERR_NOERROR;
+void LoggingQueue::reportDropped()
+{
+    const auto dropped_count = _dropped_count.load(std::memory_order_relaxed);
+    if (dropped_count != _reported_dropped_count)
+    {
+        if (_report_dropped)
+        {
+            _report_dropped(dropped_count - _reported_dropped_count);
+        }
+        _reported_dropped_count = dropped_count;
     }
-    return ERR_EMPTY;
 }
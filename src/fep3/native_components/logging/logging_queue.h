@@ -10,14 +10,18 @@
 
 #pragma once
 
-#include <atomic>   //std::atomic<int32_t>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 
-#include "a_util/concurrency.h"
-#include "a_util/memory.h"
-#include "a_util/system.h"
-#include "fep3/base/queue/fep3_locked_queue.h"
 #include "fep3/fep3_errors.h"
+#include <fep3/base/thread/thread_configuration.h>
+#include "logging_record.h"
 
 namespace fep3
 {
@@ -25,70 +29,139 @@ namespace native
 {
 namespace arya
 {
+/**
+ * Queue decoupling the loggers from the (physical) logging of the sinks.
+ * Any number of threads may add log records, one consumer thread passes them to the record handler.
+ * The consumer wakes up on add and handles all pending records in one go.
+ *
+ * The records are kept in a bounded ring buffer with a sequence number per slot,
+ * adding does not lock unless the consumer is waiting for records (and has to be woken up)
+ * or the queue is full and the overflow policy is OverflowPolicy::block.
+ */
 class LoggingQueue
 {
-
 public:
+    /// What happens to a record added while the queue is full
+    enum class OverflowPolicy
+    {
+        /// the oldest pending record is dropped in favour of the new one
+        drop_oldest,
+        /// the new record is dropped
+        drop_newest,
+        /// add waits until the consumer made room for the new record
+        block
+    };
+
+    /// Default number of pending records
+    static constexpr size_t default_capacity = 4096;
+
     /**
-     * Default constructor
-     * Using this to create the timer will assume a default cycle time of 1ms.
+     * CTOR, starts the consumer thread
+     * @param [in] handle_record called by the consumer thread for every record (i.e. to log it to its sinks)
+     * @param [in] capacity maximum number of pending records
+     * @param [in] overflow_policy what happens to records added while @p capacity records are pending
+     * @param [in] report_dropped called by the consumer thread with the number of records dropped
+     *                            since the last call, after the records added before were handled
      */
-    LoggingQueue();
+    explicit LoggingQueue(const std::function<void(const LogRecord&)>& handle_record,
+        size_t capacity = default_capacity,
+        OverflowPolicy overflow_policy = OverflowPolicy::drop_newest,
+        const std::function<void(uint64_t)>& report_dropped = {});
 
-    /// Default destructor
+    /// DTOR, handles the pending records and stops the consumer thread
     ~LoggingQueue();
 
-private: // override the worker function
+    LoggingQueue(const LoggingQueue&) = delete;
+    LoggingQueue(LoggingQueue&&) = delete;
+    LoggingQueue& operator=(const LoggingQueue&) = delete;
+    LoggingQueue& operator=(LoggingQueue&&) = delete;
+
+public:
     /**
-     * Timer function which is being called periodically upon each timer expiration.
+     * adds a log record that will be handled by the consumer thread
+     * @param [in] record the log record
+     * @retval ERR_NOERROR The record could be queued (with OverflowPolicy::drop_oldest
+     *                     an older record might have been dropped for it).
+     * @retval ERR_MEMORY The queue is full and the record is dropped
+     *                    (overflow policy OverflowPolicy::drop_newest or the queue is being destroyed).
+     * @remark With OverflowPolicy::block a record added by the consumer thread itself
+     *         (i.e. a sink logging while it logs) is dropped instead of blocking.
      */
-    void timerFunc();
+    fep3::Result add(LogRecord&& record);
 
-public:
     /**
-     * adds a function that will be executed from the queue
-     * @param [in] std::function the function itself
-     * @retval ERR_NOERROR The message could be queued.
-     * @retval ERR_MEMORY too many items in queue,
-     * number of characters too high or the queue is congested.
+     * @return the number of records dropped since construction
      */
-    fep3::Result add(const std::function<void()>& fcn);
+    uint64_t getDroppedCount() const;
+    /**
+     * @return the maximum number of pending records
+     */
+    size_t getCapacity() const;
+    /**
+     * @return the overflow policy
+     */
+    OverflowPolicy getOverflowPolicy() const;
 
+    /**
+     * names the consumer thread and applies the cpu affinity and scheduling of @p thread_configuration to it
+     * @param [in] thread_configuration the thread configuration
+     * @return the error if the thread could not be configured
+     */
+    fep3::Result configureConsumerThread(const ThreadConfiguration& thread_configuration);
+    /**
+     * @return the thread configuration the consumer thread was configured with last
+     */
+    ThreadConfiguration getConsumerThreadConfiguration() const;
 
+    /**
+     * Parses the overflow policy from its property value.
+     * @param [in] name one of "drop_oldest", "drop_newest" or "block"
+     * @param [out] overflow_policy the parsed overflow policy
+     * @return true if @p name is a valid overflow policy
+     */
+    static bool parseOverflowPolicy(const std::string& name, OverflowPolicy& overflow_policy);
 
 private:
-    /**
-    * Method called by the TimerFunc to publish a single queued message.
-    * @retval ERR_NOERROR Message has been logged successfully.
-    * @retval ERR_EMPTY Queue is empty.
-    */
-    fep3::Result collectAndExecute();
-    /// Maximum number of queue-slots
-    int _max_queue_slot_num;
-    /// Maximum number of characters per message.
-    int _max_message_length;
-    /// Total size of the memory allocated for the queue.
-    size_t _max_queue_mem_size;
-
-    /// The actual memory behind the queue.
-    a_util::memory::MemoryBuffer _message_mem;
-    /// The timer used to pipeline the physical logging
-    a_util::system::Timer _log_timer;
-    /// Mutex to guard the enqueues.
-    a_util::concurrency::recursive_mutex _queue_guard;
-    /// String holding internal messages
-    std::string _internal_msg;
-
-    /// Slot index to be used next
-    /// (note that his queue internally behaves like a circular buffer).
-    std::atomic<int32_t> _next_slot;
-    /// Number of slots currently in use by the queue.
-    std::atomic<int32_t> _queue_lvl;
-
-    /// The actual lock free queue
-    base::LockedQueue<std::function<void()>> _function_queue;
+    struct Slot
+    {
+        std::atomic<size_t> sequence{ 0 };
+        LogRecord record;
+    };
+
+    bool tryPush(LogRecord& record);
+    bool tryPop(LogRecord& record);
+    bool hasRecord() const;
+    bool hasRoom() const;
+    bool waitForRoom();
+    void notifyConsumer();
+    void notifyProducers();
+    void consume();
+    void reportDropped();
+
+private:
+    const std::function<void(const LogRecord&)> _handle_record;
+    const size_t _capacity;
+    const OverflowPolicy _overflow_policy;
+    const std::function<void(uint64_t)> _report_dropped;
+    std::unique_ptr<Slot[]> _slots;
+
+    std::atomic<size_t> _enqueue_position{ 0 };
+    std::atomic<size_t> _dequeue_position{ 0 };
+
+    std::atomic<uint64_t> _dropped_count{ 0 };
+    uint64_t _reported_dropped_count{ 0 };
+
+    std::mutex _wait_mutex;
+    std::condition_variable _record_available;
+    std::condition_variable _room_available;
+    std::atomic<size_t> _consumer_waiting{ 0 };
+    std::atomic<size_t> _waiting_producers{ 0 };
+    bool _stop{ false };
+
+    std::thread _consumer;
+    ThreadConfiguration _consumer_thread_configuration;
 };
 } // namespace arya
 using arya::LoggingQueue;
 } // namespace native
-} // namespace fep3
\ No newline at end of file
+} // namespace fep3
@@ -0,0 +1,136 @@
+/**
+* @file
+* Copyright &copy; Audi AG. All rights reserved.
+*
+* This Source Code Form is subject to the terms of the
+* Mozilla Public License, v. 2.0.
+* If a copy of the MPL was not distributed with this
+* file, You can obtain one at https://mozilla.org/MPL/2.0/.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "logging_config.h"
+
+namespace fep3
+{
+namespace native
+{
+namespace arya
+{
+/**
+ * Log record as it is passed from the loggers to the consumer of the logging queue.
+ * The names are interned (see @ref LogNameTable) and the time is kept as integer,
+ * the logging::LogMessage is created by the consumer only once for all sinks of the record.
+ * Messages up to inline_message_capacity characters do not allocate.
+ */
+struct LogRecord
+{
+    /// Maximum size of a message kept in the record itself
+    static constexpr size_t inline_message_capacity = 200;
+
+    /// Time of the clock service in nanoseconds
+    int64_t _time{ 0 };
+    /// The level of importance of the event
+    logging::Severity _severity{ logging::Severity::off };
+    /// Id of the participant name in the @ref LogNameTable
+    uint32_t _participant_id{ 0 };
+    /// Id of the logger name in the @ref LogNameTable
+    uint32_t _logger_id{ 0 };
+    /// The filter of the logger, contains the sinks to log the record to
+    std::shared_ptr<const LoggerFilterConfig> _filter;
+
+    /**
+     * Sets the message text of the record
+     * @param [in] message the message text
+     */
+    void setMessage(const std::string& message)
+    {
+        _message_size = message.size();
+        if (_message_size <= inline_message_capacity)
+        {
+            std::memcpy(_inline_message, message.data(), _message_size);
+            _long_message.clear();
+        }
+        else
+        {
+            _long_message = message;
+        }
+    }
+
+    /**
+     * @return the message text of the record
+     */
+    std::string getMessage() const
+    {
+        if (_message_size <= inline_message_capacity)
+        {
+            return std::string(_inline_message, _message_size);
+        }
+        return _long_message;
+    }
+
+private:
+    size_t _message_size{ 0 };
+    char _inline_message[inline_message_capacity];
+    std::string _long_message;
+};
+
+/**
+ * Table of the participant and logger names referenced by the @ref LogRecord.
+ * Names are only added, so an id stays valid as long as the table exists.
+ */
+class LogNameTable
+{
+public:
+    /**
+     * @param [in] name the name to intern
+     * @return the id of @p name, the same name always gets the same id
+     */
+    uint32_t intern(const std::string& name)
+    {
+        std::lock_guard<std::mutex> lock(_sync_names);
+        const auto found = _ids.find(name);
+        if (found != _ids.cend())
+        {
+            return found->second;
+        }
+        const auto id = static_cast<uint32_t>(_names.size());
+        _names.push_back(name);
+        _ids.emplace(name, id);
+        return id;
+    }
+
+    /**
+     * @param [in] id the id returned by @ref intern
+     * @return the name with the id @p id, an empty string if there is none
+     */
+    std::string getName(uint32_t id) const
+    {
+        std::lock_guard<std::mutex> lock(_sync_names);
+        if (id < _names.size())
+        {
+            return _names[id];
+        }
+        return {};
+    }
+
+private:
+    mutable std::mutex _sync_names;
+    std::map<std::string, uint32_t> _ids;
+    std::deque<std::string> _names;
+};
+
+} // namespace arya
+using arya::LogRecord;
+using arya::LogNameTable;
+} // namespace native
+} // namespace fep3
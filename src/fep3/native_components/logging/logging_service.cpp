@@ -10,13 +10,13 @@
 
 #include "logging_service.h"
 
-#include "logging_queue.h"
 #include "logging_rpc_service.h"
 
 #include "sinks/logging_sink_common.hpp"
 #include "sinks/logging_sink_file.hpp"
 #include "sinks/logging_sink_console.hpp"
 #include <fep3/components/service_bus/service_bus_intf.h>
+#include <fep3/base/thread/thread.h>
 
 #include <a_util/datetime.h>
 #include <a_util/strings.h>
@@ -24,8 +24,31 @@
 using namespace fep3;
 using namespace fep3::native;
 
+namespace
+{
+constexpr uint64_t filter_state_severity_bits = 8;
+
+uint64_t makeFilterState(uint64_t generation, logging::Severity severity)
+{
+    return (generation << filter_state_severity_bits) | static_cast<uint64_t>(severity);
+}
+
+uint64_t getGenerationOf(uint64_t filter_state)
+{
+    return filter_state >> filter_state_severity_bits;
+}
+
+logging::Severity getSeverityOf(uint64_t filter_state)
+{
+    return static_cast<logging::Severity>(filter_state & ((uint64_t{ 1 } << filter_state_severity_bits) - 1));
+}
+} // namespace
+
 LoggingService::Logger::Logger(LoggingService& logging_service, const std::string& logger_name)
-    : _logging_service(&logging_service), _logger_name(logger_name)
+    : _logger_name(logger_name),
+    _logger_id(logging_service._names.intern(logger_name)),
+    _logging_service(&logging_service),
+    _filter_generation(logging_service._configuration.getGeneration())
 {
 }
 
@@ -33,6 +56,10 @@ void LoggingService::Logger::releaseLogService()
 {
     std::lock_guard<std::recursive_mutex> lock(_sync_service_access);
     _logging_service = nullptr;
+    _filter.reset();
+    //nothing is enabled anymore, after the next change of the configuration the lookup finds no service
+    _filter_state.store(makeFilterState(_filter_generation->load(std::memory_order_acquire), logging::Severity::off),
+        std::memory_order_release);
 }
 
 fep3::Result LoggingService::Logger::logInfo(const std::string& message) const
@@ -62,92 +89,109 @@ fep3::Result LoggingService::Logger::logDebug(const std::string& message) const
 
 bool LoggingService::Logger::isInfoEnabled() const
 {
-    std::lock_guard<std::recursive_mutex> lock(_sync_service_access);
-    return (_logging_service 
-        && (logging::Severity::info <= _logging_service->_configuration.getLoggerConfig(_logger_name)._severity));
+    return isEnabled(logging::Severity::info);
 }
 
 bool LoggingService::Logger::isWarningEnabled() const
 {
-    std::lock_guard<std::recursive_mutex> lock(_sync_service_access);
-    return (_logging_service 
-        && (logging::Severity::warning <= _logging_service->_configuration.getLoggerConfig(_logger_name)._severity));
+    return isEnabled(logging::Severity::warning);
 }
 
 bool LoggingService::Logger::isErrorEnabled() const
 {
-    std::lock_guard<std::recursive_mutex> lock(_sync_service_access);
-    return (_logging_service 
-        && (logging::Severity::error <= _logging_service->_configuration.getLoggerConfig(_logger_name)._severity));
+    return isEnabled(logging::Severity::error);
 }
 
 bool LoggingService::Logger::isFatalEnabled() const
 {
-    std::lock_guard<std::recursive_mutex> lock(_sync_service_access);
-    return (_logging_service
-        && (logging::Severity::fatal <= _logging_service->_configuration.getLoggerConfig(_logger_name)._severity));
+    return isEnabled(logging::Severity::fatal);
 }
 
 bool LoggingService::Logger::isDebugEnabled() const
 {
+    return isEnabled(logging::Severity::debug);
+}
+
+bool LoggingService::Logger::isEnabled(logging::Severity severity) const
+{
+    //fast path: the filter resolved before is still up to date
+    const auto filter_state = _filter_state.load(std::memory_order_acquire);
+    if (getGenerationOf(filter_state) == _filter_generation->load(std::memory_order_acquire))
+    {
+        return severity <= getSeverityOf(filter_state);
+    }
+
     std::lock_guard<std::recursive_mutex> lock(_sync_service_access);
-    return (_logging_service
-        && (logging::Severity::debug <= _logging_service->_configuration.getLoggerConfig(_logger_name)._severity));
+    return (_logging_service && (severity <= getFilter()->_severity));
+}
+
+std::shared_ptr<const LoggerFilterConfig> LoggingService::Logger::getFilter() const
+{
+    //_sync_service_access is locked and _logging_service is valid
+    //the generation is read before resolving, a change in between makes the next call resolve again
+    const auto generation = _filter_generation->load(std::memory_order_acquire);
+    if (_filter && getGenerationOf(_filter_state.load(std::memory_order_acquire)) == generation)
+    {
+        return _filter;
+    }
+    _filter = _logging_service->_configuration.getLoggerConfig(_logger_name);
+    _filter_state.store(makeFilterState(generation, _filter->_severity), std::memory_order_release);
+    return _filter;
 }
 
 fep3::Result LoggingService::Logger::log(const std::string& message, logging::Severity severity) const
 {
-    std::lock_guard<std::recursive_mutex> lock(_sync_service_access);
-    fep3::Result result = ERR_NOERROR;
+    if (!isEnabled(severity))
+    {
+        return {};
+    }
 
-    // Get Metadata and create Log Message
-    std::string timestamp{ "0" };
-    std::string part_name{ };
-    if (_logging_service)
+    std::lock_guard<std::recursive_mutex> lock(_sync_service_access);
+    if (!_logging_service)
     {
-        if (_logging_service->_clock_service)
-        {
-            timestamp = a_util::strings::toString(_logging_service->_clock_service->getTime().count());
-        }
+        return {};
+    }
 
-        logging::LogMessage log_message = {
-            timestamp,
-            severity,
-            _logging_service->_participant_name,
-            _logger_name,
-            message };
+    // Get Configuration, the record is logged to the sinks of the filter by the consumer of the queue
+    auto filter = getFilter();
+    if (severity > filter->_severity || filter->_logging_sinks.empty())
+    {
+        return {};
+    }
 
-        // Get Configuration and log to all configured sinks
-        const LoggerFilterConfig& config = _logging_service->_configuration.getLoggerConfig(_logger_name);
-        if (severity <= config._severity)
-        {
-            for (const auto& logging_sink : config._logging_sinks)
-            {
-                std::unique_lock<std::mutex> guard(_logging_service->_lock_queue);
-                auto fcn = [log_message, logging_sink]()
-                {
-                    //potentiell an data race here
-                    //use an reference to an member that might be destroyed before
-                    //function is called
-                    logging_sink.second->log(log_message);
-                };
-                result |= _logging_service->_queue->add(fcn);
-            }
-        }
+    // Only the raw values are queued, the log message is created by the consumer
+    LogRecord record;
+    if (_logging_service->_clock_service)
+    {
+        record._time = _logging_service->_clock_service->getTime().count();
     }
+    record._severity = severity;
+    record._participant_id = _logging_service->_participant_id;
+    record._logger_id = _logger_id;
+    record._filter = std::move(filter);
+    record.setMessage(message);
 
-    return result;
+    return std::atomic_load(&_logging_service->_queue)->add(std::move(record));
 }
 
 LoggingService::LoggingService() : Configuration(FEP3_LOGGING_SERVICE_CONFIG)
 {
-    _queue = std::make_unique<LoggingQueue>();
     _default_sinks = std::string("console");
     _default_severity = static_cast<int32_t>(logging::Severity::info);
+    _queue_capacity = static_cast<int32_t>(LoggingQueue::default_capacity);
+    _queue_overflow_policy = std::string("drop_newest");
+    _thread_configuration = std::string("");
+    _participant_id = _names.intern(_participant_name);
+    _queue = createQueue(LoggingQueue::default_capacity, LoggingQueue::OverflowPolicy::drop_newest);
+    //the default configuration only names the consumer thread
+    _queue->configureConsumerThread(ThreadConfiguration());
 
     registerPropertyVariable(_default_sinks, FEP3_LOGGING_DEFAULT_SINKS_PROPERTY);
     registerPropertyVariable(_default_severity, FEP3_LOGGING_DEFAULT_SEVERITY_PROPERTY);
     registerPropertyVariable(_default_file_sink_file, FEP3_LOGGING_DEFAULT_FILE_SINK_PROPERTY);
+    registerPropertyVariable(_queue_capacity, FEP3_LOGGING_QUEUE_CAPACITY_PROPERTY);
+    registerPropertyVariable(_queue_overflow_policy, FEP3_LOGGING_QUEUE_OVERFLOW_POLICY_PROPERTY);
+    registerPropertyVariable(_thread_configuration, FEP3_LOGGING_THREAD_CONFIGURATION_PROPERTY);
 
     //init the default sinks
     registerSink("console", std::make_shared<LoggingSinkConsole>());
@@ -168,6 +212,9 @@ LoggingService::~LoggingService()
         logger->releaseLogService();
     }
     _loggers.clear();
+
+    //log the pending messages while the sinks are still there
+    std::atomic_store(&_queue, std::shared_ptr<LoggingQueue>());
 }
 
 fep3::Result LoggingService::create()
@@ -185,6 +232,7 @@ fep3::Result LoggingService::create()
             if (rpc_server)
             {
                 _participant_name = rpc_server->getName();
+                _participant_id = _names.intern(_participant_name);
                 _logging_rpc_service = std::make_shared<LoggingRPCService>(*this);
                 FEP3_RETURN_IF_FAILED(
                     rpc_server->registerService(::fep3::rpc::IRPCLoggingServiceDef::getRPCDefaultName(),
@@ -231,6 +279,49 @@ fep3::Result LoggingService::destroy()
     return {};
 }
 
+fep3::Result LoggingService::initialize()
+{
+    updatePropertyVariables();
+
+    const int32_t capacity = _queue_capacity;
+    if (capacity <= 0)
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_INVALID_ARG,
+            "Invalid logging queue capacity of %d. The capacity has to be > 0.", capacity);
+    }
+    const std::string overflow_policy_name = _queue_overflow_policy;
+    LoggingQueue::OverflowPolicy overflow_policy;
+    if (!LoggingQueue::parseOverflowPolicy(overflow_policy_name, overflow_policy))
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_INVALID_ARG,
+            "Invalid logging queue overflow policy '%s'. The overflow policy has to be 'drop_oldest', 'drop_newest' or 'block'.",
+            overflow_policy_name.c_str());
+    }
+    const std::string thread_configuration_string = _thread_configuration;
+    ThreadConfiguration thread_configuration;
+    const auto thread_configuration_result = thread::parseConfiguration(thread_configuration_string, thread_configuration);
+    if (isFailed(thread_configuration_result))
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_INVALID_ARG,
+            "Invalid logging thread configuration '%s'. %s",
+            thread_configuration_string.c_str(), thread_configuration_result.getDescription());
+    }
+
+    const auto queue = std::atomic_load(&_queue);
+    //a changed thread configuration is applied to a new consumer thread, because "inherit" does not undo a previous one
+    if (queue->getCapacity() != static_cast<size_t>(capacity)
+        || queue->getOverflowPolicy() != overflow_policy
+        || !(queue->getConsumerThreadConfiguration() == thread_configuration))
+    {
+        const auto new_queue = createQueue(static_cast<size_t>(capacity), overflow_policy);
+        FEP3_RETURN_IF_FAILED(new_queue->configureConsumerThread(thread_configuration));
+        //the replaced queue logs its pending messages when the last logger using it is done with it
+        std::atomic_store(&_queue, new_queue);
+        _dropped_count_of_replaced_queues += queue->getDroppedCount();
+    }
+    return {};
+}
+
 std::shared_ptr<ILoggingService::ILogger> LoggingService::createLogger(const std::string& logger_name)
 {
     std::lock_guard<std::recursive_mutex> lock(_sync_loggers);
@@ -296,9 +387,9 @@ fep3::Result LoggingService::setFilter(const std::string& logger_name,
 
 logging::LoggerFilter LoggingService::getFilter(const std::string& logger_name) const
 {
-    auto config = _configuration.getLoggerConfig(logger_name);
-    logging::LoggerFilter filter = { config._severity, {} };
-    for (const auto& current_sink : config._logging_sinks)
+    const auto config = _configuration.getLoggerConfig(logger_name);
+    logging::LoggerFilter filter = { config->_severity, {} };
+    for (const auto& current_sink : config->_logging_sinks)
     {
         filter._enabled_logging_sinks.push_back(current_sink.first);
     }
@@ -327,6 +418,58 @@ std::vector<std::string> LoggingService::getSinks() const
     return ret;
 }
 
+uint64_t LoggingService::getDroppedLogMessageCount() const
+{
+    const auto queue = std::atomic_load(&_queue);
+    return _dropped_count_of_replaced_queues + (queue ? queue->getDroppedCount() : 0);
+}
+
+std::shared_ptr<LoggingQueue> LoggingService::createQueue(size_t capacity, LoggingQueue::OverflowPolicy overflow_policy)
+{
+    return std::make_shared<LoggingQueue>(
+        [this](const LogRecord& record) { logRecord(record); },
+        capacity,
+        overflow_policy,
+        [this](uint64_t dropped_count) { reportDroppedLogMessages(dropped_count); });
+}
+
+void LoggingService::logRecord(const LogRecord& record)
+{
+    //called by the consumer thread of the queue, the message is formatted once for all sinks
+    const logging::LogMessage log_message = {
+        a_util::strings::toString(record._time),
+        record._severity,
+        _names.getName(record._participant_id),
+        _names.getName(record._logger_id),
+        record.getMessage() };
+
+    for (const auto& logging_sink : record._filter->_logging_sinks)
+    {
+        logging_sink.second->log(log_message);
+    }
+}
+
+void LoggingService::reportDroppedLogMessages(uint64_t dropped_count)
+{
+    //called by the consumer thread of the queue, so the report goes to the console directly
+    const auto console_sink = getSink("console");
+    if (console_sink)
+    {
+        std::string timestamp{ "0" };
+        if (_clock_service)
+        {
+            timestamp = a_util::strings::toString(_clock_service->getTime().count());
+        }
+        console_sink->log({ timestamp,
+            logging::Severity::warning,
+            _participant_name,
+            "logging_service",
+            a_util::strings::format("%llu log messages dropped, the logging queue is full. "
+                "Consider to increase the property " FEP3_LOGGING_QUEUE_CAPACITY ".",
+                static_cast<unsigned long long>(dropped_count)) });
+    }
+}
+
 std::shared_ptr<ILoggingService::ILoggingSink> LoggingService::getSink(const std::string& name) const
 {
     std::lock_guard<std::recursive_mutex> lock(_sync_sinks);
@@ -14,6 +14,7 @@
 #include <fep3/components/clock/clock_service_intf.h>
 #include <fep3/components/logging/logging_service_intf.h>
 #include "logging_config.h"
+#include "logging_queue.h"
 #include "logging_rpc_service.h"
 #include <fep3/components/configuration/propertynode.h>
 #include <fep3/components/configuration/configuration_service_intf.h>
@@ -26,7 +27,6 @@ namespace native
 namespace arya
 {
 class LoggingServer;
-class LoggingQueue;
 struct LoggingConfigDescription;
 
 class LoggingService : public ComponentBase<ILoggingService>,
@@ -52,12 +52,22 @@ public:
 
     private:
         fep3::Result log(const std::string& message, logging::Severity severity) const;
+        bool isEnabled(logging::Severity severity) const;
+        std::shared_ptr<const LoggerFilterConfig> getFilter() const;
         void releaseLogService();
 
     private:
         std::string _logger_name;
+        uint32_t _logger_id;
         LoggingService* _logging_service;
         mutable std::recursive_mutex _sync_service_access;
+        /// Generation counter of the configuration of the logging service
+        const std::shared_ptr<const std::atomic<uint64_t>> _filter_generation;
+        /// Filter resolved for the logger name, only accessed while _sync_service_access is locked
+        mutable std::shared_ptr<const LoggerFilterConfig> _filter;
+        /// Generation of the configuration _filter was resolved from (upper bits) and its severity (lowest byte),
+        /// lets the isXxxEnabled checks get along without locking as long as the configuration is unchanged
+        mutable std::atomic<uint64_t> _filter_state{ 0 };
     };
 
     LoggingService();
@@ -66,6 +76,7 @@ public:
     // Methods inherited from ComponentBase
     fep3::Result create() override;
     fep3::Result destroy() override;
+    fep3::Result initialize() override;
 
     // Methods inherited from ILoggingService
     std::shared_ptr<ILogger> createLogger(const std::string& logger_name) override;
@@ -83,18 +94,30 @@ public:
     std::shared_ptr<ILoggingSink> getSink(const std::string& name) const;
     std::vector<std::string> getLoggers() const;
     std::vector<std::string> getSinks() const;
+    /// @return the number of log messages dropped because the logging queue was full
+    uint64_t getDroppedLogMessageCount() const;
+
+private:
+    std::shared_ptr<LoggingQueue> createQueue(size_t capacity, LoggingQueue::OverflowPolicy overflow_policy);
+    void logRecord(const LogRecord& record);
+    void reportDroppedLogMessages(uint64_t dropped_count);
 
 private:
     /// RPC server object to set the logging configurations for this participant
     std::shared_ptr<LoggingRPCService> _logging_rpc_service;
     /// Queue object so that loggers don't halt the main program
-    std::unique_ptr<LoggingQueue> _queue;
-    mutable a_util::concurrency::mutex _lock_queue;
+    /// (only accessed by std::atomic_load and std::atomic_store, it is replaced if its configuration changes)
+    std::shared_ptr<LoggingQueue> _queue;
+    /// log messages dropped by the queues replaced before
+    std::atomic<uint64_t> _dropped_count_of_replaced_queues{ 0 };
     /// Configuration which logs should be filtered
     LoggingConfigTree _configuration;
     /// Pointer to the clock service to get the current timestamp for the log
-    IClockService* _clock_service;
+    IClockService* _clock_service{ nullptr };
     std::string    _participant_name;
+    /// Names of the participant and the loggers referenced by the log records
+    LogNameTable _names;
+    std::atomic<uint32_t> _participant_id{ 0 };
 
     std::vector<std::shared_ptr<Logger>> _loggers;
     mutable std::recursive_mutex _sync_loggers;
@@ -106,6 +129,9 @@ private:
     PropertyVariable<std::string> _default_sinks;
     PropertyVariable<std::string> _default_file_sink_file;
     PropertyVariable<int32_t> _default_severity;
+    PropertyVariable<int32_t> _queue_capacity;
+    PropertyVariable<std::string> _queue_overflow_policy;
+    PropertyVariable<std::string> _thread_configuration;
 };
 } // namespace arya
 using arya::LoggingService;
@@ -0,0 +1,142 @@
+/**
+* @file
+* Copyright &copy; AUDI AG. All rights reserved.
+*
+* This Source Code Form is subject to the terms of the
+* Mozilla Public License, v. 2.0.
+* If a copy of the MPL was not distributed with this
+* file, You can obtain one at https://mozilla.org/MPL/2.0/.
+*
+*/
+
+#include "job_worker_pool.h"
+
+#include <fep3/base/thread/thread.h>
+
+namespace fep3
+{
+namespace native
+{
+
+namespace
+{
+// index of the worker the current thread belongs to, used to post follow-up tasks to the own queue
+thread_local const JobWorkerPool* current_pool = nullptr;
+thread_local size_t current_worker_index = 0;
+} // namespace
+
+JobWorkerPool::JobWorkerPool(size_t thread_count)
+{
+    if (thread_count == 0)
+    {
+        thread_count = 1;
+    }
+    for (size_t count = 0; count < thread_count; ++count)
+    {
+        _workers.push_back(std::make_unique<Worker>());
+    }
+    for (size_t index = 0; index < _workers.size(); ++index)
+    {
+        _workers[index]->thread = std::thread([this, index]() { work(index); });
+    }
+}
+
+JobWorkerPool::~JobWorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(_wait_mutex);
+        _running = false;
+    }
+    _task_available.notify_all();
+
+    for (auto& worker : _workers)
+    {
+        if (worker->thread.joinable())
+        {
+            worker->thread.join();
+        }
+    }
+}
+
+void JobWorkerPool::post(Task task)
+{
+    const size_t worker_index = (current_pool == this)
+        ? current_worker_index
+        : _next_worker.fetch_add(1, std::memory_order_relaxed) % _workers.size();
+    {
+        auto& worker = *_workers[worker_index];
+        std::lock_guard<std::mutex> lock(worker.tasks_mutex);
+        worker.tasks.push_back(std::move(task));
+    }
+    {
+        std::lock_guard<std::mutex> lock(_wait_mutex);
+        ++_pending_tasks;
+    }
+    _task_available.notify_one();
+}
+
+size_t JobWorkerPool::getThreadCount() const
+{
+    return _workers.size();
+}
+
+fep3::Result JobWorkerPool::configureThreads(const std::string& name, const ThreadConfiguration& thread_configuration)
+{
+    for (size_t index = 0; index < _workers.size(); ++index)
+    {
+        FEP3_RETURN_IF_FAILED(thread::configure(_workers[index]->thread,
+            name + "_" + std::to_string(index),
+            thread_configuration));
+    }
+    return {};
+}
+
+bool JobWorkerPool::tryPop(size_t worker_index, Task& task)
+{
+    for (size_t offset = 0; offset < _workers.size(); ++offset)
+    {
+        auto& worker = *_workers[(worker_index + offset) % _workers.size()];
+        std::lock_guard<std::mutex> lock(worker.tasks_mutex);
+        if (!worker.tasks.empty())
+        {
+            task = std::move(worker.tasks.front());
+            worker.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void JobWorkerPool::work(size_t worker_index)
+{
+    current_pool = this;
+    current_worker_index = worker_index;
+
+    Task task;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_wait_mutex);
+            _task_available.wait(lock, [this]() { return _pending_tasks > 0 || !_running; });
+            if (_pending_tasks == 0)
+            {
+                break;
+            }
+            // claim one task, it is queued already because posting counts the task after queueing it
+            --_pending_tasks;
+        }
+
+        while (!tryPop(worker_index, task))
+        {
+            // another worker popped the task we claimed, so the task it claimed is still queued
+            std::this_thread::yield();
+        }
+        task();
+        task = nullptr;
+    }
+
+    current_pool = nullptr;
+}
+
+} // namespace native
+} // namespace fep3
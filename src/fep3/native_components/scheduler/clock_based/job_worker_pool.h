@@ -0,0 +1,94 @@
+/**
+* @file
+* Copyright &copy; AUDI AG. All rights reserved.
+*
+* This Source Code Form is subject to the terms of the
+* Mozilla Public License, v. 2.0.
+* If a copy of the MPL was not distributed with this
+* file, You can obtain one at https://mozilla.org/MPL/2.0/.
+*
+*/
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fep3/fep3_result_decl.h>
+#include <fep3/base/thread/thread_configuration.h>
+
+namespace fep3
+{
+namespace native
+{
+
+/**
+ * Fixed size pool of worker threads executing job runs as tasks.
+ *
+ * Every worker has its own task queue. Tasks posted from outside the pool are distributed round robin
+ * to the workers, tasks posted by a worker go to its own queue. A worker without tasks in its own queue
+ * steals the oldest task of another worker, so a long running job does not delay the tasks queued behind it.
+ * The pool does not serialize tasks, this has to be done by the task owner (see @ref PooledTimer).
+ */
+class JobWorkerPool
+{
+public:
+    using Task = std::function<void()>;
+
+    explicit JobWorkerPool(size_t thread_count);
+    ~JobWorkerPool();
+    JobWorkerPool(const JobWorkerPool&) = delete;
+    JobWorkerPool(JobWorkerPool&&) = delete;
+    JobWorkerPool& operator=(const JobWorkerPool&) = delete;
+    JobWorkerPool& operator=(JobWorkerPool&&) = delete;
+
+    /**
+     * Queues the @p task for execution by one of the workers. Does not block.
+     *
+     * @param task the task to execute
+     */
+    void post(Task task);
+
+    size_t getThreadCount() const;
+
+    /**
+     * Names the worker threads "<name>_<index>" and applies the cpu affinity and scheduling of the
+     * @p thread_configuration to all of them.
+     *
+     * @param name the name prefix of the worker threads
+     * @param thread_configuration the thread configuration
+     * @return the error of the first worker thread which could not be configured
+     */
+    fep3::Result configureThreads(const std::string& name, const ThreadConfiguration& thread_configuration);
+
+private:
+    struct Worker
+    {
+        std::mutex tasks_mutex;
+        std::deque<Task> tasks;
+        std::thread thread;
+    };
+
+    void work(size_t worker_index);
+    bool tryPop(size_t worker_index, Task& task);
+
+private:
+    std::vector<std::unique_ptr<Worker>> _workers;
+    std::atomic<size_t> _next_worker{ 0 };
+
+    std::mutex _wait_mutex;
+    std::condition_variable _task_available;
+    // count of posted tasks which are not claimed by a worker yet, guarded by _wait_mutex
+    size_t _pending_tasks{ 0 };
+    bool _running{ true };
+};
+
+} // namespace native
+} // namespace fep3
@@ -14,6 +14,8 @@
 
 #include <cassert>
 
+#include <fep3/base/thread/thread.h>
+
 #include "local_clock_based_scheduler.h"
 
 namespace fep3
@@ -48,7 +50,12 @@ fep3::Result ServiceThread::start()
         
     }
 
-    return{};
+    return thread::configure(_system_thread, _name, _thread_configuration);
+}
+
+void ServiceThread::setThreadConfiguration(const ThreadConfiguration& thread_configuration)
+{
+    _thread_configuration = thread_configuration;
 }
 
 void ServiceThread::operator()()
@@ -276,12 +283,139 @@ fep3::Result TimerThread::reset()
     return {};
 }
 
+PooledTimer::PooledTimer(const std::string& name,
+                         fep3::IJob& runnable,
+                         JobWorkerPool& worker_pool,
+                         TimerScheduler& timer_scheduler,
+                         const fep3::native::JobRunner& job_runner)
+    : _name(name)
+    , _runnable(runnable)
+    , _worker_pool(worker_pool)
+    , _timer_scheduler(timer_scheduler)
+    , _job_runner(job_runner)
+{
+}
+
+PooledTimer::~PooledTimer()
+{
+    stop();
+}
+
+fep3::Result PooledTimer::wakeUp(Timestamp wakeup_time, std::promise<void>* finished_promise)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (_cancelled)
+    {
+        if (finished_promise)
+        {
+            finished_promise->set_value();
+        }
+        return {};
+    }
+
+    _finished_promise = finished_promise;
+    _wakeup_time = wakeup_time;
+    _wakeup_pending = true;
+
+    if (!_scheduled)
+    {
+        _scheduled = true;
+        _worker_pool.post([this]() { execute(); });
+    }
+    return {};
+}
+
+void PooledTimer::execute()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _executing_thread = std::this_thread::get_id();
+
+    while (_wakeup_pending && !_cancelled)
+    {
+        _wakeup_pending = false;
+        const auto wakeup_time = _wakeup_time;
+        auto finished_promise = _finished_promise;
+        _finished_promise = nullptr;
+
+        // a reset after waking us up is signaled by the reset time, we won't run the job in that case
+        if (wakeup_time != reset_time
+            && (_last_call_time == reset_time || wakeup_time > _last_call_time))
+        {
+            lock.unlock();
+            _job_runner.runJob(wakeup_time, _runnable);
+            lock.lock();
+            _last_call_time = wakeup_time;
+        }
+
+        if (finished_promise)
+        {
+            finished_promise->set_value();
+        }
+    }
+
+    // a waiting scheduler must not be blocked by a cancelled timer
+    if (_finished_promise)
+    {
+        _finished_promise->set_value();
+        _finished_promise = nullptr;
+    }
+    _wakeup_pending = false;
+    _executing_thread = std::thread::id();
+    _scheduled = false;
+    _cv_idle.notify_all();
+}
+
+fep3::Result PooledTimer::start()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _cancelled = false;
+    _wakeup_time = reset_time;
+    _last_call_time = reset_time;
+    return {};
+}
+
+fep3::Result PooledTimer::stop()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _cancelled = true;
+    if (_executing_thread != std::this_thread::get_id())
+    {
+        _cv_idle.wait(lock, [this]() { return !_scheduled; });
+    }
+    return {};
+}
+
+fep3::Result PooledTimer::remove()
+{
+    return _timer_scheduler.removeTimer(*this);
+}
+
+fep3::Result PooledTimer::reset()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _wakeup_time = reset_time;
+    _last_call_time = reset_time;
+    return {};
+}
+
+std::string PooledTimer::getName() const
+{
+    return _name;
+}
+
 
 LocalClockBasedScheduler::LocalClockBasedScheduler(
     const std::shared_ptr<const fep3::ILoggingService::ILogger>& logger,
-    const std::function<fep3::Result()>& set_participant_to_error_state) :
+    const std::function<fep3::Result()>& set_participant_to_error_state,
+    const std::shared_ptr<JobStatisticsRegistry>& job_statistics,
+    const std::shared_ptr<const JobExecutionConfiguration>& job_execution_configuration) :
+         _job_execution_configuration(job_execution_configuration
+            ? job_execution_configuration
+            : std::make_shared<const JobExecutionConfiguration>()),
          _logger(logger),
-         _set_participant_to_error_state(set_participant_to_error_state)
+         _set_participant_to_error_state(set_participant_to_error_state),
+         _job_statistics(job_statistics)
 {
     if (!_logger)
     {
@@ -297,12 +431,46 @@ std::string LocalClockBasedScheduler::getName() const
 fep3::Result LocalClockBasedScheduler::initialize(fep3::IClockService& clock,
                                                  const Jobs& jobs)
 {   
+    const JobExecutionConfiguration job_execution_configuration = *_job_execution_configuration;
+
     _timer_scheduler= std::make_shared<TimerScheduler>(clock);   
+    _timer_scheduler->setParallelExecution(job_execution_configuration._parallel_job_execution);
+    _timer_scheduler->setSpinWindow(job_execution_configuration._timer_spin_window);
     FEP3_RETURN_IF_FAILED(clock.registerEventSink(_timer_scheduler));
 
     _clock = &clock;
 
     _service_thread = std::make_unique<ServiceThread>("__scheduler", *_timer_scheduler, clock, 0);
+    _service_thread->setThreadConfiguration(job_execution_configuration._scheduler_thread_configuration);
+
+    if (job_execution_configuration._job_worker_thread_count > 0)
+    {
+        _job_worker_pool = std::make_unique<JobWorkerPool>(job_execution_configuration._job_worker_thread_count);
+        FEP3_RETURN_IF_FAILED(_job_worker_pool->configureThreads("__job_worker",
+            job_execution_configuration._job_worker_thread_configuration));
+        for (auto& job : jobs)
+        {
+            // a job pinned to cpus or scheduled by a policy of its own keeps its own thread
+            if (!job.second.job_info.getConfig()._thread_configuration.isDefault())
+            {
+                auto timer_thread = createTimerThread(job.second, clock);
+
+                FEP3_RETURN_IF_FAILED(addTimerThreadToScheduler(job.second, timer_thread));
+                _timers.push_back(timer_thread);
+                continue;
+            }
+
+            auto pooled_timer = createPooledTimer(job.second);
+
+            FEP3_RETURN_IF_FAILED(_timer_scheduler->addTimer(*pooled_timer,
+                job.second.job_info.getConfig()._cycle_sim_time,
+                job.second.job_info.getConfig()._delay_sim_time,
+                job.second.job_info.getName(),
+                job.second.job_info.getConfig()._jobs_this_depends_on));
+            _pooled_timers.push_back(pooled_timer);
+        }
+        return{};
+    }
 
     for (auto& job : jobs)
     {   
@@ -321,7 +489,9 @@ fep3::Result LocalClockBasedScheduler::addTimerThreadToScheduler(
 {
     FEP3_RETURN_IF_FAILED(_timer_scheduler->addTimer(*timer_thread.get(),
         job_entry.job_info.getConfig()._cycle_sim_time,
-        job_entry.job_info.getConfig()._delay_sim_time));
+        job_entry.job_info.getConfig()._delay_sim_time,
+        job_entry.job_info.getName(),
+        job_entry.job_info.getConfig()._jobs_this_depends_on));
     
     return {};
 }
@@ -333,32 +503,69 @@ std::shared_ptr<fep3::native::TimerThread> LocalClockBasedScheduler::createTimer
 {
     const auto job_info = job_entry.job_info;
 
-    fep3::native::JobRunner job_runner(job_info.getName(),
-        job_info.getConfig()._runtime_violation_strategy,
-        job_info.getConfig()._max_runtime_real_time,
-        _logger,
-        _set_participant_to_error_state);
-
     auto timer_thread = std::make_shared<TimerThread>(job_info.getName(),
         *job_entry.job,
         clock,
         job_info.getConfig()._cycle_sim_time,
         job_info.getConfig()._delay_sim_time,      
         *_timer_scheduler,
-        job_runner);
+        createJobRunner(job_info));
+    timer_thread->setThreadConfiguration(job_info.getConfig()._thread_configuration);
 
     return timer_thread;
 }
 
+std::shared_ptr<fep3::native::PooledTimer> LocalClockBasedScheduler::createPooledTimer(
+    const fep3::JobEntry& job_entry)
+{
+    const auto job_info = job_entry.job_info;
+
+    return std::make_shared<PooledTimer>(job_info.getName(),
+        *job_entry.job,
+        *_job_worker_pool,
+        *_timer_scheduler,
+        createJobRunner(job_info));
+}
+
+fep3::native::JobRunner LocalClockBasedScheduler::createJobRunner(const fep3::JobInfo& job_info) const
+{
+    return fep3::native::JobRunner(job_info.getName(),
+        job_info.getConfig()._runtime_violation_strategy,
+        job_info.getConfig()._max_runtime_real_time,
+        _logger,
+        _set_participant_to_error_state,
+        _job_statistics ? _job_statistics->getJobStatistics(job_info.getName()) : nullptr,
+        _clock);
+}
+
 fep3::Result LocalClockBasedScheduler::start()
 {
+    fep3::Result result;
     for (auto& timer : _timers)
     {
-        timer->start();
+        // the thread of a timer is running even if configuring it failed, so all timers are started to be stopped consistently
+        const auto timer_result = timer->start();
+        if (isFailed(timer_result) && isOk(result))
+        {
+            result = timer_result;
+        }
+    }
+    for (auto& pooled_timer : _pooled_timers)
+    {
+        pooled_timer->start();
+    }
+    if (isFailed(result))
+    {
+        stop();
+        return result;
     }
     FEP3_RETURN_IF_FAILED(_timer_scheduler->start());
-    FEP3_RETURN_IF_FAILED(_service_thread->start());
-    return{};
+    result = _service_thread->start();
+    if (isFailed(result))
+    {
+        stop();
+    }
+    return result;
 }
 
 fep3::Result LocalClockBasedScheduler::stop()
@@ -372,6 +579,10 @@ fep3::Result LocalClockBasedScheduler::stop()
     {
         timer->stop();
     }
+    for (auto& pooled_timer : _pooled_timers)
+    {
+        pooled_timer->stop();
+    }
 
     if (_service_thread)
     {
@@ -392,9 +603,15 @@ fep3::Result LocalClockBasedScheduler::deinitialize()
     {
         timer->remove();
     }
+    for (auto& pooled_timer : _pooled_timers)
+    {
+        pooled_timer->remove();
+    }
     _timer_scheduler.reset();
     _service_thread.reset();
     _timers.clear();
+    _pooled_timers.clear();
+    _job_worker_pool.reset();
     return{};
 }
 
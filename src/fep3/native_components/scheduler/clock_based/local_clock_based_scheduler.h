@@ -25,10 +25,13 @@
 #include <chrono>
 #include <thread>
 
+#include "job_worker_pool.h"
 #include "timer_scheduler_impl.h"
 #include <fep3/native_components/scheduler/job_runner.h>
 #include <fep3/components/clock/clock_service_intf.h>
 #include <fep3/components/job_registry/job_configuration.h>
+#include <fep3/base/thread/thread_configuration.h>
+#include <fep3/native_components/scheduler/job_execution_configuration.h>
 
 namespace fep3
 {
@@ -55,6 +58,14 @@ public:
     fep3::Result start();
     fep3::Result detach();
 
+    /**
+     * @brief Sets the cpu affinity and scheduling the thread is configured with on the next call of @ref start.
+     * The thread is named by the name of the service thread in any case.
+     *
+     * @param thread_configuration the thread configuration
+     */
+    void setThreadConfiguration(const ThreadConfiguration& thread_configuration);
+
     bool isCurrent() const;
     std::string getName() const;
 
@@ -73,6 +84,7 @@ private:
     uint32_t _flags;
     std::mutex _mutex_thread;
     bool _thread_cancelled = false;
+    ThreadConfiguration _thread_configuration;
 };
 
 
@@ -126,12 +138,78 @@ private:
 };
 
 
+/**
+ * @brief Timer executing its job as a task of a @ref JobWorkerPool instead of an own thread.
+ * The job is never executed concurrently to itself: wakeups while the job is queued or running
+ * are merged into the next execution, like the @ref TimerThread does.
+ */
+class PooledTimer : public ITimer
+{
+public:
+    PooledTimer(const std::string& name,
+        fep3::IJob& runnable,
+        JobWorkerPool& worker_pool,
+        TimerScheduler& timer_scheduler,
+        const fep3::native::JobRunner& job_runner);
+
+    ~PooledTimer();
+    /**
+     * @brief Wakes up our timer. Will be called by TimerScheduler::processSchedulerQueueAsynchron
+     * and TimerScheduler::processSchedulerQueueSynchron.
+     * Queues the execution of the job in the worker pool if it is not queued or running already.
+     */
+    fep3::Result wakeUp(Timestamp wakeup_time, std::promise<void>* finished = nullptr) override;
+    fep3::Result start();
+    /**
+     * @brief Stops the timer and waits until a queued or running execution of the job has finished
+     * (unless called by the job itself).
+     */
+    fep3::Result stop();
+    fep3::Result remove();
+    fep3::Result reset() override;
+
+    std::string getName() const;
+
+private:
+    void execute();
+
+private:
+    std::string _name;
+    fep3::IJob& _runnable;
+    JobWorkerPool& _worker_pool;
+    TimerScheduler& _timer_scheduler;
+    fep3::native::JobRunner _job_runner;
+
+    std::mutex _mutex;
+    std::condition_variable _cv_idle;
+    bool _cancelled = true;
+    bool _wakeup_pending = false;
+    // the job is queued in the worker pool or running
+    bool _scheduled = false;
+    std::thread::id _executing_thread;
+    std::promise<void>* _finished_promise = nullptr;
+    Timestamp _wakeup_time{ reset_time };
+    Timestamp _last_call_time{ reset_time };
+};
+
+
 class LocalClockBasedScheduler : public fep3::IScheduler
 {
 public:
+    /**
+     * @param logger logger of the scheduler
+     * @param set_participant_to_error_state called if a job exceeds its maximum runtime
+     *                                       and its strategy is @ref fep3::JobConfiguration::TimeViolationStrategy::set_stm_to_error
+     * @param job_statistics the runtime statistics of the jobs are recorded to, optional
+     * @param job_execution_configuration configuration of the threads executing the jobs, read on @ref initialize.
+     *                                    A job worker thread count of 0 executes every job in its own thread,
+     *                                    the defaults are used if not set.
+     */
     LocalClockBasedScheduler(
         const std::shared_ptr<const fep3::ILoggingService::ILogger>& logger,
-        const std::function<fep3::Result()>& set_participant_to_error_state);
+        const std::function<fep3::Result()>& set_participant_to_error_state,
+        const std::shared_ptr<JobStatisticsRegistry>& job_statistics = {},
+        const std::shared_ptr<const JobExecutionConfiguration>& job_execution_configuration = {});
     ~LocalClockBasedScheduler() = default;
 
 public:
@@ -151,12 +229,20 @@ private:
         const fep3::JobEntry & job_entry,
          std::shared_ptr<fep3::native::TimerThread>);
 
+    std::shared_ptr<fep3::native::PooledTimer> createPooledTimer(const fep3::JobEntry& job_entry);
+
+    fep3::native::JobRunner createJobRunner(const fep3::JobInfo& job_info) const;
+
 private:
     std::unique_ptr<ServiceThread> _service_thread;
     std::shared_ptr<TimerScheduler> _timer_scheduler;
     std::list<std::shared_ptr<TimerThread>> _timers;
+    std::shared_ptr<const JobExecutionConfiguration> _job_execution_configuration;
+    std::unique_ptr<JobWorkerPool> _job_worker_pool;
+    std::list<std::shared_ptr<PooledTimer>> _pooled_timers;
     std::shared_ptr<const fep3::ILoggingService::ILogger> _logger;
     std::function<fep3::Result()> _set_participant_to_error_state;
+    std::shared_ptr<JobStatisticsRegistry> _job_statistics;
     fep3::IClockService* _clock = nullptr;
 };
 
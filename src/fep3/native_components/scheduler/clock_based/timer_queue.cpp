@@ -0,0 +1,149 @@
+/**
+* @file
+* Copyright &copy; AUDI AG. All rights reserved.
+*
+* This Source Code Form is subject to the terms of the
+* Mozilla Public License, v. 2.0.
+* If a copy of the MPL was not distributed with this
+* file, You can obtain one at https://mozilla.org/MPL/2.0/.
+*
+*/
+
+#include "timer_queue.h"
+
+#include <cassert>
+#include <utility>
+
+namespace fep3
+{
+namespace native
+{
+
+bool TimerQueue::empty() const
+{
+    return _heap.empty();
+}
+
+size_t TimerQueue::size() const
+{
+    return _heap.size();
+}
+
+void TimerQueue::push(TimerInfo timer_info, Timestamp next_instant)
+{
+    const auto index = timer_info._index;
+    _heap.push_back({ next_instant - _offset, index, std::make_unique<TimerInfo>(std::move(timer_info)) });
+    siftUp(_heap.size() - 1);
+}
+
+bool TimerQueue::remove(const ITimer* timer)
+{
+    for (size_t position = 0; position < _heap.size(); ++position)
+    {
+        if (_heap[position]._timer_info->_timer == timer)
+        {
+            _heap[position] = std::move(_heap.back());
+            _heap.pop_back();
+            if (position < _heap.size())
+            {
+                // the moved entry may belong above or below the removed one
+                siftUp(position);
+                siftDown(position);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+const TimerInfo& TimerQueue::top() const
+{
+    assert(!_heap.empty());
+    return *_heap.front()._timer_info;
+}
+
+Timestamp TimerQueue::topInstant() const
+{
+    assert(!_heap.empty());
+    return _heap.front()._next_instant + _offset;
+}
+
+void TimerQueue::rescheduleTop(Timestamp next_instant)
+{
+    assert(!_heap.empty());
+    const auto relative_instant = next_instant - _offset;
+    const auto moves_later = relative_instant >= _heap.front()._next_instant;
+    _heap.front()._next_instant = relative_instant;
+    if (moves_later)
+    {
+        siftDown(0);
+    }
+}
+
+void TimerQueue::pop()
+{
+    assert(!_heap.empty());
+    _heap.front() = std::move(_heap.back());
+    _heap.pop_back();
+    if (!_heap.empty())
+    {
+        siftDown(0);
+    }
+}
+
+void TimerQueue::shift(Duration time_diff)
+{
+    // the order of the timers does not change, so only the offset is moved
+    _offset += time_diff;
+}
+
+bool TimerQueue::isBefore(const Entry& lhs, const Entry& rhs)
+{
+    if (lhs._next_instant != rhs._next_instant)
+    {
+        return lhs._next_instant < rhs._next_instant;
+    }
+    return lhs._index < rhs._index;
+}
+
+void TimerQueue::siftUp(size_t position)
+{
+    while (position > 0)
+    {
+        const auto parent = (position - 1) / 2;
+        if (!isBefore(_heap[position], _heap[parent]))
+        {
+            break;
+        }
+        std::swap(_heap[position], _heap[parent]);
+        position = parent;
+    }
+}
+
+void TimerQueue::siftDown(size_t position)
+{
+    const auto size = _heap.size();
+    while (true)
+    {
+        auto first = position;
+        const auto left = 2 * position + 1;
+        const auto right = left + 1;
+        if (left < size && isBefore(_heap[left], _heap[first]))
+        {
+            first = left;
+        }
+        if (right < size && isBefore(_heap[right], _heap[first]))
+        {
+            first = right;
+        }
+        if (first == position)
+        {
+            break;
+        }
+        std::swap(_heap[position], _heap[first]);
+        position = first;
+    }
+}
+
+} // namespace native
+} // namespace fep3
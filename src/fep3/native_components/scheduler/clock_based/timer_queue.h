@@ -0,0 +1,125 @@
+/**
+* @file
+* Copyright &copy; AUDI AG. All rights reserved.
+*
+* This Source Code Form is subject to the terms of the
+* Mozilla Public License, v. 2.0.
+* If a copy of the MPL was not distributed with this
+* file, You can obtain one at https://mozilla.org/MPL/2.0/.
+*
+*/
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fep3/fep3_duration.h>
+#include <fep3/fep3_timestamp.h>
+
+namespace fep3
+{
+namespace native
+{
+
+class ITimer;
+
+/**
+ * Timer registered at the @ref TimerScheduler.
+ */
+struct TimerInfo
+{
+    ITimer* _timer;
+    Duration _period;
+    std::string _name;
+    // names of the timers which have to finish before this one is woken up at the same instant
+    std::vector<std::string> _dependencies;
+    // order in which the timer was added, timers due at the same instant are woken up in this order
+    size_t _index;
+};
+
+/**
+ * Priority queue of the timers of the @ref TimerScheduler ordered by their next instant
+ * and, for timers due at the same instant, by the order they were added in.
+ *
+ * The queue is a binary heap: the next due timer is peeked in O(1), adding and rescheduling
+ * a timer is done in O(log n). The instants are stored relative to an offset, so shifting
+ * all timers by a time reset is done in O(1).
+ * The queue is not thread safe.
+ */
+class TimerQueue
+{
+public:
+    bool empty() const;
+    size_t size() const;
+
+    /**
+     * Adds the timer @p timer_info due at @p next_instant.
+     */
+    void push(TimerInfo timer_info, Timestamp next_instant);
+    /**
+     * Removes the first timer found for @p timer.
+     *
+     * @return false if no timer was found
+     */
+    bool remove(const ITimer* timer);
+
+    /**
+     * @pre the queue is not empty
+     * @return the next due timer
+     */
+    const TimerInfo& top() const;
+    /**
+     * @pre the queue is not empty
+     * @return the instant the next due timer is due at
+     */
+    Timestamp topInstant() const;
+    /**
+     * Moves the next due timer to @p next_instant.
+     * @pre the queue is not empty
+     */
+    void rescheduleTop(Timestamp next_instant);
+    /**
+     * Removes the next due timer.
+     * @pre the queue is not empty
+     */
+    void pop();
+
+    /**
+     * Shifts the instants of all timers by @p time_diff.
+     */
+    void shift(Duration time_diff);
+
+    /**
+     * Calls @p function for every timer in unspecified order.
+     */
+    template <typename Function>
+    void forEach(Function function) const
+    {
+        for (const auto& entry : _heap)
+        {
+            function(*entry._timer_info);
+        }
+    }
+
+private:
+    struct Entry
+    {
+        // relative to _offset
+        Timestamp _next_instant;
+        size_t _index;
+        std::unique_ptr<TimerInfo> _timer_info;
+    };
+
+    static bool isBefore(const Entry& lhs, const Entry& rhs);
+    void siftUp(size_t position);
+    void siftDown(size_t position);
+
+private:
+    std::vector<Entry> _heap;
+    Duration _offset{ 0 };
+};
+
+} // namespace native
+} // namespace fep3
@@ -12,6 +12,7 @@
 
 #include "timer_scheduler_impl.h"
 
+#include <algorithm>
 #include <cassert>
 #include <stddef.h>
 #include <chrono>
@@ -46,32 +47,42 @@ void TimerScheduler::initBlockSchedulingStart()
 	_block_scheduling_start = IClock::ClockType::continuous == getClockType();
 }
 
-fep3::Result TimerScheduler::addTimer(ITimer& timer, Duration period, Duration initial_delay)
+fep3::Result TimerScheduler::addTimer(ITimer& timer,
+    Duration period,
+    Duration initial_delay,
+    const std::string& name,
+    const std::vector<std::string>& dependencies)
 {
     std::unique_lock<std::mutex> lock(_mutex_timer);
 
-    _timers.push_back({&timer, getTime() + initial_delay, period});
-    _cv_trigger_event.notify_all();
+    _timers.push({&timer, period, name, dependencies, _next_timer_index++}, getTime() + initial_delay);
+    triggerEvent();
     return{};
 }
 
 fep3::Result TimerScheduler::removeTimer(ITimer& oTimer)
 {
     std::unique_lock<std::mutex> lock(_mutex_timer);
-    for (auto it = _timers.begin();
-         it != _timers.end(); ++it)
+    if (_timers.remove(&oTimer))
     {
-        if (it->_timer == &oTimer)
-        {
-            _timers.erase(it);
-            return{};
-        }
+        return{};
     }
 
     RETURN_ERROR_DESCRIPTION(fep3::ERR_NOT_FOUND, "Timer not found");
 }
 
 
+void TimerScheduler::setSpinWindow(Duration spin_window)
+{
+    _spin_window = std::max(spin_window, Duration(0));
+}
+
+void TimerScheduler::setParallelExecution(bool parallel_execution)
+{
+    std::lock_guard<std::mutex> processing_lock(_mutex_processing_lock);
+    _parallel_execution = parallel_execution;
+}
+
 fep3::Result TimerScheduler::start()
 {   
     _cancelled = false;
@@ -99,7 +110,7 @@ fep3::Result TimerScheduler::stop()
     _cancelled = true;
     _started = false;
     _startup_reset_time = fep3::Optional<Timestamp>();
-    _cv_trigger_event.notify_all();
+    triggerEvent();
 
     return{};
 }
@@ -118,74 +129,43 @@ void TimerScheduler::processSchedulerQueueSynchron(Timestamp current_time, fep3:
     // the scheduler thread or the OnTimeUpdate method must process the queue exclusively.
     std::lock_guard<std::mutex> processing_lock(_mutex_processing_lock);
 
-    // because the asynchronous version does not sort the list we must do this first
-    {
-        std::lock_guard<std::mutex> timers_lock(_mutex_timer);
-        // have a look at the operator implementation in the header
-        _timers.sort();
-    }
-
     while (true)
     {
         std::unique_lock<std::mutex> timers_lock(_mutex_timer);
 
-        auto timer_it = _timers.begin();
-        if (timer_it == _timers.end())
+        if (_timers.empty())
         {
             break; // while
         }
 
-        if (timer_it->_next_instant != Timestamp(0) &&
-            timer_it->_next_instant > current_time)
+        const auto instant = _timers.topInstant();
+        if (instant > current_time)
         {
-            time_to_wait = timer_it->_next_instant - current_time;
+            time_to_wait = instant - current_time;
             break; // while
         }
 
-        TimerInfo timer_info = *timer_it;   // copy timer info
-        //we remember the simulated time step 
-        const auto current_time_for_call = timer_info._next_instant;
-
-        if (timer_it->_period != Duration(0))
+        if (_parallel_execution)
         {
-            // if the scheduler item has a period time, we have to
-            // reinsert with a new timestamp
-            timer_it->_next_instant += timer_it->_period;
-            // don't resynchronize with the clock because
-            // WE MUST CALL ALL THREADLOOPS of the item
-            // maybe the item will resynchronize it self
-
-            // iterate over the other items to find the next execution slot
-            auto other_timer_it = _timers.begin();
-            for (; other_timer_it != _timers.end(); ++other_timer_it)
+            // collect all timers due at the same instant, the queue yields them in the order they were added in
+            _due_timers.clear();
+            while (!_timers.empty() && _timers.topInstant() == instant)
             {
-                if(other_timer_it->_next_instant <= current_time)
-                {
-                    // skip tasks which are delayed on the planned execution time
-                    // to give them a chance to work (e.g. OneShotTimer). See #22389
-                    // for more information
-                    continue;
-                }
-                if (timer_it->_next_instant < other_timer_it->_next_instant)
-                {
-                    // break if the eventtime is smaller than the eventtime of the next item
-                    break;
-                }
+                _due_timers.push_back(_timers.top());
+                rescheduleFirstTimer();
             }
 
-            if (other_timer_it != timer_it)
-            {
-                // insert the scheduleritem at the found place
-                _timers.splice(other_timer_it, _timers, timer_it);
-            }
-
-        }
-        else
-        {
-            // erase the scheduler item from list (OneShotTimer)
-            _timers.erase(timer_it);
+            timers_lock.unlock();
+            wakeUpTimersInParallel(instant);
+            continue;
         }
 
+        TimerInfo timer_info = _timers.top();   // copy timer info
+        //we remember the simulated time step 
+        const auto current_time_for_call = instant;
+
+        rescheduleFirstTimer();
+
         std::promise<void> finished_promise;
         timer_info._timer->wakeUp(current_time_for_call, &finished_promise);
 
@@ -199,11 +179,79 @@ void TimerScheduler::processSchedulerQueueSynchron(Timestamp current_time, fep3:
         || (time_to_wait.has_value() && time_to_wait.value() > Duration(0)));
 }
 
+void TimerScheduler::rescheduleFirstTimer()
+{
+    // _mutex_timer has to be locked by the caller
+    const auto& timer_info = _timers.top();
+    if (timer_info._period != Duration(0))
+    {
+        // if the scheduler item has a period time, we have to
+        // reschedule it with a new timestamp
+        // don't resynchronize with the clock because
+        // WE MUST CALL ALL THREADLOOPS of the item
+        // maybe the item will resynchronize it self
+        _timers.rescheduleTop(_timers.topInstant() + timer_info._period);
+    }
+    else
+    {
+        // erase the scheduler item (OneShotTimer)
+        _timers.pop();
+    }
+}
+
+void TimerScheduler::wakeUpTimersInParallel(Timestamp wakeup_time)
+{
+    std::vector<const TimerInfo*> remaining_timers;
+    for (const auto& timer_info : _due_timers)
+    {
+        remaining_timers.push_back(&timer_info);
+    }
+
+    const auto is_remaining = [&remaining_timers](const std::string& name)
+    {
+        return std::any_of(remaining_timers.begin(), remaining_timers.end(),
+            [&name](const TimerInfo* timer_info) { return timer_info->_name == name; });
+    };
+
+    std::vector<const TimerInfo*> released_timers;
+    while (!remaining_timers.empty())
+    {
+        // release every timer which does not depend on a timer not finished yet
+        released_timers.clear();
+        for (const auto timer_info : remaining_timers)
+        {
+            if (std::none_of(timer_info->_dependencies.begin(), timer_info->_dependencies.end(), is_remaining))
+            {
+                released_timers.push_back(timer_info);
+            }
+        }
+        if (released_timers.empty())
+        {
+            // cyclic dependencies can not be resolved, so the remaining timers are released together
+            released_timers = remaining_timers;
+        }
+        remaining_timers.erase(std::remove_if(remaining_timers.begin(), remaining_timers.end(),
+            [&released_timers](const TimerInfo* timer_info)
+            {
+                return std::find(released_timers.begin(), released_timers.end(), timer_info) != released_timers.end();
+            }), remaining_timers.end());
+
+        std::vector<std::promise<void>> finished_promises(released_timers.size());
+        for (size_t index = 0; index < released_timers.size(); ++index)
+        {
+            released_timers[index]->_timer->wakeUp(wakeup_time, &finished_promises[index]);
+        }
+        // barrier: all released timers have to finish before the next ones are released
+        for (auto& finished_promise : finished_promises)
+        {
+            finished_promise.get_future().wait();
+        }
+    }
+}
+
 void TimerScheduler::processSchedulerQueueAsynchron(Timestamp current_time, Optional<Duration>& time_to_wait)
 {
     assert(current_time >= Timestamp(0));
-    assert(!time_to_wait.has_value()
-        || (time_to_wait.has_value() && time_to_wait.value() > Duration(0)));
 
     // ATTENTION: This is the new implementation of ProcessSchedulerQueue for the asynchronous case.
     // If you have to change anything in this method have also a look at the synchron version!!!
@@ -212,97 +260,37 @@ void TimerScheduler::processSchedulerQueueAsynchron(Timestamp current_time, Opti
 
     // the scheduler thread or the OnTimeUpdate method must process the queue exclusively.
     std::lock_guard<std::mutex> processing_lock(_mutex_processing_lock);
+    std::lock_guard<std::mutex> lock(_mutex_timer);
 
-    bool loop_again = true;
-    auto time_to_wait_min = Optional<Duration>();
-    // the value for max loop count is 1000 because assuming that one loop takes at least
-    // 1µs (I think it takes longer time), than the resync with the current time will be
-    // performed every 1ms which is needed to guarantee that other (new) timers will be scheduled.
-    // see #23270 for more information
-    const size_t max_loop_count = 1000;
-    size_t loop_count = 0;
-    while (loop_again && loop_count < max_loop_count)
+    while (!_timers.empty() && _timers.topInstant() <= current_time)
     {
-        std::lock_guard<std::mutex> lock(_mutex_timer);
+        // the item must be triggered
+        const auto& timer_info = _timers.top();
+        timer_info._timer->wakeUp(current_time);
 
-        loop_again = false;
-        for (auto timer_it = _timers.begin(); timer_it != _timers.end();
-            /*increment on iterator will be done within the loop*/)
+        if (timer_info._period <= Duration(0))
         {
-            // variable to detect necessary deletion
-            bool delete_timer = false;
-
-            // check the eventtimes for timeout calculation
-            if (timer_it->_next_instant != Timestamp(0) &&
-                timer_it->_next_instant > current_time)
-            {
-                // diff time is always greater than 0
-                // remember the shortest time to wait
-                const auto diff_time = timer_it->_next_instant - current_time;
-                if (!time_to_wait_min.has_value() || diff_time < time_to_wait_min.value())
-                {
-                    time_to_wait_min = diff_time;
-                }
-                else
-                {
-                    // do nothing. the last remembered time was smaller.
-                }
-
-            }
-            // check if the eventtime is smaller than the current time
-            else if(timer_it->_next_instant <= current_time)
-            {
-                // the item must be triggered
-
-                // wakeup the thread
-                assert(current_time >= Timestamp(0));
-                timer_it->_timer->wakeUp(current_time);
-
-                if (timer_it->_period <= Duration(0))
-                {
-                    // OneShotTimer: delete from list
-                    delete_timer = true;
-                }
-                else
-                {
-                    // periodic timer: increment the event time by period time
-                    timer_it->_next_instant += timer_it->_period;
-                    // if at least one period timer was found in the list, we have to loop again
-                    // because it is possible that the timer has to be triggered again
-                    loop_again = true;
-                }
-            }
-
-            if (delete_timer)
-            {
-                // erase the scheduler item from list
-                // and get the next valid iterator
-                timer_it = _timers.erase(timer_it);
-            }
-            else
-            {
-                // increment iterator
-                ++timer_it;
-            }
-
+            // OneShotTimer: delete from queue
+            _timers.pop();
+            continue;
         }
 
-        time_to_wait = time_to_wait_min;
-        ++loop_count;
+        // periodic timer: instants missed in the meantime are skipped, a timer woken up late
+        // merges them into the execution with the current time anyway
+        const auto next_instant = _timers.topInstant();
+        const auto missed_periods = (current_time - next_instant) / timer_info._period + 1;
+        _timers.rescheduleTop(next_instant + missed_periods * timer_info._period);
     }
 
-    // check if the loop ends because the max loop count was reached
-    if (loop_count >= max_loop_count)
+    if (!_timers.empty())
     {
-        // in that case there are already some loops which have to be
-        // executed. So we set the wait time to 0 (causes just execution yield)
-        // and get the new current time from outside.
-        time_to_wait = Duration(0);
+        // the time to wait is always greater than 0
+        time_to_wait = _timers.topInstant() - current_time;
     }
 
     // no negative duration
-    assert(!time_to_wait.has_value() 
-        || (time_to_wait.has_value() && time_to_wait.value() >= Duration(0)));
+    assert(!time_to_wait.has_value()
+        || (time_to_wait.has_value() && time_to_wait.value() > Duration(0)));
 }
 
 Timestamp TimerScheduler::getTime() const
@@ -317,60 +305,79 @@ IClock::ClockType TimerScheduler::getClockType() const
 
 fep3::Result TimerScheduler::execute(Timestamp /*time_of_execution*/)
 {
-    using namespace std::chrono_literals;
-
     const auto clock_type = getClockType();
-       
-    while (!_cancelled) 
-    {     
-        while(_block_scheduling_start 
-            && !_cancelled) 
+
+    while (!_cancelled)
+    {
         {
+            std::unique_lock<std::mutex> lock(_mutex_processing_trigger);
             // waiting for start (will be set by call to timeResetBegin)
-            std::this_thread::sleep_for(std::chrono::microseconds(300));
+            _cv_trigger_event.wait(lock, [this]() { return !_block_scheduling_start || _cancelled; });
+            // events up to now are handled by the following processing of the queue
+            _trigger_event = false;
         }
-     
+        if (_cancelled)
+        {
+            break;
+        }
+
         auto time_to_wait = Optional<Duration>();
+        auto current_time = Timestamp(0);
         if (clock_type == IClock::ClockType::continuous)
         {
-            processSchedulerQueueAsynchron(getTime(), time_to_wait);
-        }               
+            current_time = getTime();
+            processSchedulerQueueAsynchron(current_time, time_to_wait);
+        }
 
         if (!time_to_wait.has_value())
         {
-            // wait for the event. The loop within ProcessSchedulerQueue
-            // was not executed. Otherwise time_to_wait is greater 0.
-            while (!_cancelled)
-            {
-                std::unique_lock<std::mutex> lock(_mutex_processing_trigger);
-
-                auto timeout = _cv_trigger_event.wait_for(lock, std::chrono::milliseconds(300));
-                if (timeout == std::cv_status::no_timeout)
-                {
-                    break;
-                }
-            }
+            // nothing to wait for, the next event (new timer, time reset or stop) triggers the processing again
+            std::unique_lock<std::mutex> lock(_mutex_processing_trigger);
+            _cv_trigger_event.wait(lock, [this]() { return _trigger_event || _cancelled; });
         }
         else
-        {        
-            if (time_to_wait.value() < 1ms)
-            {
-                // timespan is to short for wait. so just yield the execution.
-                std::this_thread::yield();
-            }
-            else
-            {
-                // the next execution is more or equal 1ms. Just wait that time.
-                std::unique_lock<std::mutex> lock(_mutex_processing_trigger);
-
-                _cv_trigger_event.wait_for(lock, time_to_wait.value());
-            }
+        {
+            waitUntil(current_time + time_to_wait.value());
         }
     }
 
     return{};
 }
 
+void TimerScheduler::waitUntil(Timestamp next_instant)
+{
+    // the wait is done with an absolute deadline of the steady clock, so the time spent
+    // in the scheduler itself does not add up to the jitter of the timers
+    const auto deadline = std::chrono::steady_clock::now() + (next_instant - getTime());
+    {
+        std::unique_lock<std::mutex> lock(_mutex_processing_trigger);
+        if (_cv_trigger_event.wait_until(lock, deadline - _spin_window,
+            [this]() { return _trigger_event || _cancelled; }))
+        {
+            return;
+        }
+    }
+
+    // waking up from the wait takes longer than the spin window, so its end is busy waited for,
+    // yielding to other threads and leaving early if a new event has to be processed
+    while (!_cancelled
+        && !_trigger_event
+        && getTime() < next_instant
+        && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::yield();
+    }
+}
+
+void TimerScheduler::triggerEvent()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex_processing_trigger);
+        _trigger_event = true;
+    }
+    _cv_trigger_event.notify_all();
+}
+
 void TimerScheduler::timeResetBegin(Timestamp old_time, Timestamp new_time)
 {
     _mutex_processing_lock.lock();    
@@ -380,18 +387,14 @@ void TimerScheduler::timeResetBegin(Timestamp old_time, Timestamp new_time)
     {
         std::lock_guard<std::mutex> lock(_mutex_timer);
 
-        for (auto it = _timers.begin();
-             it != _timers.end(); ++it)
+        if (do_forward)
         {
-            if (do_forward)
-            {
-                it->_next_instant += time_diff;
-            }
-            else
-            {
-                it->_timer->reset();
-                it->_next_instant -= time_diff;
-            }
+            _timers.shift(time_diff);
+        }
+        else
+        {
+            _timers.forEach([](const TimerInfo& timer_info) { timer_info._timer->reset(); });
+            _timers.shift(-time_diff);
         }
     }
 
@@ -406,7 +409,7 @@ void TimerScheduler::timeResetBegin(Timestamp old_time, Timestamp new_time)
     }
 
     // make sure any ongoing waiting is cancelled
-    _cv_trigger_event.notify_all();
+    triggerEvent();
 }
 
 void TimerScheduler::timeResetEnd(Timestamp new_time)
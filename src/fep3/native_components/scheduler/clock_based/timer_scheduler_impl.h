@@ -16,14 +16,17 @@
 
 #include <atomic>
 #include <condition_variable>
-#include <list>
 #include <mutex>
 #include <future>
+#include <string>
+#include <vector>
 
 #include <fep3/fep3_duration.h>
 #include <fep3/components/scheduler/scheduler_service_intf.h>
 #include <fep3/components/clock/clock_intf.h>
 
+#include "timer_queue.h"
+
 namespace fep3
 {
 namespace native
@@ -42,33 +45,48 @@ class TimerScheduler :
     public fep3::IJob,
     public std::enable_shared_from_this<TimerScheduler>
 {
-private:
-    struct TimerInfo
-    {
-        ITimer*   _timer;
-        Timestamp _next_instant;
-        Duration _period;
-
-        bool operator<(const TimerInfo& other) const
-        {
-            return _next_instant < other._next_instant;
-        }
-    };           
-
 public:       
     explicit TimerScheduler(fep3::IClockService& clock);
     TimerScheduler() = delete;
 
     virtual ~TimerScheduler();      
 
-    fep3::Result addTimer(ITimer& timer, Duration period, Duration initial_delay);
+    fep3::Result addTimer(ITimer& timer,
+        Duration period,
+        Duration initial_delay,
+        const std::string& name = std::string(),
+        const std::vector<std::string>& dependencies = {});
     fep3::Result removeTimer(ITimer& timer);
     fep3::Result start();
     fep3::Result stop();   
+    /**
+     * @brief Enables the parallel processing of timers which are due at the same instant for discrete clocks.
+     * All timers due at the same instant are woken up together and the scheduler waits until all of them finished.
+     * A timer depending on other timers due at the same instant is woken up after they finished.
+     * If disabled (default) the timers are woken up one after another.
+     *
+     * @param parallel_execution true to enable the parallel processing
+     */
+    void setParallelExecution(bool parallel_execution);
+    /**
+     * @brief Sets the time before the next due timer of a continuous clock, which is busy waited for
+     * instead of blocking the scheduler thread. Waking up a blocked thread takes some microseconds,
+     * so a short spin window reduces the jitter of the timers at the expense of CPU load.
+     *
+     * @param spin_window the spin window, 0 to never busy wait
+     */
+    void setSpinWindow(Duration spin_window);
 
 private:        
     void processSchedulerQueueSynchron(Timestamp current_time, fep3::Optional<Duration>& time_to_wait);
     void processSchedulerQueueAsynchron(Timestamp current_time, fep3::Optional<Duration>& time_to_wait);
+    void rescheduleFirstTimer();
+    void wakeUpTimersInParallel(Timestamp wakeup_time);
+    /**
+     * @brief Waits until the @p next_instant of the clock is reached or an event requires processing the queue again.
+     */
+    void waitUntil(Timestamp next_instant);
+    void triggerEvent();
     Timestamp getTime() const;
     IClock::ClockType getClockType() const;
     void initBlockSchedulingStart();
@@ -86,14 +104,23 @@ private:
     fep3::Result executeDataOut(Timestamp  /*time_of_execution*/) override { return {}; }
 
 private:
-    std::list<TimerInfo> _timers;
+    TimerQueue _timers;
     std::mutex _mutex_timer;
     std::mutex _mutex_processing_lock;
 	std::mutex _mutex_processing_trigger;
 	std::mutex _mutex_start_stop_update;
 	std::condition_variable _cv_trigger_event;
+    // a timer was added, the time was reset or the scheduler was stopped, written under _mutex_processing_trigger
+    // and read without it by the busy wait of waitUntil
+    std::atomic<bool> _trigger_event{ false };
+    Duration _spin_window{ std::chrono::microseconds(FEP3_SCHEDULER_TIMER_SPIN_WINDOW_DEFAULT_VALUE) };
     fep3::IClockService* _clock;
     fep3::Optional<Timestamp> _startup_reset_time;
+    bool _parallel_execution = false;
+    // timers due at the same instant, only used by processSchedulerQueueSynchron
+    std::vector<TimerInfo> _due_timers;
+    // guarded by _mutex_timer
+    size_t _next_timer_index = 0;
 
 #ifndef __QNX__
     std::atomic<bool> _cancelled;
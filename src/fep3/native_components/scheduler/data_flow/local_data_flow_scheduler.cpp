@@ -0,0 +1,519 @@
+/**
+* Scheduler executing jobs along their data dependencies
+*
+* @file
+* Copyright &copy; AUDI AG. All rights reserved.
+*
+* This Source Code Form is subject to the terms of the
+* Mozilla Public License, v. 2.0.
+* If a copy of the MPL was not distributed with this
+* file, You can obtain one at https://mozilla.org/MPL/2.0/.
+*
+*/
+
+#include "local_data_flow_scheduler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <set>
+#include <a_util/strings/strings_format.h>
+
+namespace fep3
+{
+namespace native
+{
+
+namespace
+{
+constexpr int not_visited = 0;
+constexpr int visiting = 1;
+constexpr int visited = 2;
+} // namespace
+
+constexpr std::chrono::milliseconds DataFlowGraph::data_delivery_timeout;
+
+DataFlowGraph::DataFlowGraph(const std::shared_ptr<const fep3::ILoggingService::ILogger>& logger,
+                             JobWorkerPool& worker_pool,
+                             IDeliveryTrackingDataRegistry* data_registry)
+    : _logger(logger)
+    , _worker_pool(worker_pool)
+    , _data_registry(data_registry)
+{
+}
+
+DataFlowGraph::~DataFlowGraph()
+{
+    stop();
+}
+
+void DataFlowGraph::build(std::vector<JobNode> jobs)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _nodes.clear();
+    _topological_order.clear();
+
+    std::map<std::string, size_t> job_indices;
+    std::map<std::string, std::vector<size_t>> writers;
+    for (size_t index = 0; index < jobs.size(); ++index)
+    {
+        _nodes.emplace_back(jobs[index].name, *jobs[index].job, jobs[index].job_runner);
+        job_indices[jobs[index].name] = index;
+        for (const auto& output_signal : jobs[index].output_signals)
+        {
+            writers[output_signal].push_back(index);
+        }
+    }
+
+    for (size_t index = 0; index < jobs.size(); ++index)
+    {
+        std::set<size_t> predecessors;
+        for (const auto& input_signal : jobs[index].input_signals)
+        {
+            const auto signal_writers = writers.find(input_signal);
+            if (signal_writers != writers.end())
+            {
+                predecessors.insert(signal_writers->second.begin(), signal_writers->second.end());
+            }
+        }
+        for (const auto& job_name : jobs[index].jobs_this_depends_on)
+        {
+            const auto job_index = job_indices.find(job_name);
+            if (job_index != job_indices.end())
+            {
+                predecessors.insert(job_index->second);
+            }
+        }
+        // a job reading its own output uses the sample of its previous execution
+        predecessors.erase(index);
+        _nodes[index].predecessors.assign(predecessors.begin(), predecessors.end());
+    }
+
+    std::vector<int> visit_state(_nodes.size(), not_visited);
+    for (size_t index = 0; index < _nodes.size(); ++index)
+    {
+        if (visit_state[index] == not_visited)
+        {
+            sortTopologically(index, visit_state);
+        }
+    }
+
+    for (size_t index = 0; index < _nodes.size(); ++index)
+    {
+        for (const auto predecessor : _nodes[index].predecessors)
+        {
+            _nodes[predecessor].successors.push_back(index);
+        }
+    }
+
+    for (size_t index = 0; index < _nodes.size(); ++index)
+    {
+        for (const auto& output_signal : jobs[index].output_signals)
+        {
+            const auto read_by_successor = std::any_of(_nodes[index].successors.begin(), _nodes[index].successors.end(),
+                [&jobs, &output_signal](size_t successor)
+                {
+                    const auto& input_signals = jobs[successor].input_signals;
+                    return std::find(input_signals.begin(), input_signals.end(), output_signal) != input_signals.end();
+                });
+            if (read_by_successor)
+            {
+                _nodes[index].delivered_signals.push_back(output_signal);
+            }
+        }
+    }
+}
+
+void DataFlowGraph::sortTopologically(size_t index, std::vector<int>& visit_state)
+{
+    // _mutex has to be locked by the caller
+    visit_state[index] = visiting;
+
+    auto& predecessors = _nodes[index].predecessors;
+    for (auto predecessor_it = predecessors.begin(); predecessor_it != predecessors.end();)
+    {
+        const auto predecessor = *predecessor_it;
+        if (visit_state[predecessor] == visiting)
+        {
+            if (_logger && _logger->isWarningEnabled())
+            {
+                _logger->logWarning(a_util::strings::format(
+                    "Job %s: The dependency on job %s closes a cycle and is ignored by the data flow scheduling.",
+                    _nodes[index].name.c_str(), _nodes[predecessor].name.c_str()));
+            }
+            predecessor_it = predecessors.erase(predecessor_it);
+            continue;
+        }
+        if (visit_state[predecessor] == not_visited)
+        {
+            sortTopologically(predecessor, visit_state);
+        }
+        ++predecessor_it;
+    }
+
+    visit_state[index] = visited;
+    _topological_order.push_back(index);
+}
+
+const std::vector<size_t>& DataFlowGraph::getTopologicalOrder() const
+{
+    return _topological_order;
+}
+
+std::vector<std::string> DataFlowGraph::getDependencies(size_t index) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::vector<std::string> dependencies;
+    for (const auto predecessor : _nodes.at(index).predecessors)
+    {
+        dependencies.push_back(_nodes[predecessor].name);
+    }
+    return dependencies;
+}
+
+const std::string& DataFlowGraph::getName(size_t index) const
+{
+    return _nodes.at(index).name;
+}
+
+void DataFlowGraph::wakeUp(size_t index, Timestamp wakeup_time, std::promise<void>* finished_promise)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (_cancelled)
+    {
+        setFinished(finished_promise);
+        return;
+    }
+
+    auto& node = _nodes[index];
+    // a wakeup not released yet is merged into this one
+    setFinished(node.finished_promise);
+    node.wakeup_pending = true;
+    node.wakeup_time = wakeup_time;
+    node.finished_promise = finished_promise;
+
+    tryRelease(index);
+}
+
+void DataFlowGraph::reset(size_t index)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto& node = _nodes[index];
+    node.wakeup_time = reset_time;
+    node.last_call_time = reset_time;
+}
+
+bool DataFlowGraph::isBusyUntil(const Node& node, Timestamp time) const
+{
+    // _mutex has to be locked by the caller
+    return (node.scheduled && node.scheduled_time <= time)
+        || (node.wakeup_pending && node.wakeup_time <= time);
+}
+
+void DataFlowGraph::tryRelease(size_t index)
+{
+    // _mutex has to be locked by the caller
+    auto& node = _nodes[index];
+    if (_cancelled || !node.wakeup_pending || node.scheduled)
+    {
+        return;
+    }
+
+    // the jobs this one depends on have to finish their executions up to the same time first,
+    // they are woken up before this one because the timers are added in topological order
+    for (const auto predecessor : node.predecessors)
+    {
+        if (isBusyUntil(_nodes[predecessor], node.wakeup_time))
+        {
+            return;
+        }
+    }
+
+    const auto wakeup_time = node.wakeup_time;
+    const auto finished_promise = node.finished_promise;
+    node.wakeup_pending = false;
+    node.finished_promise = nullptr;
+    node.scheduled = true;
+    node.scheduled_time = wakeup_time;
+
+    // posted from a worker the successor is queued to the same worker and runs directly after its predecessor
+    _worker_pool.post([this, index, wakeup_time, finished_promise]()
+    {
+        execute(index, wakeup_time, finished_promise);
+    });
+}
+
+void DataFlowGraph::execute(size_t index, Timestamp wakeup_time, std::promise<void>* finished_promise)
+{
+    auto& node = _nodes[index];
+    bool run_job = false;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        node.executing_thread = std::this_thread::get_id();
+        // a reset after waking us up is signaled by the reset time, we won't run the job in that case
+        run_job = !_cancelled
+            && wakeup_time != reset_time
+            && (node.last_call_time == reset_time || wakeup_time > node.last_call_time);
+    }
+
+    if (run_job)
+    {
+        node.job_runner.runJob(wakeup_time, *node.job);
+        // the successors are released afterwards, so they read the data of this execution
+        waitForDelivery(node);
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (run_job)
+    {
+        node.last_call_time = wakeup_time;
+    }
+    node.executing_thread = std::thread::id();
+    node.scheduled = false;
+    setFinished(finished_promise);
+
+    tryRelease(index);
+    for (const auto successor : node.successors)
+    {
+        tryRelease(successor);
+    }
+    _cv_idle.notify_all();
+}
+
+void DataFlowGraph::waitForDelivery(const Node& node) const
+{
+    if (!_data_registry)
+    {
+        return;
+    }
+    // one deadline for all signals, so the successors of a job are delayed by data_delivery_timeout at most
+    const auto deadline = std::chrono::steady_clock::now() + data_delivery_timeout;
+    for (const auto& signal_name : node.delivered_signals)
+    {
+        // after the deadline the signals are still checked without waiting, to report each one not delivered
+        const auto remaining_time = std::max<std::chrono::nanoseconds>(
+            deadline - std::chrono::steady_clock::now(), std::chrono::nanoseconds(0));
+        const auto result = _data_registry->waitForDelivery(signal_name, remaining_time);
+        if (fep3::isFailed(result) && _logger && _logger->isWarningEnabled())
+        {
+            _logger->logWarning(a_util::strings::format(
+                "Job %s: %s. The jobs reading it are executed anyway.",
+                node.name.c_str(), result.getDescription()));
+        }
+    }
+}
+
+void DataFlowGraph::setFinished(std::promise<void>*& finished_promise)
+{
+    if (finished_promise)
+    {
+        finished_promise->set_value();
+        finished_promise = nullptr;
+    }
+}
+
+void DataFlowGraph::start()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _cancelled = false;
+    for (auto& node : _nodes)
+    {
+        node.wakeup_time = reset_time;
+        node.last_call_time = reset_time;
+    }
+}
+
+void DataFlowGraph::stop()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _cancelled = true;
+
+    // a waiting scheduler must not be blocked by jobs which will not be released anymore
+    for (auto& node : _nodes)
+    {
+        node.wakeup_pending = false;
+        setFinished(node.finished_promise);
+    }
+
+    const auto current_thread = std::this_thread::get_id();
+    _cv_idle.wait(lock, [this, &current_thread]()
+    {
+        return std::none_of(_nodes.begin(), _nodes.end(), [&current_thread](const Node& node)
+        {
+            return node.scheduled && node.executing_thread != current_thread;
+        });
+    });
+}
+
+DataFlowTimer::DataFlowTimer(DataFlowGraph& graph, size_t index)
+    : _graph(graph)
+    , _index(index)
+{
+}
+
+fep3::Result DataFlowTimer::wakeUp(Timestamp wakeup_time, std::promise<void>* finished_promise)
+{
+    _graph.wakeUp(_index, wakeup_time, finished_promise);
+    return {};
+}
+
+fep3::Result DataFlowTimer::reset()
+{
+    _graph.reset(_index);
+    return {};
+}
+
+LocalDataFlowScheduler::LocalDataFlowScheduler(
+    const std::shared_ptr<const fep3::ILoggingService::ILogger>& logger,
+    const std::function<fep3::Result()>& set_participant_to_error_state,
+    const std::shared_ptr<JobStatisticsRegistry>& job_statistics,
+    const std::shared_ptr<const JobExecutionConfiguration>& job_execution_configuration,
+    fep3::IDataRegistry* data_registry)
+    : _job_execution_configuration(job_execution_configuration
+        ? job_execution_configuration
+        : std::make_shared<const JobExecutionConfiguration>())
+    , _logger(logger)
+    , _set_participant_to_error_state(set_participant_to_error_state)
+    , _job_statistics(job_statistics)
+    , _data_registry(data_registry)
+{
+    if (!_logger)
+    {
+        throw std::runtime_error("Logger not set");
+    }
+}
+
+LocalDataFlowScheduler::~LocalDataFlowScheduler()
+{
+    deinitialize();
+}
+
+std::string LocalDataFlowScheduler::getName() const
+{
+    return FEP3_SCHEDULER_DATA_FLOW;
+}
+
+fep3::Result LocalDataFlowScheduler::initialize(fep3::IClockService& clock,
+                                               const fep3::Jobs& jobs)
+{
+    const JobExecutionConfiguration job_execution_configuration = *_job_execution_configuration;
+
+    _timer_scheduler = std::make_shared<TimerScheduler>(clock);
+    // all jobs due at the same instant are woken up together, the graph orders their execution
+    _timer_scheduler->setParallelExecution(true);
+    _timer_scheduler->setSpinWindow(job_execution_configuration._timer_spin_window);
+    FEP3_RETURN_IF_FAILED(clock.registerEventSink(_timer_scheduler));
+
+    _clock = &clock;
+
+    _service_thread = std::make_unique<ServiceThread>("__scheduler", *_timer_scheduler, clock, 0);
+    _service_thread->setThreadConfiguration(job_execution_configuration._scheduler_thread_configuration);
+
+    const auto thread_count = job_execution_configuration._job_worker_thread_count > 0
+        ? job_execution_configuration._job_worker_thread_count
+        : std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    _job_worker_pool = std::make_unique<JobWorkerPool>(thread_count);
+    FEP3_RETURN_IF_FAILED(_job_worker_pool->configureThreads("__job_worker",
+        job_execution_configuration._job_worker_thread_configuration));
+    // only a registry tracking the delivery of the received data can make the successors wait for it
+    _graph = std::make_unique<DataFlowGraph>(_logger,
+        *_job_worker_pool,
+        dynamic_cast<IDeliveryTrackingDataRegistry*>(_data_registry));
+
+    std::vector<DataFlowGraph::JobNode> job_nodes;
+    for (const auto& job : jobs)
+    {
+        const auto& job_info = job.second.job_info;
+        const auto& job_configuration = job_info.getConfig();
+        job_nodes.push_back({ job_info.getName(),
+            job.second.job.get(),
+            fep3::native::JobRunner(job_info.getName(),
+                job_configuration._runtime_violation_strategy,
+                job_configuration._max_runtime_real_time,
+                _logger,
+                _set_participant_to_error_state,
+                _job_statistics ? _job_statistics->getJobStatistics(job_info.getName()) : nullptr,
+                &clock),
+            job_configuration._input_signals,
+            job_configuration._output_signals,
+            job_configuration._jobs_this_depends_on });
+    }
+    _graph->build(std::move(job_nodes));
+
+    // timers due at the same instant are woken up in the order they were added,
+    // so every job is woken up after the jobs it depends on
+    std::vector<const fep3::JobEntry*> job_entries;
+    for (const auto& job : jobs)
+    {
+        job_entries.push_back(&job.second);
+    }
+    for (const auto index : _graph->getTopologicalOrder())
+    {
+        const auto& job_configuration = job_entries[index]->job_info.getConfig();
+        _timers.push_back(std::make_unique<DataFlowTimer>(*_graph, index));
+        FEP3_RETURN_IF_FAILED(_timer_scheduler->addTimer(*_timers.back(),
+            job_configuration._cycle_sim_time,
+            job_configuration._delay_sim_time,
+            _graph->getName(index)));
+    }
+
+    return {};
+}
+
+fep3::Result LocalDataFlowScheduler::start()
+{
+    _graph->start();
+    FEP3_RETURN_IF_FAILED(_timer_scheduler->start());
+    const auto result = _service_thread->start();
+    if (fep3::isFailed(result))
+    {
+        stop();
+    }
+    return result;
+}
+
+fep3::Result LocalDataFlowScheduler::stop()
+{
+    if (_timer_scheduler)
+    {
+        _timer_scheduler->stop();
+    }
+    if (_graph)
+    {
+        _graph->stop();
+    }
+    if (_service_thread)
+    {
+        _service_thread->join();
+    }
+    return {};
+}
+
+fep3::Result LocalDataFlowScheduler::deinitialize()
+{
+    stop();
+    if (_clock)
+    {
+        _clock->unregisterEventSink(_timer_scheduler);
+        _clock = nullptr;
+    }
+    for (auto& timer : _timers)
+    {
+        if (_timer_scheduler)
+        {
+            _timer_scheduler->removeTimer(*timer);
+        }
+    }
+    _timer_scheduler.reset();
+    _service_thread.reset();
+    _timers.clear();
+    // the pool is destroyed first, a job stopping the scheduler may still be running in it
+    _job_worker_pool.reset();
+    _graph.reset();
+    return {};
+}
+
+} // namespace native
+} // namespace fep3
@@ -0,0 +1,242 @@
+/**
+* Scheduler executing jobs along their data dependencies
+*
+* @file
+* Copyright &copy; AUDI AG. All rights reserved.
+*
+* This Source Code Form is subject to the terms of the
+* Mozilla Public License, v. 2.0.
+* If a copy of the MPL was not distributed with this
+* file, You can obtain one at https://mozilla.org/MPL/2.0/.
+*
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fep3/native_components/scheduler/job_runner.h>
+#include <fep3/native_components/scheduler/clock_based/job_worker_pool.h>
+#include <fep3/native_components/scheduler/clock_based/local_clock_based_scheduler.h>
+#include <fep3/native_components/scheduler/clock_based/timer_scheduler_impl.h>
+#include <fep3/native_components/data_registry/delivery_tracking.h>
+#include <fep3/components/clock/clock_service_intf.h>
+#include <fep3/components/data_registry/data_registry_intf.h>
+#include <fep3/components/scheduler/scheduler_intf.h>
+
+namespace fep3
+{
+namespace native
+{
+
+/**
+ * @brief Directed acyclic graph of jobs connected by the data they exchange.
+ *
+ * A job depends on every other job writing one of its input signals
+ * (see @ref fep3::JobConfiguration::_input_signals and @ref fep3::JobConfiguration::_output_signals)
+ * and on the jobs listed in @ref fep3::JobConfiguration::_jobs_this_depends_on.
+ * A job woken up is executed on the worker pool as soon as none of the jobs it depends on
+ * is woken up or running for the same or an earlier time, so a chain of dependent jobs
+ * is executed within one time step and independent jobs are executed in parallel.
+ * A job is never executed concurrently to itself, wakeups while it is running are merged.
+ * Before the jobs depending on a job are executed, the data it wrote to their input signals
+ * is passed to their readers (see @ref IDeliveryTrackingDataRegistry).
+ */
+class DataFlowGraph
+{
+public:
+    /// Job to be added to the graph
+    struct JobNode
+    {
+        std::string name;
+        fep3::IJob* job;
+        fep3::native::JobRunner job_runner;
+        std::vector<std::string> input_signals;
+        std::vector<std::string> output_signals;
+        std::vector<std::string> jobs_this_depends_on;
+    };
+
+    /// Maximum time to wait for the data written by one job execution to reach the readers of the jobs depending on it,
+    /// shared by all signals of the job
+    static constexpr std::chrono::milliseconds data_delivery_timeout{ 1000 };
+
+    /**
+     * @param logger logger to report dependency cycles and delayed data to
+     * @param worker_pool the pool executing the jobs
+     * @param data_registry the registry the data exchanged by the jobs is received by, optional.
+     *                      If not set, the jobs depending on a job may be executed before its data reached them.
+     */
+    DataFlowGraph(const std::shared_ptr<const fep3::ILoggingService::ILogger>& logger,
+        JobWorkerPool& worker_pool,
+        IDeliveryTrackingDataRegistry* data_registry = nullptr);
+    ~DataFlowGraph();
+
+    DataFlowGraph(const DataFlowGraph&) = delete;
+    DataFlowGraph(DataFlowGraph&&) = delete;
+    DataFlowGraph& operator=(const DataFlowGraph&) = delete;
+    DataFlowGraph& operator=(DataFlowGraph&&) = delete;
+
+    /**
+     * @brief Builds the graph of the @p jobs.
+     * Dependencies closing a cycle are dropped (and logged as warning), so the graph stays acyclic.
+     *
+     * @param jobs the jobs
+     */
+    void build(std::vector<JobNode> jobs);
+
+    /**
+     * @return the indices of the jobs in topological order, every job follows all jobs it depends on
+     */
+    const std::vector<size_t>& getTopologicalOrder() const;
+    /**
+     * @return the names of the jobs the job at @p index depends on after removing cycles
+     */
+    std::vector<std::string> getDependencies(size_t index) const;
+    const std::string& getName(size_t index) const;
+
+    /**
+     * @brief Wakes up the job at @p index, see @ref ITimer::wakeUp.
+     * @p finished is set as soon as the job has been executed for @p wakeup_time
+     * (or the wakeup was merged into a subsequent one or the graph was stopped).
+     */
+    void wakeUp(size_t index, Timestamp wakeup_time, std::promise<void>* finished);
+    /**
+     * @brief Resets the last execution time of the job at @p index, see @ref ITimer::reset.
+     */
+    void reset(size_t index);
+
+    void start();
+    /**
+     * @brief Stops the graph and waits until all running jobs have finished
+     * (except the job calling it).
+     */
+    void stop();
+
+private:
+    struct Node
+    {
+        Node(const std::string& name, fep3::IJob& job, const fep3::native::JobRunner& job_runner)
+            : name(name)
+            , job(&job)
+            , job_runner(job_runner)
+        {
+        }
+
+        std::string name;
+        fep3::IJob* job;
+        fep3::native::JobRunner job_runner;
+        std::vector<size_t> predecessors;
+        std::vector<size_t> successors;
+        // output signals read by the successors
+        std::vector<std::string> delivered_signals;
+
+        bool wakeup_pending = false;
+        Timestamp wakeup_time{ reset_time };
+        std::promise<void>* finished_promise = nullptr;
+        // the job is queued in the worker pool or running
+        bool scheduled = false;
+        Timestamp scheduled_time{ reset_time };
+        std::thread::id executing_thread;
+        Timestamp last_call_time{ reset_time };
+    };
+
+    void sortTopologically(size_t index, std::vector<int>& visit_state);
+    bool isBusyUntil(const Node& node, Timestamp time) const;
+    void tryRelease(size_t index);
+    void waitForDelivery(const Node& node) const;
+    void execute(size_t index, Timestamp wakeup_time, std::promise<void>* finished_promise);
+    static void setFinished(std::promise<void>*& finished_promise);
+
+private:
+    std::shared_ptr<const fep3::ILoggingService::ILogger> _logger;
+    JobWorkerPool& _worker_pool;
+    IDeliveryTrackingDataRegistry* _data_registry;
+    std::vector<Node> _nodes;
+    std::vector<size_t> _topological_order;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _cv_idle;
+    bool _cancelled = true;
+};
+
+/**
+ * @brief Timer waking up a job of a @ref DataFlowGraph.
+ */
+class DataFlowTimer : public ITimer
+{
+public:
+    DataFlowTimer(DataFlowGraph& graph, size_t index);
+
+    fep3::Result wakeUp(Timestamp wakeup_time, std::promise<void>* finished = nullptr) override;
+    fep3::Result reset() override;
+
+private:
+    DataFlowGraph& _graph;
+    size_t _index;
+};
+
+/**
+ * @brief Scheduler executing the jobs along the data flow between them.
+ *
+ * The jobs are woken up by their cycle time like the @ref LocalClockBasedScheduler does,
+ * but are executed by a @ref DataFlowGraph on a @ref JobWorkerPool: a job reading data written by
+ * other jobs due at the same time waits for these jobs and is executed directly after them
+ * instead of in the next cycle, independent jobs are executed in parallel.
+ * The readers and writers of the jobs are taken from the data references of the timing configuration.
+ * If the data registry is the native one, a job is executed after the data of the jobs it depends on reached its readers.
+ */
+class LocalDataFlowScheduler : public fep3::IScheduler
+{
+public:
+    /**
+     * @param logger logger of the scheduler
+     * @param set_participant_to_error_state called if a job exceeds its maximum runtime
+     *                                       and its strategy is @ref fep3::JobConfiguration::TimeViolationStrategy::set_stm_to_error
+     * @param job_statistics the runtime statistics of the jobs are recorded to, optional
+     * @param job_execution_configuration configuration of the threads executing the jobs, read on @ref initialize.
+     *                                    A job worker thread count of 0 means one thread per hardware thread,
+     *                                    the jobs due at the same instant are always executed in parallel.
+     *                                    The thread configurations of the jobs are not used,
+     *                                    because every job may be executed by any worker.
+     * @param data_registry the data registry the jobs exchange their data by, optional
+     */
+    LocalDataFlowScheduler(
+        const std::shared_ptr<const fep3::ILoggingService::ILogger>& logger,
+        const std::function<fep3::Result()>& set_participant_to_error_state,
+        const std::shared_ptr<JobStatisticsRegistry>& job_statistics = {},
+        const std::shared_ptr<const JobExecutionConfiguration>& job_execution_configuration = {},
+        fep3::IDataRegistry* data_registry = nullptr);
+    ~LocalDataFlowScheduler();
+
+public:
+    std::string getName() const override;
+
+    fep3::Result initialize(fep3::IClockService& clock, const fep3::Jobs& jobs) override;
+    fep3::Result start() override;
+    fep3::Result stop() override;
+    fep3::Result deinitialize() override;
+
+private:
+    std::unique_ptr<ServiceThread> _service_thread;
+    std::shared_ptr<TimerScheduler> _timer_scheduler;
+    std::shared_ptr<const JobExecutionConfiguration> _job_execution_configuration;
+    std::unique_ptr<JobWorkerPool> _job_worker_pool;
+    std::unique_ptr<DataFlowGraph> _graph;
+    std::list<std::unique_ptr<DataFlowTimer>> _timers;
+    std::shared_ptr<const fep3::ILoggingService::ILogger> _logger;
+    std::function<fep3::Result()> _set_participant_to_error_state;
+    std::shared_ptr<JobStatisticsRegistry> _job_statistics;
+    fep3::IDataRegistry* _data_registry;
+    fep3::IClockService* _clock = nullptr;
+};
+
+} // namespace native
+} // namespace fep3
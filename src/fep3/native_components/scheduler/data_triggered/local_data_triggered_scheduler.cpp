@@ -0,0 +1,265 @@
+/**
+* Scheduler triggering jobs by incoming data
+*
+* @file
+* Copyright &copy; AUDI AG. All rights reserved.
+*
+* This Source Code Form is subject to the terms of the
+* Mozilla Public License, v. 2.0.
+* If a copy of the MPL was not distributed with this
+* file, You can obtain one at https://mozilla.org/MPL/2.0/.
+*
+*/
+
+#include "local_data_triggered_scheduler.h"
+
+#include <fep3/base/thread/thread.h>
+
+namespace fep3
+{
+namespace native
+{
+
+namespace
+{
+
+/**
+ * Listener triggering the job thread for every received sample, stream types do not trigger the job.
+ */
+class TriggerListener : public fep3::IDataRegistry::IDataReceiver
+{
+public:
+    explicit TriggerListener(const std::shared_ptr<DataTriggeredJobThread>& job_thread)
+        : _job_thread(job_thread)
+    {
+    }
+
+    void operator()(const data_read_ptr<const IStreamType>&) override
+    {
+    }
+
+    void operator()(const data_read_ptr<const IDataSample>&) override
+    {
+        _job_thread->trigger();
+    }
+
+private:
+    std::shared_ptr<DataTriggeredJobThread> _job_thread;
+};
+
+} // namespace
+
+DataTriggeredJobThread::DataTriggeredJobThread(const std::string& name,
+                                               fep3::IJob& job,
+                                               fep3::IClockService& clock,
+                                               const fep3::native::JobRunner& job_runner,
+                                               const ThreadConfiguration& thread_configuration)
+    : _name(name)
+    , _job(job)
+    , _clock(clock)
+    , _job_runner(job_runner)
+    , _thread_configuration(thread_configuration)
+{
+}
+
+DataTriggeredJobThread::~DataTriggeredJobThread()
+{
+    stop();
+}
+
+fep3::Result DataTriggeredJobThread::start()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_running)
+    {
+        return {};
+    }
+    // data received before the start is still in the readers and will be read by the first triggered execution
+    _triggered = false;
+    _running = true;
+    _thread = std::thread(&DataTriggeredJobThread::run, this);
+
+    return thread::configure(_thread, _name, _thread_configuration);
+}
+
+fep3::Result DataTriggeredJobThread::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _running = false;
+    }
+    _cv_trigger.notify_all();
+
+    if (_thread.joinable())
+    {
+        _thread.join();
+    }
+
+    return {};
+}
+
+void DataTriggeredJobThread::trigger()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_running)
+        {
+            return;
+        }
+        _triggered = true;
+    }
+    _cv_trigger.notify_all();
+}
+
+void DataTriggeredJobThread::run()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true)
+    {
+        _cv_trigger.wait(lock, [this] { return _triggered || !_running; });
+        if (!_running)
+        {
+            break;
+        }
+        _triggered = false;
+
+        lock.unlock();
+        _job_runner.runJob(_clock.getTime(), _job);
+        lock.lock();
+    }
+}
+
+LocalDataTriggeredScheduler::LocalDataTriggeredScheduler(
+    const std::shared_ptr<const fep3::ILoggingService::ILogger>& logger,
+    const std::function<fep3::Result()>& set_participant_to_error_state,
+    fep3::IDataRegistry& data_registry,
+    const std::shared_ptr<JobStatisticsRegistry>& job_statistics,
+    const std::shared_ptr<const JobExecutionConfiguration>& job_execution_configuration)
+    : _clock_based_scheduler(logger, set_participant_to_error_state, job_statistics, job_execution_configuration)
+    , _logger(logger)
+    , _set_participant_to_error_state(set_participant_to_error_state)
+    , _data_registry(data_registry)
+    , _job_statistics(job_statistics)
+{
+}
+
+LocalDataTriggeredScheduler::~LocalDataTriggeredScheduler()
+{
+    deinitialize();
+}
+
+std::string LocalDataTriggeredScheduler::getName() const
+{
+    return FEP3_SCHEDULER_DATA_TRIGGERED;
+}
+
+fep3::Result LocalDataTriggeredScheduler::initialize(fep3::IClockService& clock,
+                                                    const fep3::Jobs& jobs)
+{
+    fep3::Jobs clock_based_jobs;
+    for (const auto& job : jobs)
+    {
+        if (job.second.job_info.getConfig()._trigger_signals.empty())
+        {
+            clock_based_jobs.insert(job);
+            continue;
+        }
+
+        const auto result = addDataTriggeredJob(job.second, clock);
+        if (fep3::isFailed(result))
+        {
+            deinitialize();
+            return result;
+        }
+    }
+
+    return _clock_based_scheduler.initialize(clock, clock_based_jobs);
+}
+
+fep3::Result LocalDataTriggeredScheduler::addDataTriggeredJob(
+    const fep3::JobEntry& job_entry,
+    fep3::IClockService& clock)
+{
+    const auto job_info = job_entry.job_info;
+
+    fep3::native::JobRunner job_runner(job_info.getName(),
+        job_info.getConfig()._runtime_violation_strategy,
+        job_info.getConfig()._max_runtime_real_time,
+        _logger,
+        _set_participant_to_error_state,
+        _job_statistics ? _job_statistics->getJobStatistics(job_info.getName()) : nullptr,
+        &clock);
+
+    auto job_thread = std::make_shared<DataTriggeredJobThread>(job_info.getName(),
+        *job_entry.job,
+        clock,
+        job_runner,
+        job_info.getConfig()._thread_configuration);
+    _job_threads.push_back(job_thread);
+
+    for (const auto& trigger_signal : job_info.getConfig()._trigger_signals)
+    {
+        std::shared_ptr<fep3::IDataRegistry::IDataReceiver> listener = std::make_shared<TriggerListener>(job_thread);
+        const auto result = _data_registry.registerDataReceiveListener(trigger_signal, listener);
+        if (fep3::isFailed(result))
+        {
+            RETURN_ERROR_DESCRIPTION(result.getErrorCode(),
+                "Job '%s' can not be triggered by '%s'. Registering the data receive listener failed: %s",
+                job_info.getName().c_str(),
+                trigger_signal.c_str(),
+                result.getDescription());
+        }
+        _trigger_listeners.emplace_back(trigger_signal, listener);
+    }
+
+    return {};
+}
+
+fep3::Result LocalDataTriggeredScheduler::start()
+{
+    for (auto& job_thread : _job_threads)
+    {
+        const auto result = job_thread->start();
+        if (fep3::isFailed(result))
+        {
+            stop();
+            return result;
+        }
+    }
+    const auto result = _clock_based_scheduler.start();
+    if (fep3::isFailed(result))
+    {
+        stop();
+    }
+    return result;
+}
+
+fep3::Result LocalDataTriggeredScheduler::stop()
+{
+    _clock_based_scheduler.stop();
+
+    for (auto& job_thread : _job_threads)
+    {
+        job_thread->stop();
+    }
+    return {};
+}
+
+fep3::Result LocalDataTriggeredScheduler::deinitialize()
+{
+    stop();
+
+    fep3::Result result{};
+    for (const auto& trigger_listener : _trigger_listeners)
+    {
+        result |= _data_registry.unregisterDataReceiveListener(trigger_listener.first, trigger_listener.second);
+    }
+    _trigger_listeners.clear();
+    _job_threads.clear();
+
+    result |= _clock_based_scheduler.deinitialize();
+    return result;
+}
+
+} // namespace native
+} // namespace fep3
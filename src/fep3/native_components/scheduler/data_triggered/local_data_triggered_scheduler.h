@@ -0,0 +1,140 @@
+/**
+* Scheduler triggering jobs by incoming data
+*
+* @file
+* Copyright &copy; AUDI AG. All rights reserved.
+*
+* This Source Code Form is subject to the terms of the
+* Mozilla Public License, v. 2.0.
+* If a copy of the MPL was not distributed with this
+* file, You can obtain one at https://mozilla.org/MPL/2.0/.
+*
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <fep3/native_components/scheduler/job_runner.h>
+#include <fep3/native_components/scheduler/clock_based/local_clock_based_scheduler.h>
+#include <fep3/components/clock/clock_service_intf.h>
+#include <fep3/components/data_registry/data_registry_intf.h>
+#include <fep3/components/scheduler/scheduler_intf.h>
+
+namespace fep3
+{
+namespace native
+{
+
+/**
+ * @brief Thread executing a job whenever it is triggered.
+ * Triggers arriving while the job is executed are merged into one subsequent execution,
+ * because the job reads all data which arrived in the meantime from its readers anyway.
+ */
+class DataTriggeredJobThread
+{
+public:
+    /**
+     * @param name the name of the thread
+     * @param job the job to execute
+     * @param clock the clock providing the time the job is executed with
+     * @param job_runner the runner executing the job
+     * @param thread_configuration cpu affinity and scheduling of the thread
+     */
+    DataTriggeredJobThread(const std::string& name,
+        fep3::IJob& job,
+        fep3::IClockService& clock,
+        const fep3::native::JobRunner& job_runner,
+        const ThreadConfiguration& thread_configuration = {});
+    ~DataTriggeredJobThread();
+
+    DataTriggeredJobThread(const DataTriggeredJobThread&) = delete;
+    DataTriggeredJobThread(DataTriggeredJobThread&&) = delete;
+    DataTriggeredJobThread& operator=(const DataTriggeredJobThread&) = delete;
+    DataTriggeredJobThread& operator=(DataTriggeredJobThread&&) = delete;
+
+    /**
+     * @brief Starts the thread and configures it by the thread configuration.
+     * If configuring the thread fails, the thread is running anyway and has to be stopped.
+     */
+    fep3::Result start();
+    fep3::Result stop();
+    /**
+     * @brief Requests an execution of the job. Does not block and does nothing if not started.
+     */
+    void trigger();
+
+private:
+    void run();
+
+private:
+    std::string _name;
+    fep3::IJob& _job;
+    fep3::IClockService& _clock;
+    fep3::native::JobRunner _job_runner;
+    ThreadConfiguration _thread_configuration;
+
+    std::mutex _mutex;
+    std::condition_variable _cv_trigger;
+    bool _triggered = false;
+    bool _running = false;
+    std::thread _thread;
+};
+
+/**
+ * @brief Scheduler executing jobs as soon as data they are waiting for is received.
+ * A job with trigger signals (see @ref fep3::JobConfiguration::_trigger_signals) is executed
+ * whenever a sample of one of these signals was received by the data registry (and is therefore available
+ * in the data readers of the job). The job is executed with the current time of the clock.
+ * All other jobs are scheduled by their cycle time like the @ref LocalClockBasedScheduler does.
+ */
+class LocalDataTriggeredScheduler : public fep3::IScheduler
+{
+public:
+    /**
+     * @param logger logger of the scheduler
+     * @param set_participant_to_error_state called if a job exceeds its maximum runtime
+     * @param data_registry the data registry the trigger signals are received by
+     * @param job_statistics the runtime statistics of the jobs are recorded to, optional
+     * @param job_execution_configuration configuration of the threads executing the clock based jobs
+     *                                    (see @ref LocalClockBasedScheduler). The data triggered jobs are always
+     *                                    executed in threads of their own configured by their job configuration.
+     */
+    LocalDataTriggeredScheduler(
+        const std::shared_ptr<const fep3::ILoggingService::ILogger>& logger,
+        const std::function<fep3::Result()>& set_participant_to_error_state,
+        fep3::IDataRegistry& data_registry,
+        const std::shared_ptr<JobStatisticsRegistry>& job_statistics = {},
+        const std::shared_ptr<const JobExecutionConfiguration>& job_execution_configuration = {});
+    ~LocalDataTriggeredScheduler();
+
+public:
+    std::string getName() const override;
+
+    fep3::Result initialize(fep3::IClockService& clock, const fep3::Jobs& jobs) override;
+    fep3::Result start() override;
+    fep3::Result stop() override;
+    fep3::Result deinitialize() override;
+
+private:
+    fep3::Result addDataTriggeredJob(const fep3::JobEntry& job_entry, fep3::IClockService& clock);
+
+private:
+    LocalClockBasedScheduler _clock_based_scheduler;
+    std::list<std::shared_ptr<DataTriggeredJobThread>> _job_threads;
+    std::list<std::pair<std::string, std::shared_ptr<fep3::IDataRegistry::IDataReceiver>>> _trigger_listeners;
+    std::shared_ptr<const fep3::ILoggingService::ILogger> _logger;
+    std::function<fep3::Result()> _set_participant_to_error_state;
+    fep3::IDataRegistry& _data_registry;
+    std::shared_ptr<JobStatisticsRegistry> _job_statistics;
+};
+
+} // namespace native
+} // namespace fep3
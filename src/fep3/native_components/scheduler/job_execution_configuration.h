@@ -0,0 +1,46 @@
+/**
+ *
+ * @file
+ * Copyright &copy; AUDI AG. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+#include <fep3/fep3_duration.h>
+#include <fep3/base/thread/thread_configuration.h>
+#include <fep3/components/scheduler/scheduler_service_intf.h>
+
+namespace fep3
+{
+namespace native
+{
+
+/**
+ * @brief Configuration of the threads executing the jobs, shared by the native schedulers.
+ * The scheduler service updates it from its properties on tense, the schedulers read it on initialize.
+ */
+struct JobExecutionConfiguration
+{
+    /// number of worker threads executing the jobs (see @ref JobWorkerPool), how 0 is treated depends on the scheduler
+    size_t _job_worker_thread_count = 0;
+    /// execute the jobs due at the same instant of a discrete clock in parallel (see @ref TimerScheduler::setParallelExecution)
+    bool _parallel_job_execution = false;
+    /// time busy waited for before a job is due on a continuous clock (see @ref TimerScheduler::setSpinWindow)
+    Duration _timer_spin_window{ std::chrono::microseconds(FEP3_SCHEDULER_TIMER_SPIN_WINDOW_DEFAULT_VALUE) };
+    /// cpu affinity and scheduling of the thread waking up the jobs
+    ThreadConfiguration _scheduler_thread_configuration;
+    /// cpu affinity and scheduling of the threads of the @ref JobWorkerPool
+    ThreadConfiguration _job_worker_thread_configuration;
+};
+
+} // namespace native
+} // namespace fep3
@@ -27,12 +27,16 @@ JobRunner::JobRunner(
     const fep3::JobConfiguration::TimeViolationStrategy& time_violation_strategy,
     const fep3::Optional<fep3::Duration>& max_runtime,
     const std::shared_ptr<const fep3::ILoggingService::ILogger>& logger,
-    const std::function<fep3::Result()>& set_participant_to_error_state)
+    const std::function<fep3::Result()>& set_participant_to_error_state,
+    const std::shared_ptr<JobStatistics>& statistics,
+    const fep3::IClockService* clock)
         : _name(name)
         , _time_violation_strategy(time_violation_strategy)
         , _max_runtime(max_runtime)
         , _logger(logger)
         , _set_participant_to_error_state(set_participant_to_error_state)
+        , _statistics(statistics ? statistics : std::make_shared<JobStatistics>())
+        , _clock(clock)
         , _cancelled(false)
         , _skip_output(false)
 {
@@ -57,7 +61,15 @@ fep3::Result JobRunner::runJob(const Timestamp trigger_time, fep3::IJob& job)
 
     _skip_output = false;
 
-    if (fep3::isFailed(job.executeDataIn(trigger_time)))
+    if (_clock)
+    {
+        _statistics->recordWakeupJitter(_clock->getTime() - trigger_time);
+    }
+
+    const auto data_in_begin = std::chrono::high_resolution_clock::now();
+    const auto data_in_result = job.executeDataIn(trigger_time);
+    _statistics->recordDataIn(std::chrono::high_resolution_clock::now() - data_in_begin);
+    if (fep3::isFailed(data_in_result))
     {
         _logger->logWarning(
             a_util::strings::format("Job %s: Execution of data input step failed for this processing cycle.", 
@@ -69,6 +81,7 @@ fep3::Result JobRunner::runJob(const Timestamp trigger_time, fep3::IJob& job)
     auto end = std::chrono::high_resolution_clock::now();
 
     auto execution_time = end - begin;
+    _statistics->recordExecute(execution_time);
 
     if (isFailed(result))
     {
@@ -81,13 +94,22 @@ fep3::Result JobRunner::runJob(const Timestamp trigger_time, fep3::IJob& job)
     if (do_runtime_check
             && execution_time > _max_runtime.value())
     {        
-        FEP3_RETURN_IF_FAILED(applyTimeViolationStrategy(execution_time));        
+        _statistics->recordOverrun();
+        const auto violation_result = applyTimeViolationStrategy(execution_time);
+        if (_skip_output)
+        {
+            _statistics->recordSkippedOutput();
+        }
+        FEP3_RETURN_IF_FAILED(violation_result);
     }
    
 
     if (!_skip_output)
     {
-        if (fep3::isFailed(job.executeDataOut(trigger_time)))
+        const auto data_out_begin = std::chrono::high_resolution_clock::now();
+        const auto data_out_result = job.executeDataOut(trigger_time);
+        _statistics->recordDataOut(std::chrono::high_resolution_clock::now() - data_out_begin);
+        if (fep3::isFailed(data_out_result))
         {
             _logger->logWarning(
                 a_util::strings::format("Job %s: Execution of data output step failed for this processing cycle.", 
@@ -13,13 +13,16 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 
 #include <fep3/fep3_errors.h>
 #include <fep3/fep3_duration.h>
 #include <fep3/fep3_optional.h>
+#include <fep3/components/clock/clock_service_intf.h>
 #include <fep3/components/logging/logging_service_intf.h>
 #include <fep3/components/job_registry/job_configuration.h>
 #include <fep3/components/job_registry/job_registry_intf.h>
+#include "job_statistics.h"
 
 namespace fep3
 {  
@@ -33,7 +36,9 @@ public:
                     const fep3::JobConfiguration::TimeViolationStrategy& time_violation_strategy,
                     const fep3::Optional<fep3::Duration>& max_runtime,
                     const std::shared_ptr<const fep3::ILoggingService::ILogger>& logger,
-                    const std::function<fep3::Result()>& set_participant_to_error_state);
+                    const std::function<fep3::Result()>& set_participant_to_error_state,
+                    const std::shared_ptr<JobStatistics>& statistics = {},
+                    const fep3::IClockService* clock = nullptr);
 
     fep3::Result runJob(const Timestamp trigger_time, fep3::IJob& job);
 
@@ -47,7 +52,11 @@ private:
     fep3::Optional<fep3::Duration> _max_runtime;
     std::shared_ptr<const fep3::ILoggingService::ILogger> _logger;
     std::function<fep3::Result()> _set_participant_to_error_state;
-    
+    /// statistics of the job runs, shared by the copies of the runner
+    std::shared_ptr<JobStatistics> _statistics;
+    /// clock to measure the wakeup jitter, optional
+    const fep3::IClockService* _clock;
+
     bool _cancelled;
     bool _skip_output;
 };
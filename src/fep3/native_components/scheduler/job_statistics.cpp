@@ -0,0 +1,248 @@
+/**
+* @file
+* Copyright &copy; AUDI AG. All rights reserved.
+*
+* This Source Code Form is subject to the terms of the
+* Mozilla Public License, v. 2.0.
+* If a copy of the MPL was not distributed with this
+* file, You can obtain one at https://mozilla.org/MPL/2.0/.
+*
+*/
+
+#include "job_statistics.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace fep3
+{
+namespace native
+{
+
+constexpr int DurationHistogram::sub_bucket_bits;
+constexpr int64_t DurationHistogram::sub_bucket_count;
+constexpr int DurationHistogram::max_exponent;
+constexpr size_t DurationHistogram::bucket_count;
+
+namespace
+{
+
+int getMostSignificantBit(uint64_t value)
+{
+    int bit = 0;
+    while (value >>= 1)
+    {
+        ++bit;
+    }
+    return bit;
+}
+
+void storeMin(std::atomic<int64_t>& min, int64_t value)
+{
+    auto current = min.load(std::memory_order_relaxed);
+    while (value < current
+        && !min.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+void storeMax(std::atomic<int64_t>& max, int64_t value)
+{
+    auto current = max.load(std::memory_order_relaxed);
+    while (value > current
+        && !max.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+} // namespace
+
+DurationHistogram::DurationHistogram()
+    : _min(std::numeric_limits<int64_t>::max())
+{
+    for (auto& bucket : _buckets)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+size_t DurationHistogram::getBucketIndex(int64_t value)
+{
+    const auto limited_value = std::min(value, (int64_t{ 1 } << (max_exponent + 1)) - 1);
+    if (limited_value < 2 * sub_bucket_count)
+    {
+        return static_cast<size_t>(limited_value);
+    }
+    // the sub_bucket_bits + 1 most significant bits select the bucket within the power of two range
+    const int shift = getMostSignificantBit(static_cast<uint64_t>(limited_value)) - sub_bucket_bits;
+    return static_cast<size_t>(shift * sub_bucket_count + (limited_value >> shift));
+}
+
+int64_t DurationHistogram::getBucketHighestValue(size_t index)
+{
+    const auto bucket_index = static_cast<int64_t>(index);
+    if (bucket_index < 2 * sub_bucket_count)
+    {
+        return bucket_index;
+    }
+    const int64_t shift = bucket_index / sub_bucket_count - 1;
+    const int64_t lowest_value = (bucket_index - shift * sub_bucket_count) << shift;
+    return lowest_value + (int64_t{ 1 } << shift) - 1;
+}
+
+void DurationHistogram::record(Duration duration)
+{
+    const int64_t value = std::max(duration.count(), Duration::rep{ 0 });
+    _buckets[getBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    _sum.fetch_add(value, std::memory_order_relaxed);
+    storeMin(_min, value);
+    storeMax(_max, value);
+}
+
+void DurationHistogram::reset()
+{
+    for (auto& bucket : _buckets)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    _sum.store(0, std::memory_order_relaxed);
+    _min.store(std::numeric_limits<int64_t>::max(), std::memory_order_relaxed);
+    _max.store(0, std::memory_order_relaxed);
+}
+
+DurationHistogram::Snapshot DurationHistogram::getSnapshot() const
+{
+    // the counts are copied first, so the percentiles are taken from one consistent set of buckets
+    std::array<uint64_t, bucket_count> counts;
+    Snapshot snapshot;
+    for (size_t index = 0; index < bucket_count; ++index)
+    {
+        counts[index] = _buckets[index].load(std::memory_order_relaxed);
+        snapshot.count += counts[index];
+    }
+    if (snapshot.count == 0)
+    {
+        return snapshot;
+    }
+
+    snapshot.min = _min.load(std::memory_order_relaxed);
+    snapshot.max = _max.load(std::memory_order_relaxed);
+    snapshot.mean = _sum.load(std::memory_order_relaxed) / static_cast<int64_t>(snapshot.count);
+
+    const auto getPercentile = [&](uint64_t percent)
+    {
+        // the value of the (rank)th smallest recorded duration
+        const uint64_t rank = std::max(uint64_t{ 1 }, (snapshot.count * percent + 99) / 100);
+        uint64_t counted = 0;
+        for (size_t index = 0; index < bucket_count; ++index)
+        {
+            counted += counts[index];
+            if (counted >= rank)
+            {
+                return std::max(snapshot.min, std::min(getBucketHighestValue(index), snapshot.max));
+            }
+        }
+        return snapshot.max;
+    };
+    snapshot.p50 = getPercentile(50);
+    snapshot.p90 = getPercentile(90);
+    snapshot.p99 = getPercentile(99);
+    return snapshot;
+}
+
+void JobStatistics::recordDataIn(Duration duration)
+{
+    _data_in.record(duration);
+}
+
+void JobStatistics::recordExecute(Duration duration)
+{
+    _execute.record(duration);
+}
+
+void JobStatistics::recordDataOut(Duration duration)
+{
+    _data_out.record(duration);
+}
+
+void JobStatistics::recordWakeupJitter(Duration jitter)
+{
+    _wakeup_jitter.record(jitter);
+}
+
+void JobStatistics::recordOverrun()
+{
+    _overrun_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+void JobStatistics::recordSkippedOutput()
+{
+    _skipped_output_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+void JobStatistics::reset()
+{
+    _execute.reset();
+    _data_in.reset();
+    _data_out.reset();
+    _wakeup_jitter.reset();
+    _overrun_count.store(0, std::memory_order_relaxed);
+    _skipped_output_count.store(0, std::memory_order_relaxed);
+}
+
+JobStatistics::Snapshot JobStatistics::getSnapshot() const
+{
+    Snapshot snapshot;
+    snapshot.execute = _execute.getSnapshot();
+    snapshot.data_in = _data_in.getSnapshot();
+    snapshot.data_out = _data_out.getSnapshot();
+    snapshot.wakeup_jitter = _wakeup_jitter.getSnapshot();
+    snapshot.overrun_count = _overrun_count.load(std::memory_order_relaxed);
+    snapshot.skipped_output_count = _skipped_output_count.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+std::shared_ptr<JobStatistics> JobStatisticsRegistry::getJobStatistics(const std::string& job_name)
+{
+    std::lock_guard<std::mutex> lock(_sync_statistics);
+    auto& statistics = _statistics[job_name];
+    if (!statistics)
+    {
+        statistics = std::make_shared<JobStatistics>();
+    }
+    return statistics;
+}
+
+std::shared_ptr<const JobStatistics> JobStatisticsRegistry::findJobStatistics(const std::string& job_name) const
+{
+    std::lock_guard<std::mutex> lock(_sync_statistics);
+    const auto found = _statistics.find(job_name);
+    if (found == _statistics.cend())
+    {
+        return {};
+    }
+    return found->second;
+}
+
+std::vector<std::string> JobStatisticsRegistry::getJobNames() const
+{
+    std::lock_guard<std::mutex> lock(_sync_statistics);
+    std::vector<std::string> job_names;
+    for (const auto& statistics : _statistics)
+    {
+        job_names.push_back(statistics.first);
+    }
+    return job_names;
+}
+
+void JobStatisticsRegistry::reset()
+{
+    std::lock_guard<std::mutex> lock(_sync_statistics);
+    for (auto& statistics : _statistics)
+    {
+        statistics.second->reset();
+    }
+}
+
+} // namespace native
+} // namespace fep3
@@ -0,0 +1,159 @@
+/**
+* @file
+* Copyright &copy; AUDI AG. All rights reserved.
+*
+* This Source Code Form is subject to the terms of the
+* Mozilla Public License, v. 2.0.
+* If a copy of the MPL was not distributed with this
+* file, You can obtain one at https://mozilla.org/MPL/2.0/.
+*
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <fep3/fep3_duration.h>
+
+namespace fep3
+{
+namespace native
+{
+
+/**
+ * Histogram of durations in nanoseconds with a bounded relative error (like a HDR histogram).
+ *
+ * Values below 2 * sub_bucket_count are counted exactly, above that every power of two range is
+ * divided into sub_bucket_count buckets, so a value is reported with an error of less than 1/sub_bucket_count.
+ * Recording and resetting do not lock, the histogram may be read while it is recorded to.
+ */
+class DurationHistogram
+{
+public:
+    /// Values of a histogram at one point in time, all durations in nanoseconds
+    struct Snapshot
+    {
+        uint64_t count = 0;
+        int64_t min = 0;
+        int64_t max = 0;
+        int64_t mean = 0;
+        int64_t p50 = 0;
+        int64_t p90 = 0;
+        int64_t p99 = 0;
+    };
+
+    DurationHistogram();
+    DurationHistogram(const DurationHistogram&) = delete;
+    DurationHistogram(DurationHistogram&&) = delete;
+    DurationHistogram& operator=(const DurationHistogram&) = delete;
+    DurationHistogram& operator=(DurationHistogram&&) = delete;
+
+    /**
+     * Records a duration, negative durations are counted as 0.
+     *
+     * @param duration the duration
+     */
+    void record(Duration duration);
+    void reset();
+    Snapshot getSnapshot() const;
+
+private:
+    static constexpr int sub_bucket_bits = 5;
+    static constexpr int64_t sub_bucket_count = int64_t{ 1 } << sub_bucket_bits;
+    /// durations from 2^max_exponent ns (about 73 minutes) on share the last bucket
+    static constexpr int max_exponent = 42;
+    static constexpr size_t bucket_count = (max_exponent - sub_bucket_bits + 2) * sub_bucket_count;
+
+    static size_t getBucketIndex(int64_t value);
+    static int64_t getBucketHighestValue(size_t index);
+
+private:
+    std::array<std::atomic<uint64_t>, bucket_count> _buckets;
+    std::atomic<int64_t> _sum{ 0 };
+    std::atomic<int64_t> _min;
+    std::atomic<int64_t> _max{ 0 };
+};
+
+/**
+ * Runtime statistics of a job, recorded by the @ref JobRunner executing the job.
+ */
+class JobStatistics
+{
+public:
+    /// Values of the statistics at one point in time
+    struct Snapshot
+    {
+        /// runtime of IJob::execute
+        DurationHistogram::Snapshot execute;
+        /// runtime of IJob::executeDataIn
+        DurationHistogram::Snapshot data_in;
+        /// runtime of IJob::executeDataOut
+        DurationHistogram::Snapshot data_out;
+        /// time of the clock at the start of the execution minus the planned trigger time
+        DurationHistogram::Snapshot wakeup_jitter;
+        /// number of executions exceeding the maximum runtime
+        uint64_t overrun_count = 0;
+        /// number of executions which did not publish their output
+        uint64_t skipped_output_count = 0;
+    };
+
+    void recordDataIn(Duration duration);
+    void recordExecute(Duration duration);
+    void recordDataOut(Duration duration);
+    void recordWakeupJitter(Duration jitter);
+    void recordOverrun();
+    void recordSkippedOutput();
+
+    void reset();
+    Snapshot getSnapshot() const;
+
+private:
+    DurationHistogram _execute;
+    DurationHistogram _data_in;
+    DurationHistogram _data_out;
+    DurationHistogram _wakeup_jitter;
+    std::atomic<uint64_t> _overrun_count{ 0 };
+    std::atomic<uint64_t> _skipped_output_count{ 0 };
+};
+
+/**
+ * Statistics of all jobs executed by the schedulers of a scheduler service.
+ * The statistics of a job are kept when the job is rescheduled, so they cover the whole run of the participant
+ * until they are reset.
+ */
+class JobStatisticsRegistry
+{
+public:
+    /**
+     * @param job_name name of the job
+     * @return the statistics of the job, created if the job has no statistics yet
+     */
+    std::shared_ptr<JobStatistics> getJobStatistics(const std::string& job_name);
+    /**
+     * @param job_name name of the job
+     * @return the statistics of the job, nullptr if the job has no statistics
+     */
+    std::shared_ptr<const JobStatistics> findJobStatistics(const std::string& job_name) const;
+    /**
+     * @return the names of all jobs having statistics
+     */
+    std::vector<std::string> getJobNames() const;
+    /**
+     * @brief Resets the statistics of all jobs
+     */
+    void reset();
+
+private:
+    mutable std::mutex _sync_statistics;
+    std::map<std::string, std::shared_ptr<JobStatistics>> _statistics;
+};
+
+} // namespace native
+} // namespace fep3
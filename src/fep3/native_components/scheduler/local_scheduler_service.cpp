@@ -12,6 +12,11 @@
 
 #include "local_scheduler_service.h"
 
+#include <algorithm>
+#include <thread>
+
+#include <fep3/base/thread/thread.h>
+
 namespace fep3
 {
 namespace native
@@ -25,6 +30,11 @@ SchedulerServiceConfiguration::SchedulerServiceConfiguration()
 fep3::Result SchedulerServiceConfiguration::registerPropertyVariables()
 {
     FEP3_RETURN_IF_FAILED(registerPropertyVariable(_active_scheduler_name, FEP3_SCHEDULER_PROPERTY));
+    FEP3_RETURN_IF_FAILED(registerPropertyVariable(_job_worker_thread_count, FEP3_SCHEDULER_JOB_WORKER_THREAD_COUNT_PROPERTY));
+    FEP3_RETURN_IF_FAILED(registerPropertyVariable(_parallel_job_execution, FEP3_SCHEDULER_PARALLEL_JOB_EXECUTION_PROPERTY));
+    FEP3_RETURN_IF_FAILED(registerPropertyVariable(_timer_spin_window_us, FEP3_SCHEDULER_TIMER_SPIN_WINDOW_PROPERTY));
+    FEP3_RETURN_IF_FAILED(registerPropertyVariable(_scheduler_thread_configuration, FEP3_SCHEDULER_THREAD_CONFIGURATION_PROPERTY));
+    FEP3_RETURN_IF_FAILED(registerPropertyVariable(_job_worker_thread_configuration, FEP3_SCHEDULER_JOB_WORKER_THREAD_CONFIGURATION_PROPERTY));
 
     return {};
 }
@@ -32,6 +42,11 @@ fep3::Result SchedulerServiceConfiguration::registerPropertyVariables()
 fep3::Result SchedulerServiceConfiguration::unregisterPropertyVariables()
 {
     FEP3_RETURN_IF_FAILED(unregisterPropertyVariable(_active_scheduler_name, FEP3_SCHEDULER_PROPERTY));
+    FEP3_RETURN_IF_FAILED(unregisterPropertyVariable(_job_worker_thread_count, FEP3_SCHEDULER_JOB_WORKER_THREAD_COUNT_PROPERTY));
+    FEP3_RETURN_IF_FAILED(unregisterPropertyVariable(_parallel_job_execution, FEP3_SCHEDULER_PARALLEL_JOB_EXECUTION_PROPERTY));
+    FEP3_RETURN_IF_FAILED(unregisterPropertyVariable(_timer_spin_window_us, FEP3_SCHEDULER_TIMER_SPIN_WINDOW_PROPERTY));
+    FEP3_RETURN_IF_FAILED(unregisterPropertyVariable(_scheduler_thread_configuration, FEP3_SCHEDULER_THREAD_CONFIGURATION_PROPERTY));
+    FEP3_RETURN_IF_FAILED(unregisterPropertyVariable(_job_worker_thread_configuration, FEP3_SCHEDULER_JOB_WORKER_THREAD_CONFIGURATION_PROPERTY));
 
     return {};
 }
@@ -61,19 +76,105 @@ std::string RPCSchedulerService::getActiveSchedulerName()
     return _scheduler_service.getActiveSchedulerName();
 }
 
+namespace
+{
+
+Json::Value toJson(const DurationHistogram::Snapshot& snapshot)
+{
+    Json::Value json_value;
+    json_value["count"] = static_cast<Json::UInt64>(snapshot.count);
+    json_value["min"] = static_cast<Json::Int64>(snapshot.min);
+    json_value["max"] = static_cast<Json::Int64>(snapshot.max);
+    json_value["mean"] = static_cast<Json::Int64>(snapshot.mean);
+    json_value["p50"] = static_cast<Json::Int64>(snapshot.p50);
+    json_value["p90"] = static_cast<Json::Int64>(snapshot.p90);
+    json_value["p99"] = static_cast<Json::Int64>(snapshot.p99);
+    return json_value;
+}
+
+Json::Value toJson(const std::string& job_name, const JobStatistics::Snapshot& snapshot)
+{
+    Json::Value json_value;
+    json_value["job_name"] = job_name;
+    json_value["overrun_count"] = static_cast<Json::UInt64>(snapshot.overrun_count);
+    json_value["skipped_output_count"] = static_cast<Json::UInt64>(snapshot.skipped_output_count);
+    json_value["execute"] = toJson(snapshot.execute);
+    json_value["data_in"] = toJson(snapshot.data_in);
+    json_value["data_out"] = toJson(snapshot.data_out);
+    json_value["wakeup_jitter"] = toJson(snapshot.wakeup_jitter);
+    return json_value;
+}
+
+} // namespace
+
+std::string RPCJobStatistics::getJobNames()
+{
+    const auto job_names = _job_statistics->getJobNames();
+    auto first = true;
+    std::string return_string;
+    for (const auto& job_name : job_names)
+    {
+        if (first)
+        {
+            return_string = job_name;
+            first = false;
+        }
+        else
+        {
+            return_string += "," + job_name;
+        }
+    }
+    return return_string;
+}
+
+Json::Value RPCJobStatistics::getJobStatistics(const std::string& job_name)
+{
+    const auto statistics = _job_statistics->findJobStatistics(job_name);
+    if (!statistics)
+    {
+        Json::Value json_value;
+        json_value["job_name"] = "";
+        return json_value;
+    }
+    return toJson(job_name, statistics->getSnapshot());
+}
+
+Json::Value RPCJobStatistics::getAllJobStatistics()
+{
+    Json::Value json_value(Json::arrayValue);
+    for (const auto& job_name : _job_statistics->getJobNames())
+    {
+        const auto statistics = _job_statistics->findJobStatistics(job_name);
+        if (statistics)
+        {
+            json_value.append(toJson(job_name, statistics->getSnapshot()));
+        }
+    }
+    return json_value;
+}
+
+int RPCJobStatistics::resetJobStatistics()
+{
+    _job_statistics->reset();
+    return 0;
+}
+
 LocalSchedulerService::LocalSchedulerService()
     : ComponentBase()
     , _logger_wrapper_forward(std::make_shared<LoggerForward>())
+    , _job_statistics(std::make_shared<JobStatisticsRegistry>())
 {
     createSchedulerRegistry();
 }
 
 void LocalSchedulerService::createSchedulerRegistry()
 {
-    std::unique_ptr<IScheduler> local_clock_based_scheduler =
-        std::make_unique<LocalClockBasedScheduler>(
-            _logger_wrapper_forward,
-            _set_participant_to_error_state);
+    auto clock_based_scheduler = std::make_unique<LocalClockBasedScheduler>(
+        _logger_wrapper_forward,
+        _set_participant_to_error_state,
+        _job_statistics,
+        _job_execution_configuration);
+    std::unique_ptr<IScheduler> local_clock_based_scheduler = std::move(clock_based_scheduler);
     _scheduler_registry =
         std::make_unique<fep3::native::LocalSchedulerRegistry>(std::move(local_clock_based_scheduler));
 }
@@ -108,12 +209,26 @@ fep3::Result LocalSchedulerService::create()
     }
 
     FEP3_RETURN_IF_FAILED(setupRPCSchedulerService(*rpc_server));
+    FEP3_RETURN_IF_FAILED(setupRPCJobStatistics(*rpc_server));
+
+    FEP3_RETURN_IF_FAILED(registerDataTriggeredScheduler(*components));
 
     return {};
 }
 
 fep3::Result LocalSchedulerService::destroy()
 {   
+    if (_data_triggered_scheduler_registered)
+    {
+        _data_triggered_scheduler_registered = false;
+        _scheduler_registry->unregisterScheduler(FEP3_SCHEDULER_DATA_TRIGGERED);
+    }
+    if (_data_flow_scheduler_registered)
+    {
+        _data_flow_scheduler_registered = false;
+        _scheduler_registry->unregisterScheduler(FEP3_SCHEDULER_DATA_FLOW);
+    }
+
     _logger.reset();
     _logger_wrapper_forward->setLogger(_logger);
 
@@ -148,8 +263,16 @@ fep3::Result LocalSchedulerService::tense()
         RETURN_ERROR_DESCRIPTION(ERR_POINTER, "access to components was not possible");
     }
 
-    FEP3_RETURN_IF_FAILED(_scheduler_registry->setActiveScheduler(
-        _configuration._active_scheduler_name));
+    // the data flow scheduler is registered only if it is selected, so the list of schedulers stays unchanged otherwise
+    const std::string active_scheduler_name = _configuration._active_scheduler_name;
+    if (FEP3_SCHEDULER_DATA_FLOW == active_scheduler_name)
+    {
+        FEP3_RETURN_IF_FAILED(registerDataFlowScheduler(*components));
+    }
+
+    FEP3_RETURN_IF_FAILED(_scheduler_registry->setActiveScheduler(active_scheduler_name));
+
+    FEP3_RETURN_IF_FAILED(applyJobExecutionConfiguration());
 
     FEP3_RETURN_IF_FAILED(initScheduler(*components));
     
@@ -225,7 +348,18 @@ fep3::Result LocalSchedulerService::unregisterScheduler(const std::string & sche
 
     auto result = _scheduler_registry->unregisterScheduler(scheduler_name);
 
-    if (ERR_NOT_FOUND == result)
+    if (fep3::isOk(result))
+    {
+        if (FEP3_SCHEDULER_DATA_TRIGGERED == scheduler_name)
+        {
+            _data_triggered_scheduler_registered = false;
+        }
+        else if (FEP3_SCHEDULER_DATA_FLOW == scheduler_name)
+        {
+            _data_flow_scheduler_registered = false;
+        }
+    }
+    else if (ERR_NOT_FOUND == result)
     {
         result |= _logger->logError(result.getDescription());
     }
@@ -288,5 +422,110 @@ fep3::Result LocalSchedulerService::setupRPCSchedulerService(IServiceBus::IParti
     return {};
 }
 
+fep3::Result LocalSchedulerService::setupRPCJobStatistics(IServiceBus::IParticipantServer& rpc_server)
+{
+    if (!_rpc_job_statistics)
+    {
+        _rpc_job_statistics = std::make_shared<RPCJobStatistics>(_job_statistics);
+    }
+
+    FEP3_RETURN_IF_FAILED(rpc_server.registerService(rpc::IRPCJobStatisticsDef::getRPCDefaultName(),
+        _rpc_job_statistics));
+
+    return {};
+}
+
+fep3::Result LocalSchedulerService::registerDataTriggeredScheduler(const IComponents& components)
+{
+    // data triggered scheduling is only possible if there is a data registry to listen to
+    const auto data_registry = components.getComponent<IDataRegistry>();
+    if (!data_registry || _data_triggered_scheduler_registered)
+    {
+        return {};
+    }
+
+    FEP3_RETURN_IF_FAILED(registerScheduler(std::make_unique<LocalDataTriggeredScheduler>(
+        _logger_wrapper_forward,
+        _set_participant_to_error_state,
+        *data_registry,
+        _job_statistics,
+        _job_execution_configuration)));
+    _data_triggered_scheduler_registered = true;
+
+    return {};
+}
+
+fep3::Result LocalSchedulerService::registerDataFlowScheduler(const IComponents& components)
+{
+    if (_data_flow_scheduler_registered)
+    {
+        return {};
+    }
+
+    // the data registry is optional, without it the scheduler does not wait for the data to reach the readers
+    FEP3_RETURN_IF_FAILED(registerScheduler(std::make_unique<LocalDataFlowScheduler>(
+        _logger_wrapper_forward,
+        _set_participant_to_error_state,
+        _job_statistics,
+        _job_execution_configuration,
+        components.getComponent<IDataRegistry>())));
+    _data_flow_scheduler_registered = true;
+
+    return {};
+}
+
+fep3::Result LocalSchedulerService::applyJobExecutionConfiguration()
+{
+    const int32_t job_worker_thread_count = _configuration._job_worker_thread_count;
+    size_t thread_count = 0;
+    if (job_worker_thread_count == -1)
+    {
+        thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    else if (job_worker_thread_count < 0)
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_INVALID_ARG, "Invalid value %d for property '%s', the thread count must not be negative except -1",
+            job_worker_thread_count, FEP3_SCHEDULER_JOB_WORKER_THREAD_COUNT);
+    }
+    else
+    {
+        thread_count = static_cast<size_t>(job_worker_thread_count);
+    }
+
+    const bool parallel_job_execution = _configuration._parallel_job_execution;
+
+    const int32_t timer_spin_window_us = _configuration._timer_spin_window_us;
+    if (timer_spin_window_us < 0)
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_INVALID_ARG, "Invalid value %d for property '%s', the spin window must not be negative",
+            timer_spin_window_us, FEP3_SCHEDULER_TIMER_SPIN_WINDOW);
+    }
+    const Duration timer_spin_window = std::chrono::microseconds(timer_spin_window_us);
+
+    ThreadConfiguration scheduler_thread_configuration;
+    auto result = thread::parseConfiguration(_configuration._scheduler_thread_configuration, scheduler_thread_configuration);
+    if (isFailed(result))
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_INVALID_ARG, "Invalid value for property '%s': %s",
+            FEP3_SCHEDULER_THREAD_CONFIGURATION, result.getDescription());
+    }
+    ThreadConfiguration job_worker_thread_configuration;
+    result = thread::parseConfiguration(_configuration._job_worker_thread_configuration, job_worker_thread_configuration);
+    if (isFailed(result))
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_INVALID_ARG, "Invalid value for property '%s': %s",
+            FEP3_SCHEDULER_JOB_WORKER_THREAD_CONFIGURATION, result.getDescription());
+    }
+
+    // read by the native schedulers on initialize, which follows on tense
+    _job_execution_configuration->_job_worker_thread_count = thread_count;
+    _job_execution_configuration->_parallel_job_execution = parallel_job_execution;
+    _job_execution_configuration->_timer_spin_window = timer_spin_window;
+    _job_execution_configuration->_scheduler_thread_configuration = scheduler_thread_configuration;
+    _job_execution_configuration->_job_worker_thread_configuration = job_worker_thread_configuration;
+
+    return {};
+}
+
 } // namespace native
 } // namespace fep3
\ No newline at end of file
@@ -23,11 +23,16 @@
 #include <fep3/components/base/component_base.h>
 #include <fep3/components/scheduler/scheduler_service_intf.h>
 #include <fep3/native_components/scheduler/clock_based/local_clock_based_scheduler.h>
+#include <fep3/native_components/scheduler/data_triggered/local_data_triggered_scheduler.h>
+#include <fep3/native_components/scheduler/data_flow/local_data_flow_scheduler.h>
 #include <fep3/native_components/scheduler/local_scheduler_registry.h>
+#include <fep3/native_components/scheduler/job_execution_configuration.h>
 #include <fep3/native_components/job_registry/local_job_registry.h>
 #include <fep3/components/service_bus/rpc/fep_rpc_stubs_service.h>
 #include <fep3/rpc_services/scheduler_service/scheduler_service_rpc_intf_def.h>
 #include <fep3/rpc_services/scheduler_service/scheduler_service_service_stub.h>
+#include <fep3/rpc_services/job_statistics/job_statistics_rpc_intf_def.h>
+#include <fep3/rpc_services/job_statistics/job_statistics_service_stub.h>
 #include <fep3/components/service_bus/service_bus_intf.h>
 
 namespace fep3
@@ -127,6 +132,27 @@ private:
     LocalSchedulerService& _scheduler_service;
 };
 
+/**
+* @brief RPC service providing the runtime statistics of the jobs executed by the native schedulers
+*/
+class RPCJobStatistics : public rpc::RPCService<rpc_stubs::RPCJobStatisticsServiceStub, rpc::IRPCJobStatisticsDef>
+{
+public:
+    explicit RPCJobStatistics(const std::shared_ptr<JobStatisticsRegistry>& job_statistics)
+        : _job_statistics(job_statistics)
+    {
+    }
+
+protected:
+    std::string getJobNames() override;
+    Json::Value getJobStatistics(const std::string& job_name) override;
+    Json::Value getAllJobStatistics() override;
+    int resetJobStatistics() override;
+
+private:
+    std::shared_ptr<JobStatisticsRegistry> _job_statistics;
+};
+
 /**
 * @brief Configuration for the LocalClockService
 */
@@ -140,6 +166,11 @@ struct SchedulerServiceConfiguration : public Configuration
 
 public:
     PropertyVariable<std::string> _active_scheduler_name{ FEP3_SCHEDULER_CLOCK_BASED };
+    PropertyVariable<int32_t> _job_worker_thread_count{ FEP3_SCHEDULER_JOB_WORKER_THREAD_COUNT_DEFAULT_VALUE };
+    PropertyVariable<bool> _parallel_job_execution{ FEP3_SCHEDULER_PARALLEL_JOB_EXECUTION_DEFAULT_VALUE };
+    PropertyVariable<int32_t> _timer_spin_window_us{ FEP3_SCHEDULER_TIMER_SPIN_WINDOW_DEFAULT_VALUE };
+    PropertyVariable<std::string> _scheduler_thread_configuration{ "" };
+    PropertyVariable<std::string> _job_worker_thread_configuration{ "" };
 };
 
 class LocalSchedulerService
@@ -169,12 +200,21 @@ private:
     void createSchedulerRegistry();
     fep3::Result setupLogger(const IComponents& components);
     fep3::Result setupRPCSchedulerService(IServiceBus::IParticipantServer& rpc_server);
+    fep3::Result setupRPCJobStatistics(IServiceBus::IParticipantServer& rpc_server);
+    fep3::Result registerDataTriggeredScheduler(const IComponents& components);
+    fep3::Result registerDataFlowScheduler(const IComponents& components);
+    fep3::Result applyJobExecutionConfiguration();
 
  private:
     std::unique_ptr<fep3::native::LocalClockBasedScheduler> _local_clock_based_scheduler;
     std::unique_ptr<fep3::native::LocalSchedulerRegistry> _scheduler_registry;
     std::function<fep3::Result()> _set_participant_to_error_state;
     std::atomic_bool _started{false};
+    // the native schedulers are owned by the scheduler registry and may be unregistered by the user
+    bool _data_triggered_scheduler_registered{false};
+    bool _data_flow_scheduler_registered{false};
+    /// thread configuration of the native schedulers, updated from the properties on tense
+    std::shared_ptr<JobExecutionConfiguration> _job_execution_configuration{ std::make_shared<JobExecutionConfiguration>() };
     
     std::shared_ptr<const fep3::ILoggingService::ILogger> _logger;
     std::shared_ptr<LoggerForward> _logger_wrapper_forward;
@@ -182,6 +222,10 @@ private:
     SchedulerServiceConfiguration _configuration;
 
     std::shared_ptr<RPCSchedulerService> _rpc_scheduler_service{ nullptr };
+
+    /// runtime statistics of the jobs executed by the native schedulers
+    std::shared_ptr<JobStatisticsRegistry> _job_statistics;
+    std::shared_ptr<RPCJobStatistics> _rpc_job_statistics{ nullptr };
 };
 
 } // namespace native
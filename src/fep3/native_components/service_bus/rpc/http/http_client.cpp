@@ -18,11 +18,17 @@ namespace fep3
 {
 namespace native
 {
-HttpClientConnector::HttpClientConnector(const std::string& server_address)
+HttpClientConnector::HttpClientConnector(const std::string& server_address,
+    std::chrono::nanoseconds connect_timeout,
+    std::chrono::nanoseconds response_timeout)
 {
     fep3::helper::Url url(server_address);
     std::string new_server_address = url.scheme() + "://" + url.host() + ":" + url.port();
     _server_address = new_server_address;
+    if (url.scheme() == "http")
+    {
+        _connection_pool = HttpConnectionPool::get(url.host(), url.port(), connect_timeout, response_timeout);
+    }
 }
 
 HttpClientConnector::~HttpClientConnector()
@@ -33,6 +39,15 @@ fep3::Result HttpClientConnector::sendRequest(const std::string& service_name,
     const std::string& request_message,
     IRPCRequester::IRPCResponse& response_callback) const
 {
+    if (_connection_pool)
+    {
+        std::string response_message;
+        FEP3_RETURN_IF_FAILED(_connection_pool->post("/" + service_name, request_message, response_message));
+
+        response_callback.set(response_message);
+        return {};
+    }
+
     ::rpc::http::cJSONClientConnector con(_server_address + "/" + service_name);
     std::string response_message;
  
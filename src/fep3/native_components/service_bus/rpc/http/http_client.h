@@ -11,7 +11,11 @@
  */
 #pragma once
 
+#include <chrono>
+#include <memory>
+
 #include <fep3/components/service_bus/rpc/rpc_intf.h>
+#include "http_connection_pool.h"
 
 #pragma warning( push )
 #pragma warning( disable : 4290)
@@ -26,13 +30,22 @@ namespace native
 class HttpClientConnector : public rpc::arya::IRPCRequester
 {
     public:
-        explicit HttpClientConnector(const std::string& server_address);
+        /**
+         * @param server_address the url of the server
+         * @param connect_timeout the maximum time to wait for the server to accept a connection
+         * @param response_timeout the maximum time to wait for the response of a request
+         */
+        explicit HttpClientConnector(const std::string& server_address,
+            std::chrono::nanoseconds connect_timeout = http_connection::default_connect_timeout,
+            std::chrono::nanoseconds response_timeout = http_connection::default_response_timeout);
         virtual ~HttpClientConnector();
         fep3::Result sendRequest(const std::string& service_name,
                                  const std::string& request_message,
                                  IRPCRequester::IRPCResponse& response_callback) const override;
     private:
         std::string _server_address;
+        // kept-alive connections to the server, nullptr if the scheme is not plain http
+        std::shared_ptr<HttpConnectionPool> _connection_pool;
 };
 
 }
@@ -0,0 +1,604 @@
+/**
+ * @file
+ * @copyright AUDI AG
+ *            All right reserved.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ */
+#include "http_connection_pool.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <map>
+
+#include <a_util/result/error_def.h>
+
+#ifdef WIN32
+    #include <winsock2.h>
+    #include <ws2tcpip.h>
+    #define closeSocket(fd_socket) closesocket(fd_socket)
+    using socket_length = int;
+#else
+    #include <fcntl.h>
+    #include <netdb.h>
+    #include <netinet/in.h>
+    #include <netinet/tcp.h>
+    #include <poll.h>
+    #include <sys/socket.h>
+    #include <unistd.h>
+    #define SOCKET int
+    #define INVALID_SOCKET (-1)
+    #define closeSocket(fd_socket) close(fd_socket)
+    using socket_length = socklen_t;
+#endif
+
+using namespace std::chrono;
+
+namespace fep3
+{
+namespace native
+{
+
+namespace
+{
+
+constexpr size_t max_header_size = 64 * 1024;
+constexpr size_t receive_buffer_size = 16 * 1024;
+constexpr size_t max_idle_connections_per_server = 4;
+#ifdef MSG_NOSIGNAL
+// a connection closed by the server has to be reported by send instead of raising SIGPIPE
+constexpr int send_flags = MSG_NOSIGNAL;
+#else
+constexpr int send_flags = 0;
+#endif
+
+enum class ReceiveStatus
+{
+    received,
+    closed,
+    timeout,
+    failed
+};
+
+void initializeSockets()
+{
+#ifdef WIN32
+    static const int startup_result = []()
+    {
+        WSADATA wsa_data = { 0 };
+        return WSAStartup(MAKEWORD(2, 2), &wsa_data);
+    }();
+    (void)startup_result;
+#endif
+}
+
+SOCKET toSocket(intptr_t socket_handle)
+{
+    return static_cast<SOCKET>(socket_handle);
+}
+
+int pollSocket(SOCKET socket_handle, nanoseconds timeout, short events = POLLIN)
+{
+    pollfd poll_socket;
+    poll_socket.fd = socket_handle;
+    poll_socket.events = events;
+    poll_socket.revents = 0;
+
+    // round up, so a remaining timeout below one millisecond does not busy wait
+    const auto timeout_ms = duration_cast<milliseconds>(timeout + milliseconds(1) - nanoseconds(1)).count();
+#ifdef WIN32
+    return WSAPoll(&poll_socket, 1, static_cast<int>(timeout_ms));
+#else
+    return poll(&poll_socket, 1, static_cast<int>(timeout_ms));
+#endif
+}
+
+bool setNonBlocking(SOCKET socket_handle, bool non_blocking)
+{
+#ifdef WIN32
+    u_long mode = non_blocking ? 1 : 0;
+    return ioctlsocket(socket_handle, FIONBIO, &mode) == 0;
+#else
+    const auto flags = fcntl(socket_handle, F_GETFL, 0);
+    return flags != -1
+        && fcntl(socket_handle, F_SETFL, non_blocking ? (flags | O_NONBLOCK) : (flags & ~O_NONBLOCK)) == 0;
+#endif
+}
+
+/**
+ * Connects the socket but waits at most until @p deadline for the server to accept the connection.
+ */
+bool connectUntil(SOCKET socket_handle, const sockaddr* address, socket_length address_length,
+    steady_clock::time_point deadline)
+{
+    if (!setNonBlocking(socket_handle, true))
+    {
+        return false;
+    }
+    if (::connect(socket_handle, address, address_length) != 0)
+    {
+#ifdef WIN32
+        const bool in_progress = WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+        const bool in_progress = errno == EINPROGRESS;
+#endif
+        const auto now = steady_clock::now();
+        if (!in_progress || now >= deadline || pollSocket(socket_handle, deadline - now, POLLOUT) <= 0)
+        {
+            return false;
+        }
+        int socket_error = 0;
+        socket_length socket_error_length = sizeof(socket_error);
+        if (getsockopt(socket_handle, SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&socket_error), &socket_error_length) != 0
+            || socket_error != 0)
+        {
+            return false;
+        }
+    }
+    // sending blocks, receiving waits by poll with the response deadline
+    return setNonBlocking(socket_handle, false);
+}
+
+bool sendAll(SOCKET socket_handle, const char* data, size_t size)
+{
+    while (size > 0)
+    {
+        const auto sent = send(socket_handle, data, static_cast<int>(size), send_flags);
+        if (sent <= 0)
+        {
+            return false;
+        }
+        data += sent;
+        size -= static_cast<size_t>(sent);
+    }
+    return true;
+}
+
+/**
+ * Appends the data available next to @p buffer, waits for it until @p deadline.
+ */
+ReceiveStatus receiveMore(SOCKET socket_handle, std::string& buffer, steady_clock::time_point deadline)
+{
+    const auto now = steady_clock::now();
+    if (now >= deadline || pollSocket(socket_handle, deadline - now) <= 0)
+    {
+        return ReceiveStatus::timeout;
+    }
+
+    char data[receive_buffer_size];
+    const auto received = recv(socket_handle, data, static_cast<int>(sizeof(data)), 0);
+    if (received == 0)
+    {
+        return ReceiveStatus::closed;
+    }
+    if (received < 0)
+    {
+        return ReceiveStatus::failed;
+    }
+    buffer.append(data, static_cast<size_t>(received));
+    return ReceiveStatus::received;
+}
+
+std::string toLower(std::string value)
+{
+    std::transform(value.begin(), value.end(), value.begin(),
+        [](unsigned char character) { return static_cast<char>(std::tolower(character)); });
+    return value;
+}
+
+std::string trim(const std::string& value)
+{
+    const auto begin = value.find_first_not_of(" \t");
+    if (begin == std::string::npos)
+    {
+        return {};
+    }
+    return value.substr(begin, value.find_last_not_of(" \t") - begin + 1);
+}
+
+struct ResponseHeader
+{
+    int _status{ 0 };
+    bool _keep_alive{ false };
+    bool _chunked{ false };
+    bool _has_content_length{ false };
+    size_t _content_length{ 0 };
+};
+
+bool parseResponseHeader(const std::string& header, ResponseHeader& response_header)
+{
+    // status line: HTTP/1.1 200 OK
+    auto line_end = header.find("\r\n");
+    const auto status_line = header.substr(0, line_end);
+    if (status_line.size() < 12 || status_line.compare(0, 5, "HTTP/") != 0)
+    {
+        return false;
+    }
+    const auto version = status_line.substr(0, 8);
+    response_header._status = std::atoi(status_line.substr(9, 3).c_str());
+
+    std::string connection;
+    while (line_end != std::string::npos)
+    {
+        const auto line_begin = line_end + 2;
+        line_end = header.find("\r\n", line_begin);
+        const auto line = header.substr(line_begin, line_end == std::string::npos ? std::string::npos : line_end - line_begin);
+        const auto separator = line.find(':');
+        if (separator == std::string::npos)
+        {
+            continue;
+        }
+
+        const auto name = toLower(trim(line.substr(0, separator)));
+        const auto value = toLower(trim(line.substr(separator + 1)));
+        if (name == "content-length")
+        {
+            response_header._has_content_length = true;
+            response_header._content_length = static_cast<size_t>(std::strtoull(value.c_str(), nullptr, 10));
+        }
+        else if (name == "transfer-encoding")
+        {
+            response_header._chunked = value.find("chunked") != std::string::npos;
+        }
+        else if (name == "connection")
+        {
+            connection = value;
+        }
+    }
+
+    // HTTP/1.1 keeps the connection alive by default, HTTP/1.0 only if asked for
+    response_header._keep_alive = (version == "HTTP/1.1")
+        ? connection.find("close") == std::string::npos
+        : connection.find("keep-alive") != std::string::npos;
+
+    return true;
+}
+
+} // namespace
+
+HttpConnection::HttpConnection(const std::string& host,
+    const std::string& port,
+    nanoseconds connect_timeout,
+    nanoseconds response_timeout)
+    : _host(host)
+    , _port(port)
+    , _connect_timeout(connect_timeout)
+    , _response_timeout(response_timeout)
+{
+}
+
+HttpConnection::~HttpConnection()
+{
+    disconnect();
+}
+
+bool HttpConnection::isOpen() const
+{
+    return _socket != -1;
+}
+
+fep3::Result HttpConnection::connect()
+{
+    disconnect();
+    initializeSockets();
+
+    addrinfo hints;
+    std::memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* address_info = nullptr;
+    if (getaddrinfo(_host.c_str(), _port.c_str(), &hints, &address_info) != 0 || !address_info)
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_NOT_FOUND, "unable to resolve the http server address '%s:%s'",
+            _host.c_str(), _port.c_str());
+    }
+
+    // the timeout covers all addresses of the server, an unreachable server must not block the caller
+    const auto deadline = steady_clock::now() + _connect_timeout;
+    for (auto address = address_info; address; address = address->ai_next)
+    {
+        const auto socket_handle = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+        if (socket_handle == INVALID_SOCKET)
+        {
+            continue;
+        }
+        if (!connectUntil(socket_handle, address->ai_addr, static_cast<socket_length>(address->ai_addrlen), deadline))
+        {
+            closeSocket(socket_handle);
+            continue;
+        }
+
+        // a request is sent at once, waiting for more data to send would delay every request
+        int opt = 1;
+        setsockopt(socket_handle, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<char*>(&opt), sizeof(opt));
+        _socket = static_cast<intptr_t>(socket_handle);
+        break;
+    }
+    freeaddrinfo(address_info);
+
+    if (!isOpen())
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_NOT_CONNECTED, "unable to connect to the http server '%s:%s'",
+            _host.c_str(), _port.c_str());
+    }
+    return {};
+}
+
+void HttpConnection::disconnect()
+{
+    if (_socket != -1)
+    {
+        closeSocket(toSocket(_socket));
+        _socket = -1;
+    }
+}
+
+bool HttpConnection::isClosedByServer() const
+{
+    // an idle connection is readable only if the server closed it (or sent garbage)
+    return pollSocket(toSocket(_socket), nanoseconds(0)) != 0;
+}
+
+fep3::Result HttpConnection::post(const std::string& path, const std::string& body, std::string& response_body)
+{
+    if (isOpen() && isClosedByServer())
+    {
+        disconnect();
+    }
+
+    std::string request;
+    request.reserve(body.size() + 256);
+    request += "POST " + path + " HTTP/1.1\r\n";
+    request += "Host: " + _host + ":" + _port + "\r\n";
+    request += "Content-Type: application/json\r\n";
+    request += "Content-Length: " + std::to_string(body.size()) + "\r\n";
+    request += "Connection: keep-alive\r\n\r\n";
+    request += body;
+
+    while (true)
+    {
+        const bool reused = isOpen();
+        if (!reused)
+        {
+            FEP3_RETURN_IF_FAILED(connect());
+        }
+
+        bool closed_before_response = true;
+        fep3::Result result;
+        if (!sendAll(toSocket(_socket), request.data(), request.size()))
+        {
+            result = CREATE_ERROR_DESCRIPTION(ERR_NOT_CONNECTED, "unable to send the request to the http server '%s:%s'",
+                _host.c_str(), _port.c_str());
+        }
+        else
+        {
+            result = receiveResponse(response_body, closed_before_response);
+        }
+        if (isOk(result))
+        {
+            return {};
+        }
+
+        disconnect();
+        // the server most likely closed the kept-alive connection before the request reached it,
+        // see the documentation of post for the case it processed the request
+        if (!reused || !closed_before_response)
+        {
+            return result;
+        }
+    }
+}
+
+fep3::Result HttpConnection::receiveResponse(std::string& response_body, bool& closed_before_response)
+{
+    const auto socket_handle = toSocket(_socket);
+    const auto deadline = steady_clock::now() + _response_timeout;
+    closed_before_response = false;
+
+    std::string buffer;
+    size_t header_end = std::string::npos;
+    while ((header_end = buffer.find("\r\n\r\n")) == std::string::npos)
+    {
+        if (buffer.size() > max_header_size)
+        {
+            RETURN_ERROR_DESCRIPTION(ERR_FAILED, "invalid response header of the http server '%s:%s'",
+                _host.c_str(), _port.c_str());
+        }
+
+        const auto status = receiveMore(socket_handle, buffer, deadline);
+        if (status == ReceiveStatus::timeout)
+        {
+            RETURN_ERROR_DESCRIPTION(ERR_TIMEOUT, "no response of the http server '%s:%s' within %lld ms",
+                _host.c_str(), _port.c_str(), static_cast<long long>(duration_cast<milliseconds>(_response_timeout).count()));
+        }
+        else if (status != ReceiveStatus::received)
+        {
+            closed_before_response = buffer.empty();
+            RETURN_ERROR_DESCRIPTION(ERR_NOT_CONNECTED, "the http server '%s:%s' closed the connection",
+                _host.c_str(), _port.c_str());
+        }
+    }
+
+    ResponseHeader header;
+    if (!parseResponseHeader(buffer.substr(0, header_end), header))
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_FAILED, "invalid response header of the http server '%s:%s'",
+            _host.c_str(), _port.c_str());
+    }
+    buffer.erase(0, header_end + 4);
+
+    response_body.clear();
+    bool connection_closed = false;
+    if (header._chunked)
+    {
+        size_t position = 0;
+        while (true)
+        {
+            const auto size_end = buffer.find("\r\n", position);
+            if (size_end == std::string::npos)
+            {
+                if (receiveMore(socket_handle, buffer, deadline) != ReceiveStatus::received)
+                {
+                    RETURN_ERROR_DESCRIPTION(ERR_FAILED, "incomplete response of the http server '%s:%s'",
+                        _host.c_str(), _port.c_str());
+                }
+                continue;
+            }
+
+            const auto chunk_size = static_cast<size_t>(
+                std::strtoull(buffer.substr(position, size_end - position).c_str(), nullptr, 16));
+            if (chunk_size == 0)
+            {
+                // the last chunk is followed by optional trailers and an empty line
+                while (buffer.find("\r\n\r\n", size_end) == std::string::npos)
+                {
+                    if (receiveMore(socket_handle, buffer, deadline) != ReceiveStatus::received)
+                    {
+                        RETURN_ERROR_DESCRIPTION(ERR_FAILED, "incomplete response of the http server '%s:%s'",
+                            _host.c_str(), _port.c_str());
+                    }
+                }
+                break;
+            }
+
+            while (buffer.size() < size_end + 2 + chunk_size + 2)
+            {
+                if (receiveMore(socket_handle, buffer, deadline) != ReceiveStatus::received)
+                {
+                    RETURN_ERROR_DESCRIPTION(ERR_FAILED, "incomplete response of the http server '%s:%s'",
+                        _host.c_str(), _port.c_str());
+                }
+            }
+            response_body.append(buffer, size_end + 2, chunk_size);
+            position = size_end + 2 + chunk_size + 2;
+        }
+    }
+    else if (header._has_content_length)
+    {
+        while (buffer.size() < header._content_length)
+        {
+            if (receiveMore(socket_handle, buffer, deadline) != ReceiveStatus::received)
+            {
+                RETURN_ERROR_DESCRIPTION(ERR_FAILED, "incomplete response of the http server '%s:%s'",
+                    _host.c_str(), _port.c_str());
+            }
+        }
+        response_body = buffer.substr(0, header._content_length);
+    }
+    else
+    {
+        // the body ends with the connection
+        ReceiveStatus status;
+        while ((status = receiveMore(socket_handle, buffer, deadline)) == ReceiveStatus::received)
+        {
+        }
+        if (status != ReceiveStatus::closed)
+        {
+            RETURN_ERROR_DESCRIPTION(ERR_FAILED, "incomplete response of the http server '%s:%s'",
+                _host.c_str(), _port.c_str());
+        }
+        response_body = std::move(buffer);
+        connection_closed = true;
+    }
+
+    if (connection_closed || !header._keep_alive)
+    {
+        disconnect();
+    }
+
+    if (header._status < 200 || header._status >= 300)
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_UNEXPECTED, "the http server '%s:%s' responded with status %d",
+            _host.c_str(), _port.c_str(), header._status);
+    }
+    return {};
+}
+
+HttpConnectionPool::HttpConnectionPool(const std::string& host,
+    const std::string& port,
+    size_t max_idle_connections,
+    nanoseconds connect_timeout,
+    nanoseconds response_timeout)
+    : _host(host)
+    , _port(port)
+    , _max_idle_connections(max_idle_connections)
+    , _connect_timeout(connect_timeout)
+    , _response_timeout(response_timeout)
+{
+}
+
+fep3::Result HttpConnectionPool::post(const std::string& path, const std::string& body, std::string& response_body)
+{
+    auto connection = acquire();
+    const auto result = connection->post(path, body, response_body);
+    release(std::move(connection));
+
+    return result;
+}
+
+std::unique_ptr<HttpConnection> HttpConnectionPool::acquire()
+{
+    {
+        std::lock_guard<std::mutex> lock(_idle_connections_mutex);
+        if (!_idle_connections.empty())
+        {
+            auto connection = std::move(_idle_connections.back());
+            _idle_connections.pop_back();
+            return connection;
+        }
+    }
+    return std::make_unique<HttpConnection>(_host, _port, _connect_timeout, _response_timeout);
+}
+
+void HttpConnectionPool::release(std::unique_ptr<HttpConnection> connection)
+{
+    if (!connection->isOpen())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_idle_connections_mutex);
+    if (_idle_connections.size() < _max_idle_connections)
+    {
+        _idle_connections.push_back(std::move(connection));
+    }
+}
+
+std::shared_ptr<HttpConnectionPool> HttpConnectionPool::get(const std::string& host,
+    const std::string& port,
+    nanoseconds connect_timeout,
+    nanoseconds response_timeout)
+{
+    static std::mutex pools_mutex;
+    static std::map<std::string, std::weak_ptr<HttpConnectionPool>> pools;
+
+    std::lock_guard<std::mutex> lock(pools_mutex);
+    // requesters with other timeouts do not share the connections
+    const auto address = host + ":" + port + "/" + std::to_string(connect_timeout.count())
+        + "/" + std::to_string(response_timeout.count());
+    auto pool = pools[address].lock();
+    if (!pool)
+    {
+        // the pools of servers no requester uses anymore are removed with their connections
+        for (auto it = pools.begin(); it != pools.end();)
+        {
+            it = it->second.expired() ? pools.erase(it) : std::next(it);
+        }
+        pool = std::make_shared<HttpConnectionPool>(host, port, max_idle_connections_per_server,
+            connect_timeout, response_timeout);
+        pools[address] = pool;
+    }
+    return pool;
+}
+
+} // namespace native
+} // namespace fep3
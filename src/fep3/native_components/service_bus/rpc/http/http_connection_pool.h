@@ -0,0 +1,144 @@
+/**
+ * @file
+ * @copyright AUDI AG
+ *            All right reserved.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ */
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <fep3/fep3_errors.h>
+
+namespace fep3
+{
+namespace native
+{
+
+namespace http_connection
+{
+/// default timeout for establishing the connection to the server
+constexpr std::chrono::seconds default_connect_timeout{ 5 };
+/// default timeout for the response, long running rpc calls (e.g. state transitions of the participant) must not time out
+constexpr std::chrono::seconds default_response_timeout{ 60 };
+} // namespace http_connection
+
+/**
+ * HTTP/1.1 connection to one server, kept open between the requests (keep-alive).
+ * Not thread-safe, the @ref HttpConnectionPool hands out every connection to one caller at a time.
+ */
+class HttpConnection
+{
+public:
+    /**
+     * @param host the host of the server
+     * @param port the port of the server
+     * @param connect_timeout the maximum time to wait for the server to accept the connection
+     * @param response_timeout the maximum time to wait for the complete response of a request
+     */
+    HttpConnection(const std::string& host,
+        const std::string& port,
+        std::chrono::nanoseconds connect_timeout = http_connection::default_connect_timeout,
+        std::chrono::nanoseconds response_timeout = http_connection::default_response_timeout);
+    ~HttpConnection();
+    HttpConnection(const HttpConnection&) = delete;
+    HttpConnection(HttpConnection&&) = delete;
+    HttpConnection& operator=(const HttpConnection&) = delete;
+    HttpConnection& operator=(HttpConnection&&) = delete;
+
+    /**
+     * Posts @p body to @p path and receives the response body.
+     * A kept-alive connection closed by the server in the meantime is reconnected transparently.
+     * If the server closes a reused connection before sending any byte of the response,
+     * the request is sent once more on a new connection. This is the usual race of a server closing
+     * an idle connection while the request is sent, but a server closing the connection
+     * after it processed the request without responding (e.g. it crashed) gets the request twice.
+     * This is acceptable for the rpc requests, because a server failing that way is not usable anymore.
+     *
+     * @param path the path of the request
+     * @param body the json body of the request
+     * @param response_body the body of the response
+     * @return ERR_NOERROR if the server responded with a 2xx status, an error otherwise
+     */
+    fep3::Result post(const std::string& path, const std::string& body, std::string& response_body);
+    /**
+     * @return true if the connection is open and may be reused for the next request
+     */
+    bool isOpen() const;
+
+private:
+    fep3::Result connect();
+    void disconnect();
+    bool isClosedByServer() const;
+    /**
+     * @param [out] closed_before_response true if the server closed the connection without sending any response byte
+     */
+    fep3::Result receiveResponse(std::string& response_body, bool& closed_before_response);
+
+private:
+    const std::string _host;
+    const std::string _port;
+    const std::chrono::nanoseconds _connect_timeout;
+    const std::chrono::nanoseconds _response_timeout;
+    intptr_t _socket{ -1 };
+};
+
+/**
+ * Pool of kept-alive connections to one server.
+ * Concurrent callers get a connection each, idle connections are reused by the following requests.
+ */
+class HttpConnectionPool
+{
+public:
+    /**
+     * @param host the host of the server
+     * @param port the port of the server
+     * @param max_idle_connections the maximum number of connections kept open while not in use
+     * @param connect_timeout the maximum time to wait for the server to accept a connection
+     * @param response_timeout the maximum time to wait for the complete response of a request
+     */
+    HttpConnectionPool(const std::string& host,
+        const std::string& port,
+        size_t max_idle_connections,
+        std::chrono::nanoseconds connect_timeout = http_connection::default_connect_timeout,
+        std::chrono::nanoseconds response_timeout = http_connection::default_response_timeout);
+
+    /**
+     * @copydoc HttpConnection::post
+     */
+    fep3::Result post(const std::string& path, const std::string& body, std::string& response_body);
+
+    /**
+     * @return the pool shared by all requesters of the server @p host : @p port using the same timeouts
+     */
+    static std::shared_ptr<HttpConnectionPool> get(const std::string& host,
+        const std::string& port,
+        std::chrono::nanoseconds connect_timeout = http_connection::default_connect_timeout,
+        std::chrono::nanoseconds response_timeout = http_connection::default_response_timeout);
+
+private:
+    std::unique_ptr<HttpConnection> acquire();
+    void release(std::unique_ptr<HttpConnection> connection);
+
+private:
+    const std::string _host;
+    const std::string _port;
+    const size_t _max_idle_connections;
+    const std::chrono::nanoseconds _connect_timeout;
+    const std::chrono::nanoseconds _response_timeout;
+    std::mutex _idle_connections_mutex;
+    std::vector<std::unique_ptr<HttpConnection>> _idle_connections;
+};
+
+} // namespace native
+} // namespace fep3
@@ -44,8 +44,9 @@ struct RPCResponseToFEPResponse : public rpc::arya::IRPCRequester::IRPCResponse
  *
  *******************************************************************************************/
 
-HttpServer::RPCObjectToRPCServerWrapper::RPCObjectToRPCServerWrapper(const std::shared_ptr<IRPCService>& service)
-    : _service(service)
+HttpServer::RPCObjectToRPCServerWrapper::RPCObjectToRPCServerWrapper(const HttpServer& server,
+    const std::string& service_name)
+    : _server(server), _service_name(service_name)
 {
 }
 
@@ -54,43 +55,21 @@ a_util::result::Result HttpServer::RPCObjectToRPCServerWrapper::HandleCall(
     size_t,
     ::rpc::IResponse& oResponse)
 {
+    //the service is kept alive until the call returns, even if it is unregistered meanwhile
+    const auto service = _server.getServiceByName(_service_name);
+    if (!service)
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_NOT_FOUND,
+            "Service with the name %s does not exists",
+            _service_name.c_str());
+    }
     RPCResponseToFEPResponse response_convert(oResponse);
-    return _service->handleRequest(
+    return service->handleRequest(
         "json",
         strRequest,
         response_convert);
 }
 
-std::shared_ptr<rpc::arya::IRPCServer::IRPCService> HttpServer::RPCObjectToRPCServerWrapper::getService() const
-{
-    return _service;
-}
-
-class HttpRestarter
-{
-public:
-    explicit HttpRestarter(::rpc::http::cJSONRPCServer& server,
-                           std::string& url,
-                           bool is_started) : _server(server), _url(url), _is_started(is_started)
-    {
-        if (_is_started)
-        {
-            _server.StopListening();
-        }
-    }
-    ~HttpRestarter()
-    {
-        if (_is_started)
-        {
-            _server.StartListening(_url.c_str());
-        }
-    }
-private:
-    ::rpc::http::cJSONRPCServer& _server;
-    std::string& _url;
-    bool _is_started;
-};
-
 /*******************************************************************************************
  *
  *******************************************************************************************/
@@ -109,7 +88,6 @@ HttpServer::HttpServer(const std::string& name,
         startDiscovery(std::chrono::seconds(5));
     }
     _http_server.StartListening(_url.c_str());
-    _is_started = true;
 }
 
 void HttpServer::checkUrlAndSetDefaultIfNecessary()
@@ -193,14 +171,15 @@ void HttpServer::stopDiscovery()
 
 HttpServer::~HttpServer()
 {
-    _is_started = false;
+    //no request is in flight on the wrappers afterwards
     _http_server.StopListening();
-    
-    while (!_service_wrappers.empty())
+
+    for (const auto& wrapper : _service_wrappers)
     {
-        const auto& it = _service_wrappers.begin();
-        unregisterService(it->first);
+        _http_server.UnregisterRPCObject(wrapper.first.c_str());
     }
+    _service_wrappers.clear();
+    std::atomic_store(&_services, std::make_shared<const Services>());
 
     stopDiscovery();
 }
@@ -208,52 +187,58 @@ HttpServer::~HttpServer()
 fep3::Result HttpServer::registerService(const std::string& service_name,
     const std::shared_ptr<IRPCService>& service)
 {
-    std::lock_guard<std::recursive_mutex> _lock(_sync_wrappers);
-    
-    HttpRestarter restarter(_http_server, _url, _is_started);
+    std::lock_guard<std::mutex> _lock(_sync_wrappers);
 
-    const auto& service_found = _service_wrappers.find(service_name);
-    if (service_found != _service_wrappers.cend())
+    const auto services = std::atomic_load(&_services);
+    if (services->find(service_name) != services->cend())
     {
         RETURN_ERROR_DESCRIPTION(ERR_INVALID_ARG,
             "Service with the name %s already exists",
             service_name.c_str());
     }
-    else
+
+    //the http server keeps the wrapper of a service name registered once it was created,
+    //so registering the service again only changes our own service table
+    if (_service_wrappers.find(service_name) == _service_wrappers.cend())
     {
-        auto wrapper = std::make_shared<HttpServer::RPCObjectToRPCServerWrapper>(service);
-        auto res = _http_server.RegisterRPCObject(service_name.c_str(), wrapper.get());
-        if (fep3::isOk(res))
-        {
-            _service_wrappers[service_name] = wrapper;
-            return {};
-        }
-        else
-        {
-            return res;
-        }
+        FEP3_RETURN_IF_FAILED(registerServiceWrapper(service_name));
     }
+
+    auto new_services = std::make_shared<Services>(*services);
+    (*new_services)[service_name] = service;
+    std::atomic_store(&_services, std::shared_ptr<const Services>(std::move(new_services)));
+    return {};
 }
 
+fep3::Result HttpServer::registerServiceWrapper(const std::string& service_name)
+{
+    auto wrapper = std::make_unique<HttpServer::RPCObjectToRPCServerWrapper>(*this, service_name);
+    auto res = _http_server.RegisterRPCObject(service_name.c_str(), wrapper.get());
+    if (fep3::isFailed(res))
+    {
+        return res;
+    }
+    _service_wrappers[service_name] = std::move(wrapper);
+    return {};
+}
 
-fep3::Result HttpServer::unregisterService(const std::string& servcie_name)
+fep3::Result HttpServer::unregisterService(const std::string& service_name)
 {
-    std::lock_guard<std::recursive_mutex> _lock(_sync_wrappers);
-    HttpRestarter restarter(_http_server, _url, _is_started);
+    std::lock_guard<std::mutex> _lock(_sync_wrappers);
 
-    const auto& service_found = _service_wrappers.find(servcie_name);
-    if (service_found == _service_wrappers.end())
+    const auto services = std::atomic_load(&_services);
+    if (services->find(service_name) == services->cend())
     {
         RETURN_ERROR_DESCRIPTION(ERR_INVALID_ARG,
             "Service with the name %s does not exists",
-            servcie_name.c_str());
-    }
-    else
-    {
-        _http_server.UnregisterRPCObject(servcie_name.c_str());
-        _service_wrappers.erase(servcie_name);
-        return {};
+            service_name.c_str());
     }
+
+    //requests for the service name are answered with an error by its wrapper from now on
+    auto new_services = std::make_shared<Services>(*services);
+    new_services->erase(service_name);
+    std::atomic_store(&_services, std::shared_ptr<const Services>(std::move(new_services)));
+    return {};
 }
 
 std::string HttpServer::getUrl() const
@@ -263,9 +248,9 @@ std::string HttpServer::getUrl() const
 
 std::vector<std::string> HttpServer::getRegisteredServiceNames() const
 {
-    std::lock_guard<std::recursive_mutex> _lock(_sync_wrappers);
+    const auto services = std::atomic_load(&_services);
     std::vector<std::string> names;
-    for (const auto& value : _service_wrappers)
+    for (const auto& value : *services)
     {
         names.push_back(value.first);
     }
@@ -274,12 +259,12 @@ std::vector<std::string> HttpServer::getRegisteredServiceNames() const
 
 std::shared_ptr<rpc::arya::IRPCServer::IRPCService> HttpServer::getServiceByName(const std::string& service_name) const
 {
-    std::lock_guard<std::recursive_mutex> _lock(_sync_wrappers);
+    const auto services = std::atomic_load(&_services);
 
-    const auto& service_found = _service_wrappers.find(service_name);
-    if (service_found != _service_wrappers.end())
+    const auto& service_found = services->find(service_name);
+    if (service_found != services->end())
     {
-        return service_found->second->getService();
+        return service_found->second;
     }
     else
     {
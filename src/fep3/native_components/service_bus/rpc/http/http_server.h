@@ -12,6 +12,8 @@
 #pragma once
 
 #include <fep3/components/service_bus/service_registry_base.hpp>
+#include <atomic>
+#include <map>
 #include <mutex>
 
 #pragma warning( push )
@@ -30,17 +32,23 @@ namespace native
 class HttpServer : public fep3::base::arya::ServiceRegistryBase
 {
     public:
+        /**
+         * Entry point of the http server for one service name.
+         * The http server resolves the object of a request by its path, which is the service name,
+         * and does not pass the name to the object. So every service name gets one wrapper, which
+         * dispatches the calls to the service table of the @ref HttpServer.
+         */
         struct RPCObjectToRPCServerWrapper : public ::rpc::IRPCObject
         {
             public:
-                explicit RPCObjectToRPCServerWrapper(const std::shared_ptr<IRPCService>& service);
+                RPCObjectToRPCServerWrapper(const HttpServer& server, const std::string& service_name);
                 virtual ~RPCObjectToRPCServerWrapper() = default;
                 a_util::result::Result HandleCall(const char* strRequest,
                                                 size_t nRequestSize,
                                                 ::rpc::IResponse& oResponse);
-                std::shared_ptr<IRPCServer::IRPCService> getService() const;
             private:
-                std::shared_ptr<IRPCServer::IRPCService> _service;
+                const HttpServer& _server;
+                const std::string _service_name;
         };
 
     public:
@@ -65,9 +73,15 @@ class HttpServer : public fep3::base::arya::ServiceRegistryBase
 
     private:
         ::rpc::http::cJSONRPCServer _http_server;
-        std::map<std::string, std::shared_ptr<RPCObjectToRPCServerWrapper>> _service_wrappers;
-        mutable std::recursive_mutex _sync_wrappers;
-        bool _is_started = false;
+        using Services = std::map<std::string, std::shared_ptr<IRPCService>>;
+
+        // only accessed by std::atomic_load and std::atomic_store
+        std::shared_ptr<const Services> _services{ std::make_shared<Services>() };
+        // the wrappers stay registered at the http server until destruction, requests may be in flight on them
+        std::map<std::string, std::unique_ptr<RPCObjectToRPCServerWrapper>> _service_wrappers;
+        // serializes registerService and unregisterService
+        std::mutex _sync_wrappers;
+        fep3::Result registerServiceWrapper(const std::string& service_name);
 
         void checkUrlAndSetDefaultIfNecessary();
         std::string _url;
@@ -12,6 +12,7 @@
 #include "http_systemaccess.h"
 #include "http_server.h"
 #include "http_client.h"
+#include "local_requester.h"
 #include <../3rdparty/lssdp-cpp/src/url/cxx_url.h>
 
 #include <../3rdparty/lssdp-cpp/src/lssdpcpp/lssdpcpp.h>
@@ -304,6 +305,7 @@ std::shared_ptr<IServiceBus::IParticipantServer> HttpSystemAccess::createAServer
             getUrl());
         //very important to call!!
         server->initialize();
+        LocalServerRegistry::add(server);
         return server;
     }
 }
@@ -325,6 +327,12 @@ std::shared_ptr<IServiceBus::IParticipantRequester> HttpSystemAccess::createAReq
         }
         else
         {
+            //the far server lives in this process (might be our own one), so we do not go via a socket
+            auto local_requester = LocalServerRegistry::findRequester(far_server_url);
+            if (local_requester)
+            {
+                return local_requester;
+            }
             std::string use_url = far_server_url;
             if (url_check.host() == "0.0.0.0")
             {
@@ -0,0 +1,138 @@
+/**
+ * @file
+ * @copyright AUDI AG
+ *            All right reserved.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ */
+#include "local_requester.h"
+#include "http_server.h"
+#include <../3rdparty/lssdp-cpp/src/url/cxx_url.h>
+
+#include <map>
+#include <mutex>
+
+#include <a_util/result/error_def.h>
+
+using namespace fep3::arya;
+
+namespace fep3
+{
+namespace native
+{
+
+namespace
+{
+
+/**
+ * A server listening on 0.0.0.0 is reached by 127.0.0.1 or localhost as well,
+ * so all of them share one key.
+ */
+std::string makeServerKey(const std::string& server_url)
+{
+    fep3::helper::Url url(server_url);
+    if (url.scheme() != "http")
+    {
+        return {};
+    }
+    std::string host = url.host();
+    if (host == "0.0.0.0" || host == "localhost")
+    {
+        host = "127.0.0.1";
+    }
+    return host + ":" + url.port();
+}
+
+std::mutex& getServersMutex()
+{
+    static std::mutex servers_mutex;
+    return servers_mutex;
+}
+
+std::map<std::string, std::weak_ptr<HttpServer>>& getServers()
+{
+    static std::map<std::string, std::weak_ptr<HttpServer>> servers;
+    return servers;
+}
+
+} // namespace
+
+LocalRequester::LocalRequester(const std::weak_ptr<HttpServer>& server)
+    : _server(server)
+{
+}
+
+fep3::Result LocalRequester::sendRequest(const std::string& service_name,
+    const std::string& request_message,
+    IRPCRequester::IRPCResponse& response_callback) const
+{
+    //keeps the server alive while the service handles the request
+    const auto server = _server.lock();
+    if (!server)
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_NOT_CONNECTED,
+            "the server of the service '%s' does not exist anymore",
+            service_name.c_str());
+    }
+    const auto service = server->getServiceByName(service_name);
+    if (!service)
+    {
+        RETURN_ERROR_DESCRIPTION(ERR_NOT_FOUND,
+            "service '%s' is not registered at the server '%s'",
+            service_name.c_str(),
+            server->getUrl().c_str());
+    }
+    return service->handleRequest("json", request_message, response_callback);
+}
+
+void LocalServerRegistry::add(const std::shared_ptr<HttpServer>& server)
+{
+    const auto key = makeServerKey(server->getUrl());
+    if (key.empty())
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(getServersMutex());
+    getServers()[key] = server;
+}
+
+std::shared_ptr<rpc::arya::IRPCRequester> LocalServerRegistry::findRequester(const std::string& server_url)
+{
+    std::string key;
+    try
+    {
+        key = makeServerKey(server_url);
+    }
+    catch (const fep3::helper::Url::parse_error&)
+    {
+        return {};
+    }
+
+    std::lock_guard<std::mutex> lock(getServersMutex());
+    auto& servers = getServers();
+    for (auto server = servers.begin(); server != servers.end();)
+    {
+        if (server->second.expired())
+        {
+            server = servers.erase(server);
+        }
+        else
+        {
+            ++server;
+        }
+    }
+
+    const auto found = servers.find(key);
+    if (found == servers.end())
+    {
+        return {};
+    }
+    return std::make_shared<LocalRequester>(found->second);
+}
+
+}
+}
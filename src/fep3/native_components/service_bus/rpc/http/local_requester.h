@@ -0,0 +1,63 @@
+/**
+ * @file
+ * @copyright AUDI AG
+ *            All right reserved.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ */
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <fep3/components/service_bus/rpc/rpc_intf.h>
+
+namespace fep3
+{
+namespace native
+{
+
+class HttpServer;
+
+/**
+ * Requester calling the services of a server living in the same process directly,
+ * without a socket and without HTTP framing.
+ * The JSON request and response messages are the same as for the @ref HttpClientConnector.
+ */
+class LocalRequester : public rpc::arya::IRPCRequester
+{
+    public:
+        explicit LocalRequester(const std::weak_ptr<HttpServer>& server);
+        fep3::Result sendRequest(const std::string& service_name,
+                                 const std::string& request_message,
+                                 IRPCRequester::IRPCResponse& response_callback) const override;
+    private:
+        std::weak_ptr<HttpServer> _server;
+};
+
+/**
+ * Process wide registry of the @ref HttpServer instances.
+ * Requesters to a server url found here are short-circuited by a @ref LocalRequester.
+ */
+class LocalServerRegistry
+{
+    public:
+        /**
+         * Registers @p server under its url, a server registered before with the same url is replaced.
+         * The registry does not keep the server alive, destroyed servers are dropped on the next lookup.
+         */
+        static void add(const std::shared_ptr<HttpServer>& server);
+        /**
+         * @param server_url the url of the far server
+         * @return a @ref LocalRequester if a server with the url @p server_url lives in this process,
+         *         nullptr otherwise
+         */
+        static std::shared_ptr<rpc::arya::IRPCRequester> findRequester(const std::string& server_url);
+};
+
+}
+}
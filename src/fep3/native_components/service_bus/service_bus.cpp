@@ -15,6 +15,7 @@
 #include <../3rdparty/lssdp-cpp/src/url/cxx_url.h>
 #include "rpc/http/http_server.h"
 #include "rpc/http/http_client.h"
+#include "rpc/http/local_requester.h"
 #include <a_util/result.h>
 
 namespace fep3
@@ -281,6 +282,11 @@ std::shared_ptr<IServiceBus::IParticipantRequester> ServiceBus::getRequester(con
         }
         else
         {
+            auto local_requester = LocalServerRegistry::findRequester(far_server_address);
+            if (local_requester)
+            {
+                return local_requester;
+            }
             return std::make_shared<HttpClientConnector>(far_server_address);
         }
     }
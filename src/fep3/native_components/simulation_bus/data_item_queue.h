@@ -14,6 +14,7 @@
 #include "data_item_queue_base.h"
 
 #include <atomic>
+#include <condition_variable>
 #include <mutex>
 #include <vector>
 #include <memory>
@@ -38,6 +39,7 @@ class DataItemQueue: public DataItemQueueBase<SAMPLE_TYPE, STREAM_TYPE>
 private:
     using typename DataItemQueueBase<SAMPLE_TYPE, STREAM_TYPE>::DataItem;
     using typename DataItemQueueBase<SAMPLE_TYPE, STREAM_TYPE>::QueueType;
+    using typename DataItemQueueBase<SAMPLE_TYPE, STREAM_TYPE>::Item;
 
 public:
     /**
@@ -72,27 +74,8 @@ public:
     void push(const data_read_ptr<SAMPLE_TYPE>& sample) override
     {
         std::lock_guard<std::recursive_mutex> lock_guard(_recursive_mutex);
-        if (_next_write_idx == _items.size())
-        {
-            _next_write_idx = 0;
-        }
-
-        DataItem& ref = _items[_next_write_idx];
-        ref.set(sample);
-
-        ++_next_write_idx;
-        ++_current_size;
-
-        //if queue is full we need to change read index ... item was dropped
-        if (_current_size > capacity())
-        {
-            if (_next_read_idx == _items.size())
-            {
-                _next_read_idx = 0;
-            }
-            _current_size = capacity();
-            ++_next_read_idx;
-        }
+        pushLocked(sample);
+        notifyWaitingReceivers();
     }
     /**
      * @brief pushes a stream type data read pointer to the queue
@@ -104,25 +87,33 @@ public:
     void push(const data_read_ptr<STREAM_TYPE>& type) override
     {
         std::lock_guard<std::recursive_mutex> lock_guard(_recursive_mutex);
-        if (_next_write_idx == _items.size())
+        pushLocked(type);
+        notifyWaitingReceivers();
+    }
+
+    void pushItems(const std::vector<Item>& items) override
+    {
+        if (items.empty())
         {
-            _next_write_idx = 0;
+            return;
         }
-        DataItem& ref = _items[_next_write_idx];
-        ref.set(type);
 
-        ++_next_write_idx;
-        ++_current_size;
-        //if queue is full we need to change read index ... item was dropped
-        if (_current_size > capacity())
+        std::lock_guard<std::recursive_mutex> lock_guard(_recursive_mutex);
+        // items which would be dropped by the following ones anyway are skipped
+        const size_t dropped_count = items.size() > _items.size() ? items.size() - _items.size() : 0;
+        for (auto item = items.begin() + dropped_count; item != items.end(); ++item)
         {
-            if (_next_read_idx == _items.size())
+            if (std::get<0>(*item))
             {
-                _next_read_idx = 0;
+                pushLocked(std::get<0>(*item));
+            }
+            else if (std::get<1>(*item))
+            {
+                pushLocked(std::get<1>(*item));
             }
-            _current_size = capacity();
-            ++_next_read_idx;
         }
+
+        notifyWaitingReceivers();
     }
 
     Optional<Timestamp> getFrontTime() override
@@ -170,13 +161,16 @@ public:
                     _next_read_idx = 0;
                 }
                 DataItem& ref = _items[_next_read_idx];
+                // release the item's reference, otherwise the popped sample is kept alive until the slot is overwritten
                 if (DataItem::Type::sample == ref.getItemType())
                 {
-                    sample = std::move(ref.getSample());
+                    sample = ref.getSample();
+                    ref.resetSample();
                 }
                 else if (DataItem::Type::type == ref.getItemType())
                 {
-                    stream_type = std::move(ref.getStreamType());
+                    stream_type = ref.getStreamType();
+                    ref.resetStreamType();
                 }
                 ++_next_read_idx;
                 --_current_size;
@@ -186,6 +180,34 @@ public:
         return std::make_tuple(std::move(sample), std::move(stream_type));
     }
 
+    size_t popItems(std::vector<Item>& items) override
+    {
+        std::lock_guard<std::recursive_mutex> lock_guard(_recursive_mutex);
+        const size_t popped_count = _current_size;
+        for (size_t count = 0; count < popped_count; ++count)
+        {
+            if (_next_read_idx == _items.size())
+            {
+                _next_read_idx = 0;
+            }
+            DataItem& ref = _items[_next_read_idx];
+            if (DataItem::Type::sample == ref.getItemType())
+            {
+                items.emplace_back(ref.getSample(), nullptr);
+                ref.resetSample();
+            }
+            else if (DataItem::Type::type == ref.getItemType())
+            {
+                items.emplace_back(nullptr, ref.getStreamType());
+                ref.resetStreamType();
+            }
+            ++_next_read_idx;
+        }
+        _current_size = 0;
+
+        return popped_count;
+    }
+
     size_t capacity() const override
     {
         std::lock_guard<std::recursive_mutex> lock_guard(_recursive_mutex);
@@ -207,11 +229,73 @@ public:
         _current_size = 0;
     }
 
+    bool waitForItem() override
+    {
+        std::unique_lock<std::recursive_mutex> lock(_recursive_mutex);
+        ++_waiting_receivers;
+        _item_available.wait(lock, [this]() { return _wait_interrupted || _current_size > 0; });
+        --_waiting_receivers;
+        return !_wait_interrupted;
+    }
+
+    void interruptWait() override
+    {
+        {
+            std::lock_guard<std::recursive_mutex> lock_guard(_recursive_mutex);
+            _wait_interrupted = true;
+        }
+        _item_available.notify_all();
+    }
+
+    void clearWaitInterruption() override
+    {
+        std::lock_guard<std::recursive_mutex> lock_guard(_recursive_mutex);
+        _wait_interrupted = false;
+    }
+
     QueueType getQueueType() const override
     {
         return QueueType::fixed;
     }
 
+private:
+    // must be called with the mutex locked
+    template<typename ITEM_TYPE>
+    void pushLocked(const ITEM_TYPE& item)
+    {
+        if (_next_write_idx == _items.size())
+        {
+            _next_write_idx = 0;
+        }
+
+        DataItem& ref = _items[_next_write_idx];
+        ref.set(item);
+
+        ++_next_write_idx;
+        ++_current_size;
+
+        //if queue is full we need to change read index ... item was dropped
+        if (_current_size > capacity())
+        {
+            if (_next_read_idx == _items.size())
+            {
+                _next_read_idx = 0;
+            }
+            _current_size = capacity();
+            ++_next_read_idx;
+        }
+    }
+
+    // must be called with the mutex locked, skips the notification if nobody waits
+    void notifyWaitingReceivers()
+    {
+        if (_waiting_receivers > 0)
+        {
+            _item_available.notify_all();
+        }
+        this->signalItemNotification();
+    }
+
 private:
     std::vector<DataItem> _items;
 
@@ -219,6 +303,10 @@ private:
     volatile size_t _next_read_idx;
     volatile size_t _current_size;
     mutable std::recursive_mutex _recursive_mutex;
+
+    std::condition_variable_any _item_available;
+    size_t _waiting_receivers{ 0 };
+    bool _wait_interrupted{ false };
 };
 
 } // namespace native
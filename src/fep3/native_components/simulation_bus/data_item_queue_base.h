@@ -12,7 +12,12 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <memory>
+#include <tuple>
+#include <vector>
+
+#include "item_notification.h"
 
 namespace fep3
 {
@@ -146,6 +151,12 @@ protected:
     virtual QueueType getQueueType() const = 0;
 
 public:
+    /**
+     * @brief Item as returned by @ref pop, either the sample or the stream type is set
+     *
+     */
+    using Item = std::tuple<data_read_ptr<SAMPLE_TYPE>, data_read_ptr<STREAM_TYPE>>;
+
     /**
      * @brief CTOR
      */
@@ -172,6 +183,15 @@ public:
      */
     virtual void push(const data_read_ptr<STREAM_TYPE>& type) = 0;
 
+    /**
+     * @brief Pushes several items to the queue at once, keeping their order
+     * If the items exceed the capacity, the oldest ones are dropped like for single pushes.
+     *
+     * @param items The items to push
+     * @remark This is threadsafe against pop and other push calls
+     */
+    virtual void pushItems(const std::vector<Item>& items) = 0;
+
     /**
      * @brief Returns the timestamp of the oldest available sample of the item queue,
      * which is the sample at the front of the queue
@@ -188,6 +208,15 @@ public:
      */
     virtual std::tuple<data_read_ptr<SAMPLE_TYPE>, data_read_ptr<STREAM_TYPE> > pop() = 0;
 
+    /**
+     * @brief Pops all items of the queue at once and appends them to @p items in their order
+     *
+     * @param items The vector to append the items to
+     * @return The number of popped items
+     * @remark This is threadsafe against push and pop calls
+     */
+    virtual size_t popItems(std::vector<Item>& items) = 0;
+
     /**
      * @brief Return the maximum capacity of the queue
      *
@@ -206,6 +235,60 @@ public:
      * @brief Remove all elements of the queue
      */
     virtual void clear() = 0;
+
+    /**
+     * @brief Blocks until the queue contains at least one item or the wait is interrupted
+     *
+     * @return true if an item is available, false if the wait was interrupted by @ref interruptWait
+     * @remark This is threadsafe against push and pop calls
+     */
+    virtual bool waitForItem() = 0;
+
+    /**
+     * @brief Wakes up all callers blocked in @ref waitForItem and lets further calls return immediately
+     * until @ref clearWaitInterruption is called
+     */
+    virtual void interruptWait() = 0;
+
+    /**
+     * @brief Resets the interruption set by @ref interruptWait, so @ref waitForItem blocks again
+     */
+    virtual void clearWaitInterruption() = 0;
+
+    /**
+     * @brief Sets a notification which is signalled on every push in addition to waking up @ref waitForItem
+     *
+     * @param notification the notification, nullptr to stop signalling
+     * @remark This is threadsafe against push calls
+     */
+    void setItemNotification(const std::shared_ptr<ItemNotification>& notification)
+    {
+        std::atomic_store(&_item_notification, notification);
+        _has_item_notification.store(notification ? 1 : 0, std::memory_order_seq_cst);
+    }
+
+protected:
+    /**
+     * @brief Signals the notification set by @ref setItemNotification, if any
+     * Implementations call this after each push.
+     */
+    void signalItemNotification()
+    {
+        // read-modify-write pairs with the store in setItemNotification, so either the receiver popping after
+        // the notification was set sees the item or we see the notification
+        if (_has_item_notification.fetch_add(0, std::memory_order_acq_rel) > 0)
+        {
+            const auto notification = std::atomic_load(&_item_notification);
+            if (notification)
+            {
+                notification->notify();
+            }
+        }
+    }
+
+private:
+    std::shared_ptr<ItemNotification> _item_notification;
+    std::atomic<uint32_t> _has_item_notification{ 0 };
 };
 
 } // namespace native
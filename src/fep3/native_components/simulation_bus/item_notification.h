@@ -0,0 +1,123 @@
+/**
+ * @file
+ * Copyright &copy; AUDI AG. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+namespace fep3
+{
+namespace native
+{
+/**
+ * @brief Notification shared by several item queues
+ * Every push to one of the queues signals it, so a single receiver can wait for items of many queues at once.
+ * Notifications are not counted, @ref wait returns once for any number of @ref notify calls in between.
+ */
+class ItemNotification
+{
+public:
+    /**
+     * @brief Signals that an item is available and wakes up the waiting receiver
+     * @remark This is threadsafe, already pending notifications return without locking
+     */
+    void notify()
+    {
+        if (_notified.exchange(true, std::memory_order_acq_rel))
+        {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+        }
+        _condition.notify_one();
+    }
+
+    /**
+     * @brief Blocks until @ref notify was called since the last wait returned and consumes the notification
+     */
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _condition.wait(lock, [this]() { return _notified.exchange(false, std::memory_order_acq_rel); });
+    }
+
+    /**
+     * @brief Blocks until @ref notify was called since the last wait returned or @p timeout elapsed
+     * and consumes the notification
+     *
+     * @param timeout maximum time to wait
+     */
+    template<typename Rep, typename Period>
+    void waitFor(const std::chrono::duration<Rep, Period>& timeout)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _condition.wait_for(lock, timeout, [this]() { return _notified.exchange(false, std::memory_order_acq_rel); });
+    }
+
+private:
+    std::atomic<bool> _notified{ false };
+    std::mutex _mutex;
+    std::condition_variable _condition;
+};
+
+/**
+ * @brief Optional extension of ISimulationBus::IDataReader for readers signalling an @ref ItemNotification
+ * on every item pushed to their queue
+ */
+class INotifyingDataReader
+{
+protected:
+    /**
+     * @brief DTOR
+     */
+    virtual ~INotifyingDataReader() = default;
+
+public:
+    /**
+     * @brief Sets the notification to signal on every pushed item
+     *
+     * @param notification the notification, nullptr to stop signalling
+     * @remark This is threadsafe against pushing items to the queue of the reader
+     */
+    virtual void setItemNotification(const std::shared_ptr<ItemNotification>& notification) = 0;
+};
+
+/**
+ * @brief Optional extension of ISimulationBus::IDataReader for readers tracking whether the items pushed
+ * to their queue have been passed to the receiver
+ */
+class IDeliveryTrackingDataReader
+{
+protected:
+    /**
+     * @brief DTOR
+     */
+    virtual ~IDeliveryTrackingDataReader() = default;
+
+public:
+    /**
+     * @brief Blocks until the queue of the reader is empty and no item is being passed to the receiver
+     * by @ref ISimulationBus::IDataReader::receive or @ref ISimulationBus::IDataReader::pop
+     *
+     * @param timeout maximum time to wait
+     * @return true if all items were passed to the receiver, false if @p timeout elapsed before
+     * @remark This is threadsafe against pushing and receiving items
+     */
+    virtual bool waitForDelivery(std::chrono::nanoseconds timeout) = 0;
+};
+
+} // namespace native
+} // namespace fep3
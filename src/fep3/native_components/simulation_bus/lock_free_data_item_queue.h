@@ -0,0 +1,379 @@
+/**
+ * @file
+ * Copyright &copy; AUDI AG. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ */
+
+#pragma once
+
+#include "data_item_queue_base.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace fep3
+{
+namespace native
+{
+
+/**
+ * @brief Lock free Data Item queue
+ * Bounded ring buffer with a sequence number per slot which supports multiple producers and multiple consumers
+ * (and therefore the single producer/single consumer case) without locking on push and pop.
+ * It provides the same semantics as the @ref DataItemQueue: items are read in the same order they were added and
+ * if the capacity is reached, the oldest item is dropped on push.
+ * @remark If a consumer is popping the oldest item while a producer finds the queue full, the producer drops the next item.
+ *         So under contention one more item than necessary may be dropped.
+ *
+ * @tparam IDataRegistry::IDataSample class for samples
+ * @tparam IStreamType class for types
+ */
+template<class SAMPLE_TYPE = const IDataSample, class STREAM_TYPE = const IStreamType>
+class LockFreeDataItemQueue : public DataItemQueueBase<SAMPLE_TYPE, STREAM_TYPE>
+{
+private:
+    using typename DataItemQueueBase<SAMPLE_TYPE, STREAM_TYPE>::DataItem;
+    using typename DataItemQueueBase<SAMPLE_TYPE, STREAM_TYPE>::QueueType;
+    using typename DataItemQueueBase<SAMPLE_TYPE, STREAM_TYPE>::Item;
+
+    struct Slot
+    {
+        std::atomic<size_t> sequence{ 0 };
+        DataItem item;
+        // copy of the item's meta data which can be read while the item is modified (see getFrontTime)
+        std::atomic<bool> is_sample{ false };
+        std::atomic<int64_t> time{ 0 };
+    };
+
+public:
+    /**
+     * @brief CTOR
+     *
+     * @param capacity capacity by item count of the queue (there are sample + streamtype covered)
+     */
+    LockFreeDataItemQueue(size_t capacity)
+        : DataItemQueueBase<SAMPLE_TYPE, STREAM_TYPE>()
+        , _capacity(capacity > 0 ? capacity : 1)
+        , _slots(new Slot[_capacity])
+    {
+        for (size_t index = 0; index < _capacity; ++index)
+        {
+            _slots[index].sequence.store(index, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief DTOR
+     *
+     */
+    virtual ~LockFreeDataItemQueue() = default;
+
+    /**
+     * @brief pushes a sample data read pointer to the queue
+     *
+     * @param sample the samples read pointer to push
+     * @remark this is threadsafe against push and other pop calls
+     */
+    void push(const data_read_ptr<SAMPLE_TYPE>& sample) override
+    {
+        pushItem(sample);
+        notifyWaitingReceivers();
+    }
+
+    /**
+     * @brief pushes a stream type data read pointer to the queue
+     *
+     * @param type the types read pointer to push
+     * @remark this is threadsafe against push and other pop calls
+     */
+    void push(const data_read_ptr<STREAM_TYPE>& type) override
+    {
+        pushItem(type);
+        notifyWaitingReceivers();
+    }
+
+    void pushItems(const std::vector<Item>& items) override
+    {
+        if (items.empty())
+        {
+            return;
+        }
+
+        // items which would be dropped by the following ones anyway are skipped
+        const size_t dropped_count = items.size() > _capacity ? items.size() - _capacity : 0;
+        for (auto item = items.begin() + dropped_count; item != items.end(); ++item)
+        {
+            if (std::get<0>(*item))
+            {
+                pushItem(std::get<0>(*item));
+            }
+            else if (std::get<1>(*item))
+            {
+                pushItem(std::get<1>(*item));
+            }
+        }
+
+        notifyWaitingReceivers();
+    }
+
+    Optional<Timestamp> getFrontTime() override
+    {
+        size_t position = _dequeue_position.load(std::memory_order_acquire);
+        while (true)
+        {
+            const Slot& slot = _slots[position % _capacity];
+            if (slot.sequence.load(std::memory_order_acquire) != position + 1)
+            {
+                // empty or the front item is not published yet
+                return {};
+            }
+            const bool is_sample = slot.is_sample.load(std::memory_order_acquire);
+            const int64_t time = slot.time.load(std::memory_order_acquire);
+
+            // the values are only valid if the item was not popped in the meantime
+            const size_t current_position = _dequeue_position.load(std::memory_order_acquire);
+            if (current_position == position)
+            {
+                if (is_sample)
+                {
+                    return Timestamp(time);
+                }
+                return {};
+            }
+            position = current_position;
+        }
+    }
+
+    /**
+     * @brief pops the item at the front of the queue
+     *
+     * @return {nullptr, nullptr} if queue is empty
+     * @remark this is threadsafe against push and pop calls
+     */
+    std::tuple<data_read_ptr<SAMPLE_TYPE>, data_read_ptr<STREAM_TYPE> > pop() override
+    {
+        data_read_ptr<SAMPLE_TYPE> sample = nullptr;
+        data_read_ptr<STREAM_TYPE> stream_type = nullptr;
+
+        DataItem item;
+        if (tryPop(item))
+        {
+            if (DataItem::Type::sample == item.getItemType())
+            {
+                sample = item.getSample();
+            }
+            else if (DataItem::Type::type == item.getItemType())
+            {
+                stream_type = item.getStreamType();
+            }
+        }
+
+        return std::make_tuple(std::move(sample), std::move(stream_type));
+    }
+
+    size_t popItems(std::vector<Item>& items) override
+    {
+        size_t popped_count = 0;
+        DataItem item;
+        while (tryPop(item))
+        {
+            if (DataItem::Type::sample == item.getItemType())
+            {
+                items.emplace_back(item.getSample(), nullptr);
+            }
+            else if (DataItem::Type::type == item.getItemType())
+            {
+                items.emplace_back(nullptr, item.getStreamType());
+            }
+            ++popped_count;
+        }
+
+        return popped_count;
+    }
+
+    size_t capacity() const override
+    {
+        return _capacity;
+    }
+
+    size_t size() const override
+    {
+        const size_t dequeue_position = _dequeue_position.load(std::memory_order_acquire);
+        const size_t enqueue_position = _enqueue_position.load(std::memory_order_acquire);
+        if (enqueue_position <= dequeue_position)
+        {
+            return 0;
+        }
+        return std::min(enqueue_position - dequeue_position, _capacity);
+    }
+
+    void clear() override
+    {
+        DataItem item;
+        while (tryPop(item))
+        {
+        }
+    }
+
+    bool waitForItem() override
+    {
+        std::unique_lock<std::mutex> lock(_wait_mutex);
+        _waiting_receivers.fetch_add(1, std::memory_order_acq_rel);
+        _item_available.wait(lock, [this]() { return _wait_interrupted || isFrontPublished(); });
+        _waiting_receivers.fetch_sub(1, std::memory_order_acq_rel);
+        return !_wait_interrupted;
+    }
+
+    void interruptWait() override
+    {
+        {
+            std::lock_guard<std::mutex> lock_guard(_wait_mutex);
+            _wait_interrupted = true;
+        }
+        _item_available.notify_all();
+    }
+
+    void clearWaitInterruption() override
+    {
+        std::lock_guard<std::mutex> lock_guard(_wait_mutex);
+        _wait_interrupted = false;
+    }
+
+    QueueType getQueueType() const override
+    {
+        return QueueType::fixed;
+    }
+
+private:
+    void pushItem(const data_read_ptr<SAMPLE_TYPE>& sample)
+    {
+        const Timestamp time = sample ? sample->getTime() : Timestamp(0);
+        pushItem(DataItem(sample), true, time);
+    }
+
+    void pushItem(const data_read_ptr<STREAM_TYPE>& type)
+    {
+        pushItem(DataItem(type), false, Timestamp(0));
+    }
+
+    // publishes the item without waking up waiting receivers
+    void pushItem(DataItem&& item, bool is_sample, Timestamp time)
+    {
+        size_t position = _enqueue_position.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slot& slot = _slots[position % _capacity];
+            const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+            if (difference == 0)
+            {
+                if (_enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    slot.item = std::move(item);
+                    slot.is_sample.store(is_sample, std::memory_order_release);
+                    slot.time.store(time.count(), std::memory_order_release);
+                    slot.sequence.store(position + 1, std::memory_order_release);
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                //if queue is full we need to drop the oldest item
+                DataItem dropped;
+                tryPop(dropped);
+                position = _enqueue_position.load(std::memory_order_relaxed);
+            }
+            else
+            {
+                position = _enqueue_position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // a slot claimed by a producer which did not publish its item yet does not count, pop would not return it
+    bool isFrontPublished() const
+    {
+        size_t position = _dequeue_position.load(std::memory_order_acquire);
+        while (true)
+        {
+            if (_slots[position % _capacity].sequence.load(std::memory_order_acquire) == position + 1)
+            {
+                return true;
+            }
+            // the front item may have been popped in the meantime, the next one may be published already
+            const size_t current_position = _dequeue_position.load(std::memory_order_acquire);
+            if (current_position == position)
+            {
+                return false;
+            }
+            position = current_position;
+        }
+    }
+
+    bool tryPop(DataItem& item)
+    {
+        size_t position = _dequeue_position.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slot& slot = _slots[position % _capacity];
+            const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+            if (difference == 0)
+            {
+                if (_dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    item = std::move(slot.item);
+                    // release the references of the slot, otherwise the item is kept alive until the slot is overwritten
+                    slot.item = DataItem();
+                    slot.sequence.store(position + _capacity, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = _dequeue_position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void notifyWaitingReceivers()
+    {
+        // read-modify-write pairs with the increment in waitForItem, so either the waiter sees the item or we see the waiter
+        if (_waiting_receivers.fetch_add(0, std::memory_order_acq_rel) > 0)
+        {
+            {
+                std::lock_guard<std::mutex> lock_guard(_wait_mutex);
+            }
+            _item_available.notify_all();
+        }
+        this->signalItemNotification();
+    }
+
+private:
+    const size_t _capacity;
+    std::unique_ptr<Slot[]> _slots;
+
+    std::atomic<size_t> _enqueue_position{ 0 };
+    std::atomic<size_t> _dequeue_position{ 0 };
+
+    std::mutex _wait_mutex;
+    std::condition_variable _item_available;
+    std::atomic<size_t> _waiting_receivers{ 0 };
+    bool _wait_interrupted{ false };
+};
+
+} // namespace native
+} // namespace fep3
@@ -10,6 +10,7 @@
  */
 
 #include "simbus_datareader.h"
+#include "simbus_datawriter.h"
 
 namespace {
 
@@ -36,10 +37,17 @@ namespace fep3
 namespace native
 {
 
+SimulationBus::DataReader::~DataReader()
+{
+    if (_transmitter)
+    {
+        _transmitter->remove(_item_queue);
+    }
+}
 
 size_t SimulationBus::DataReader::size() const
 {
-    std::unique_lock<std::mutex> queue_is_in_use(_exitSignal.data_triggered_reception_mutex, std::try_to_lock);
+    std::unique_lock<std::mutex> queue_is_in_use(_data_triggered_reception_mutex, std::try_to_lock);
 
     if (!queue_is_in_use.owns_lock()) {
         // data triggered reception is currently running, so my queue is always empty
@@ -56,7 +64,7 @@ size_t SimulationBus::DataReader::capacity() const
 
 bool SimulationBus::DataReader::pop(ISimulationBus::IDataReceiver& onReceive)
 {
-    std::unique_lock<std::mutex> queue_is_in_use(_exitSignal.data_triggered_reception_mutex, std::try_to_lock);
+    std::unique_lock<std::mutex> queue_is_in_use(_data_triggered_reception_mutex, std::try_to_lock);
 
     if (!queue_is_in_use.owns_lock()) {
         // data triggered reception is currently running, so my queue is always empty
@@ -67,33 +75,39 @@ bool SimulationBus::DataReader::pop(ISimulationBus::IDataReceiver& onReceive)
         return false;
     }
 
+    // counted before the item leaves the queue, so it is never missed by waitForDelivery
+    ++_dispatching_items;
     auto res = _item_queue->pop();
     queue_is_in_use.unlock();
 
     dispatch<decltype(res)>(res, onReceive);
+    finishDispatching();
 
     return true;
 }
 
 void SimulationBus::DataReader::receive(ISimulationBus::IDataReceiver& onReceive)
 {
-    std::unique_lock<std::mutex> lock(_exitSignal.data_triggered_reception_mutex);
+    std::unique_lock<std::mutex> lock(_data_triggered_reception_mutex);
 
-    std::future<void> futureObj = _exitSignal.trigger.get_future();
-    while (futureObj.wait_for(std::chrono::milliseconds(1)) == std::future_status::timeout)
+    // the queue wakes us up on push, so no polling is needed
+    while (_item_queue->waitForItem())
     {
+        ++_dispatching_items;
         auto res = _item_queue->pop();
         dispatch<decltype(res)>(res, onReceive);
+        finishDispatching();
     }
 }
 
 void SimulationBus::DataReader::stop()
 {
-    _exitSignal.trigger.set_value();
+    _item_queue->interruptWait();
 
     {
-        std::unique_lock<std::mutex> lock(_exitSignal.data_triggered_reception_mutex);
-        _exitSignal.trigger = std::promise<void> {};
+        // wait for the running reception to return before following receive calls may block again
+        std::unique_lock<std::mutex> lock(_data_triggered_reception_mutex);
+        _item_queue->clearWaitInterruption();
     }
 }
 
@@ -102,6 +116,42 @@ Optional<Timestamp> SimulationBus::DataReader::getFrontTime() const
     return _item_queue->getFrontTime();
 }
 
+void SimulationBus::DataReader::setItemNotification(const std::shared_ptr<ItemNotification>& notification)
+{
+    _item_queue->setItemNotification(notification);
+}
+
+bool SimulationBus::DataReader::waitForDelivery(std::chrono::nanoseconds timeout)
+{
+    std::unique_lock<std::mutex> lock(_delivery_mutex);
+    ++_delivery_waiters;
+    const auto delivered = _delivery_condition.wait_for(lock, timeout, [this]() { return isDelivered(); });
+    --_delivery_waiters;
+    return delivered;
+}
+
+bool SimulationBus::DataReader::isDelivered() const
+{
+    // the first load synchronizes with the last finished dispatching, so the size of the queue is up to date.
+    // the second one catches an item popped meanwhile, it is counted before it left the queue.
+    return _dispatching_items.load() == 0
+        && _item_queue->size() == 0
+        && _dispatching_items.load() == 0;
+}
+
+void SimulationBus::DataReader::finishDispatching()
+{
+    --_dispatching_items;
+    // either the waiter registered before sees the decrement or we see the waiter
+    if (_delivery_waiters.load() > 0)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_delivery_mutex);
+        }
+        _delivery_condition.notify_all();
+    }
+}
+
 
 } // namespace native
 } // namespace fep3
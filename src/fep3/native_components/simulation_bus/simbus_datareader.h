@@ -12,12 +12,15 @@
 #pragma once
 
 #include "fep3/components/simulation_bus/simulation_bus_intf.h"
-#include "data_item_queue.h"
+#include "data_item_queue_base.h"
+#include "item_notification.h"
 #include "simulation_bus.h"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
-#include <future>
 #include <vector>
 #include <queue>
 
@@ -26,14 +29,25 @@ namespace fep3
 namespace native
 {
 
-class SimulationBus::DataReader: public arya::ISimulationBus::IDataReader
+class SimulationBus::DataReader
+    : public arya::ISimulationBus::IDataReader
+    , public INotifyingDataReader
+    , public IDeliveryTrackingDataReader
 {
 public:
-    DataReader(std::shared_ptr< DataItemQueue<> >& item_queue)
+    /**
+     * CTOR
+     *
+     * @param item_queue queue the received items are read from
+     * @param transmitter transmitter the @p item_queue is added to, it is removed from it on destruction
+     */
+    DataReader(const std::shared_ptr< DataItemQueueBase<> >& item_queue
+        , const std::shared_ptr<SimulationBus::Transmitter>& transmitter = nullptr)
         : _item_queue{ item_queue }
+        , _transmitter{ transmitter }
     {
     };
-    virtual ~DataReader() {}
+    virtual ~DataReader();
     DataReader(const DataReader&) = delete;
     DataReader(DataReader&&) = delete;
     DataReader& operator=(const DataReader&) = delete;
@@ -51,15 +65,25 @@ public:
 
     virtual Optional<Timestamp> getFrontTime() const override;
 
+    void setItemNotification(const std::shared_ptr<ItemNotification>& notification) override;
+
+    bool waitForDelivery(std::chrono::nanoseconds timeout) override;
+
 private:
-    std::shared_ptr<DataItemQueue<>> _item_queue{ nullptr };
+    bool isDelivered() const;
+    void finishDispatching();
 
+    std::shared_ptr<DataItemQueueBase<>> _item_queue{ nullptr };
+    std::shared_ptr<SimulationBus::Transmitter> _transmitter{ nullptr };
 
-    struct ExitSignal
-    {
-        std::promise<void> trigger;
-        mutable std::mutex data_triggered_reception_mutex;
-    } _exitSignal;
+    // locked while data triggered reception is running
+    mutable std::mutex _data_triggered_reception_mutex;
+
+    // number of items popped but not yet passed to the receiver
+    std::atomic<int32_t> _dispatching_items{ 0 };
+    std::atomic<int32_t> _delivery_waiters{ 0 };
+    std::mutex _delivery_mutex;
+    std::condition_variable _delivery_condition;
 };
 
 
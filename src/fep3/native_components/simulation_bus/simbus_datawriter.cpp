@@ -11,41 +11,56 @@
 
 #include "simbus_datawriter.h"
 
-#include "fep3/base/sample/data_sample.h"
+#include "fep3/base/sample/data_sample_pool.h"
 #include "fep3/base/streamtype/streamtype.h"
 
+#include <algorithm>
+#include <atomic>
+
 namespace fep3
 {
 namespace native
 {
 
-template <class TYPE>
-void SimulationBus::Transmitter::transmit(const std::string& name, const data_read_ptr<const TYPE>& sample)
+void SimulationBus::Transmitter::transmit(const Items& items)
 {
-    for (auto elem : _receiver_queues)
+    const auto receiver_queues = std::atomic_load(&_receiver_queues);
+    for (const auto& receiver_queue : *receiver_queues)
     {
-        if (elem.first == name)
-        {
-            elem.second->push(sample);
-        }
+        receiver_queue->pushItems(items);
     }
 }
 
-void SimulationBus::Transmitter::add(const std::string& name, DataItemQueuePtr receive_queue)
+void SimulationBus::Transmitter::add(const DataItemQueuePtr& receive_queue)
+{
+    std::lock_guard<std::mutex> lock(_modification_mutex);
+    auto receiver_queues = std::make_shared<ReceiverQueues>(*std::atomic_load(&_receiver_queues));
+    receiver_queues->push_back(receive_queue);
+    std::atomic_store(&_receiver_queues, std::shared_ptr<const ReceiverQueues>(std::move(receiver_queues)));
+}
+
+void SimulationBus::Transmitter::remove(const DataItemQueuePtr& receive_queue)
 {
-    _receiver_queues.emplace(std::make_pair(name, receive_queue));
+    std::lock_guard<std::mutex> lock(_modification_mutex);
+    auto receiver_queues = std::make_shared<ReceiverQueues>(*std::atomic_load(&_receiver_queues));
+    receiver_queues->erase(std::remove(receiver_queues->begin(), receiver_queues->end(), receive_queue), receiver_queues->end());
+    std::atomic_store(&_receiver_queues, std::shared_ptr<const ReceiverQueues>(std::move(receiver_queues)));
 }
 
-SimulationBus::DataWriter::DataWriter(const std::string& name, size_t transmit_buffer_capacity, const std::shared_ptr<SimulationBus::Transmitter>& transmitter)
+SimulationBus::DataWriter::DataWriter(const std::string& name, std::unique_ptr<DataItemQueueBase<>> transmit_buffer, const std::shared_ptr<SimulationBus::Transmitter>& transmitter)
 {
     _name = name;
-    _transmit_buffer = std::make_unique<DataItemQueue<>>(transmit_buffer_capacity);
+    _transmit_buffer = std::move(transmit_buffer);
     _transmitter = transmitter;
+    _transmit_items.reserve(_transmit_buffer->capacity());
 }
 
 fep3::Result SimulationBus::DataWriter::write(const IDataSample& data_sample)
 {
-    auto current = std::make_shared<DataSample>(data_sample);
+    auto current = _sample_pool.getSample(data_sample.getSize());
+    current->setTime(data_sample.getTime());
+    current->setCounter(data_sample.getCounter());
+    data_sample.read(*current);
 
     _transmit_buffer->push(current);
 
@@ -64,17 +79,11 @@ fep3::Result SimulationBus::DataWriter::write(const IStreamType& stream_type)
 
 fep3::Result SimulationBus::DataWriter::transmit()
 {
-    for (auto items = _transmit_buffer->pop(); std::get<0>(items) != nullptr || std::get<1>(items) != nullptr; items = _transmit_buffer->pop())
+    if (_transmit_buffer->popItems(_transmit_items) > 0)
     {
-        if (std::get<0>(items) != nullptr)
-        {
-            _transmitter->transmit(_name, std::get<0>(items));
-        }
-
-        if (std::get<1>(items) != nullptr)
-        {
-            _transmitter->transmit(_name, std::get<1>(items));
-        }
+        _transmitter->transmit(_transmit_items);
+        // keeps the capacity, so the next transmit does not allocate
+        _transmit_items.clear();
     }
 
     return {};
@@ -12,12 +12,13 @@
 #pragma once
 
 #include "fep3/components/simulation_bus/simulation_bus_intf.h"
-#include "data_item_queue.h"
+#include "fep3/base/sample/data_sample_pool.h"
+#include "data_item_queue_base.h"
 #include "simulation_bus.h"
 
 #include <memory>
+#include <mutex>
 #include <vector>
-#include <unordered_map>
 
 namespace fep3
 {
@@ -25,32 +26,63 @@ namespace native
 {
 
 /**
- * Transmitter which supports SIMO (Single Input Multiple Output) broadcasting of samples to several queues
+ * Transmitter which supports SIMO (Single Input Multiple Output) broadcasting of samples to several queues.
+ * There is one transmitter per signal name. The receiver queues are kept in an immutable list which is
+ * replaced as a whole on add and remove, so transmitting only iterates the current list without locking.
  */
 class SimulationBus::Transmitter
 {
 public:
-    using DataItemQueuePtr = std::shared_ptr<DataItemQueue<> >;
+    using DataItemQueuePtr = std::shared_ptr<DataItemQueueBase<> >;
+    using Items = std::vector<DataItemQueueBase<>::Item>;
 
-    template <class TYPE>
-    void transmit(const std::string& name, const data_read_ptr<const TYPE>& sample);
+    /**
+     * Push the items to all receiver queues, each queue is locked only once
+     *
+     * @param items items in the order they were written
+     */
+    void transmit(const Items& items);
 
     /**
      * Add a receiver queue to which samples will be added on transmit
      *
-     * @param name signal name does not have to be unique
-     * @param receive_queue Queue to push name samples
+     * @param receive_queue Queue to push the samples to
+     */
+    void add(const DataItemQueuePtr& receive_queue);
+
+    /**
+     * Remove a receiver queue added by @ref add
+     *
+     * @param receive_queue Queue which shall not receive samples anymore
      */
-    void add(const std::string& name, DataItemQueuePtr receive_queue);
+    void remove(const DataItemQueuePtr& receive_queue);
 
 private:
-    std::unordered_multimap<std::string, DataItemQueuePtr> _receiver_queues;
+    using ReceiverQueues = std::vector<DataItemQueuePtr>;
+
+    // only accessed by std::atomic_load and std::atomic_store
+    std::shared_ptr<const ReceiverQueues> _receiver_queues{ std::make_shared<ReceiverQueues>() };
+    // serializes add and remove
+    std::mutex _modification_mutex;
 };
 
+/**
+ * Data writer of the native simulation bus.
+ * Written samples are copied into samples of the writer's sample pool. A sample goes back to the pool
+ * as soon as all receivers released their data_read_ptr to it, so in steady state writing does not
+ * allocate and all receivers share the same immutable sample without further copies.
+ */
 class SimulationBus::DataWriter : public arya::ISimulationBus::IDataWriter
 {
 public:
-    DataWriter(const std::string& name, size_t transmit_buffer_capacity, const std::shared_ptr<SimulationBus::Transmitter>& transmitter);
+    /**
+     * CTOR
+     *
+     * @param name signal name of the writer
+     * @param transmit_buffer queue which buffers the written items until transmit is called
+     * @param transmitter transmitter which distributes the items to the receiver queues
+     */
+    DataWriter(const std::string& name, std::unique_ptr<DataItemQueueBase<>> transmit_buffer, const std::shared_ptr<SimulationBus::Transmitter>& transmitter);
 
     virtual ~DataWriter() {}
     DataWriter(const DataWriter&) = delete;
@@ -64,8 +96,11 @@ public:
     virtual fep3::Result transmit();
 
 private:
-    using DataItemQueuePtr = std::shared_ptr<DataItemQueue<>>;
-    std::unique_ptr<DataItemQueue<>> _transmit_buffer { nullptr };
+    std::unique_ptr<DataItemQueueBase<>> _transmit_buffer { nullptr };
+    // reused on every transmit to move the transmit buffer content at once
+    SimulationBus::Transmitter::Items _transmit_items;
+
+    DataSamplePool _sample_pool;
 
     std::string _name;
     std::shared_ptr<SimulationBus::Transmitter> _transmitter { nullptr };
@@ -14,6 +14,9 @@
 #include <a_util/result.h>
 
 #include "fep3/base/streamtype/default_streamtype.h"
+#include "fep3/components/configuration/configuration_service_intf.h"
+#include "data_item_queue.h"
+#include "lock_free_data_item_queue.h"
 #include "simbus_datareader.h"
 #include "simbus_datawriter.h"
 
@@ -35,12 +38,25 @@ class SimulationBus::Impl
     std::vector<StreamMetaType> _supported_meta_types;
     std::set<std::string> _registered_readers;
     std::set<std::string> _registered_writers;
+    bool _use_lock_free_queues{ false };
+
+    // guards the registered readers and writers of this instance
+    std::mutex _registration_mutex;
 
     using Transmitters = std::unordered_map<std::string, std::shared_ptr<Transmitter>>;
-    static Transmitters& getTransmitters()
+    // the transmitters are shared by all simulation bus instances of the process
+    static std::shared_ptr<Transmitter> getTransmitter(const std::string& name)
     {
+        static std::mutex transmitters_mutex;
         static Transmitters transmitters;
-        return transmitters;
+
+        std::lock_guard<std::mutex> lock(transmitters_mutex);
+        auto& transmitter = transmitters[name];
+        if (!transmitter)
+        {
+            transmitter = std::make_shared<Transmitter>();
+        }
+        return transmitter;
     }
 
 public:
@@ -68,6 +84,11 @@ public:
         return result != _supported_meta_types.end();
     }
 
+    void setUseLockFreeQueues(bool use_lock_free_queues)
+    {
+        _use_lock_free_queues = use_lock_free_queues;
+    }
+
     std::unique_ptr<IDataReader> getReader(const std::string& name, const IStreamType&,
             size_t queue_capacity)
     {
@@ -81,11 +102,12 @@ public:
             return nullptr;
         }
 
-        auto receive_queue = std::make_shared<DataItemQueue<>>(queue_capacity);
+        std::shared_ptr<DataItemQueueBase<>> receive_queue = createQueue(queue_capacity);
 
-        getTransmitters()[name]->add(name, receive_queue);
+        auto transmitter = getTransmitter(name);
+        transmitter->add(receive_queue);
 
-        auto reader = std::make_unique<DataReader>(receive_queue);
+        auto reader = std::make_unique<DataReader>(receive_queue, transmitter);
         return reader;
     }
 
@@ -96,26 +118,24 @@ public:
             return nullptr;
         }
 
-        auto writer = std::make_unique<DataWriter>(name, queue_capacity, getTransmitters()[name]);
+        auto writer = std::make_unique<DataWriter>(name, createQueue(queue_capacity), getTransmitter(name));
         return writer;
     }
 
 private:
-    bool registerAndCheckIfExists(std::set<std::string>& registry, const std::string& name)
+    std::unique_ptr<DataItemQueueBase<>> createQueue(size_t queue_capacity) const
     {
-        if (registry.find(name) != registry.end())
-        {
-            return true;
-        }
-
-        if (getTransmitters().find(name) == getTransmitters().end())
+        if (_use_lock_free_queues)
         {
-            getTransmitters()[name] = std::make_shared<Transmitter>();
+            return std::make_unique<LockFreeDataItemQueue<>>(queue_capacity);
         }
+        return std::make_unique<DataItemQueue<>>(queue_capacity);
+    }
 
-        registry.emplace(name);
-
-        return false;
+    bool registerAndCheckIfExists(std::set<std::string>& registry, const std::string& name)
+    {
+        std::lock_guard<std::mutex> lock(_registration_mutex);
+        return !registry.emplace(name).second;
     }
 };
 
@@ -129,6 +149,34 @@ SimulationBus::~SimulationBus()
 {
 }
 
+fep3::Result SimulationBus::create()
+{
+    auto components = _components.lock();
+    if (components)
+    {
+        //the configuration is optional, without it the defaults are used
+        auto configuration_service = components->getComponent<IConfigurationService>();
+        if (configuration_service)
+        {
+            FEP3_RETURN_IF_FAILED(_simulation_bus_configuration.initConfiguration(*configuration_service));
+        }
+    }
+    return {};
+}
+
+fep3::Result SimulationBus::destroy()
+{
+    _simulation_bus_configuration.deinitConfiguration();
+    return {};
+}
+
+fep3::Result SimulationBus::initialize()
+{
+    _simulation_bus_configuration.updatePropertyVariables();
+    _impl->setUseLockFreeQueues(_simulation_bus_configuration._use_lock_free_queues);
+    return {};
+}
+
 bool SimulationBus::isSupported(const IStreamType& stream_type) const
 {
     return _impl->isSupported(stream_type);
@@ -181,5 +229,24 @@ std::unique_ptr<fep3::arya::ISimulationBus::IDataWriter> SimulationBus::getWrite
     return _impl->getWriter(name, queue_capacity);
 }
 
+SimulationBus::SimulationBusConfiguration::SimulationBusConfiguration()
+    : Configuration(FEP3_SIMULATION_BUS_NATIVE_CONFIG)
+{
+}
+
+fep3::Result SimulationBus::SimulationBusConfiguration::registerPropertyVariables()
+{
+    FEP3_RETURN_IF_FAILED(registerPropertyVariable(_use_lock_free_queues, FEP3_SIMULATION_BUS_NATIVE_USE_LOCK_FREE_QUEUES_PROPERTY));
+
+    return {};
+}
+
+fep3::Result SimulationBus::SimulationBusConfiguration::unregisterPropertyVariables()
+{
+    FEP3_RETURN_IF_FAILED(unregisterPropertyVariable(_use_lock_free_queues, FEP3_SIMULATION_BUS_NATIVE_USE_LOCK_FREE_QUEUES_PROPERTY));
+
+    return {};
+}
+
 } // namespace native
 } // namespace fep3
@@ -13,6 +13,7 @@
 
 #include "fep3/components/simulation_bus/simulation_bus_intf.h"
 #include "fep3/components/base/component_base.h"
+#include "fep3/components/configuration/propertynode.h"
 
 #include "fep3/components/logging/logging_service_intf.h"
 
@@ -32,6 +33,11 @@ public:
     SimulationBus& operator=(const SimulationBus&) = delete;
     SimulationBus& operator=(SimulationBus&&) = delete;
 
+public:
+    fep3::Result create() override;
+    fep3::Result destroy() override;
+    fep3::Result initialize() override;
+
 public:
     bool isSupported(const IStreamType& stream_type) const override;
 
@@ -67,9 +73,27 @@ public:
     class DataReader;
     class DataWriter;
 
+private:
+    class SimulationBusConfiguration : public Configuration
+    {
+    public:
+        SimulationBusConfiguration();
+        ~SimulationBusConfiguration() = default;
+
+    public:
+        fep3::Result registerPropertyVariables() override;
+        fep3::Result unregisterPropertyVariables() override;
+
+    public:
+        // use the lock free queues for the transmit buffers and receiver queues instead of the mutex based ones
+        PropertyVariable<bool> _use_lock_free_queues{ FEP3_SIMULATION_BUS_NATIVE_USE_LOCK_FREE_QUEUES_DEFAULT_VALUE };
+    };
+
 private:
     class Impl;
     std::unique_ptr<Impl> _impl;
+
+    SimulationBusConfiguration _simulation_bus_configuration;
 };
 
 } // namespace native
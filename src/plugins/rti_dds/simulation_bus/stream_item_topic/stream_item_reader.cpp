@@ -108,7 +108,7 @@ bool StreamItemDataReader::pop(fep3::ISimulationBus::IDataReceiver& receiver)
                         .max_samples(1)
                         .take())
                     {
-                       receiver(createSample(sample, sample.info()));
+                       receiver(createSample(_sample_pool, sample, sample.info()));
                     }
                 }
                 else
@@ -261,9 +261,9 @@ std::shared_ptr<IStreamType> createStreamType(const fep3::ddstypes::StreamType&
     return streamtype;
 }
 
-std::shared_ptr<IDataSample> createSample(const fep3::ddstypes::Sample& dds_sample, const dds::sub::SampleInfo& sample_info)
+std::shared_ptr<IDataSample> createSample(DataSamplePool& sample_pool, const fep3::ddstypes::Sample& dds_sample, const dds::sub::SampleInfo& sample_info)
 {
-    auto sample = std::make_shared<DataSample>();
+    auto sample = sample_pool.getSample(dds_sample.data().size());
     sample->set(dds_sample.data().data(), dds_sample.data().size());
     sample->setTime(convertTimestamp(sample_info.source_timestamp()));
     sample->setCounter(static_cast<uint32_t>(sample_info.extensions().publication_sequence_number().value()));
@@ -11,12 +11,13 @@
 #pragma once
 
 #include <fep3/components/simulation_bus/simulation_bus_intf.h>
+#include <fep3/base/sample/data_sample_pool.h>
 #include <fep3/components/logging/logging_service_intf.h>
 #include <plugins/rti_dds/simulation_bus/rti_conext_dds_include.h>
 #include <plugins/rti_dds/simulation_bus/stream_item_topic/stream_item_topic.h>
 
 std::shared_ptr<fep3::arya::IStreamType> createStreamType(const fep3::ddstypes::StreamType& dds_streamtype, const dds::sub::SampleInfo& sample_info);
-std::shared_ptr<fep3::arya::IDataSample> createSample(const fep3::ddstypes::Sample& dds_sample, const dds::sub::SampleInfo& sample_info);
+std::shared_ptr<fep3::arya::IDataSample> createSample(fep3::DataSamplePool& sample_pool, const fep3::ddstypes::Sample& dds_sample, const dds::sub::SampleInfo& sample_info);
 
 class StreamItemDataReader 
     : public fep3::arya::ISimulationBus::IDataReader
@@ -30,6 +31,8 @@ private:
     dds::core::cond::WaitSet _waitset;
     dds::core::cond::GuardCondition _gurad_condition;
     std::atomic<bool> _running = { true };
+    // received samples are copied into pooled samples, which return to the pool once the receivers released them
+    fep3::DataSamplePool _sample_pool;
 
 public:
     StreamItemDataReader(const std::shared_ptr<StreamItemTopic> & topic
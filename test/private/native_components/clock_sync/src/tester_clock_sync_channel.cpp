@@ -0,0 +1,160 @@
+/**
+ * @file
+ * Copyright &copy; Audi AG. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ */
+
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <common/gtest_asserts.h>
+
+#include <fep3/native_components/clock_sync/clock_sync_channel.h>
+
+using namespace ::testing;
+using namespace fep3;
+using namespace fep3::rpc;
+using namespace std::chrono;
+
+using EventID = IRPCClockSyncMasterDef::EventID;
+
+struct ReceivedEvent
+{
+    EventID _event_id;
+    Timestamp _new_time;
+    Timestamp _old_time;
+
+    bool operator==(const ReceivedEvent& other) const
+    {
+        return _event_id == other._event_id && _new_time == other._new_time && _old_time == other._old_time;
+    }
+};
+
+struct ClockSyncChannelTest : public Test
+{
+    ClockSyncChannelTest()
+        : _server([this](EventID event_id, Timestamp new_time, Timestamp old_time)
+            {
+                std::this_thread::sleep_for(_handler_delay);
+                std::lock_guard<std::mutex> lock(_mutex);
+                _received_events.push_back({ event_id, new_time, old_time });
+                return new_time;
+            })
+    {
+    }
+
+    std::string getServerAddress() const
+    {
+        return createClockSyncChannelAddress("http://127.0.0.1:9090", _server.getPort());
+    }
+
+    std::vector<ReceivedEvent> getReceivedEvents()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _received_events;
+    }
+
+    milliseconds _handler_delay{ 0 };
+    std::mutex _mutex;
+    std::vector<ReceivedEvent> _received_events;
+    ClockSyncChannelServer _server;
+};
+
+/**
+ * @detail Test whether all events sent in one frame are processed by the slave in order
+ * and the frame is acknowledged with the time of the slave.
+ */
+TEST_F(ClockSyncChannelTest, transmitsEventsOfOneFrameInOrder)
+{
+    ASSERT_FEP3_NOERROR(_server.open());
+    ASSERT_NE(_server.getPort(), 0);
+
+    ClockSyncChannelClient client;
+    ASSERT_FEP3_NOERROR(client.connect(getServerAddress(), seconds(1)));
+
+    client.queueEvent(EventID::time_update_before, Timestamp{ 100 }, Timestamp{ 0 });
+    client.queueEvent(EventID::time_updating, Timestamp{ 100 }, Timestamp{ 0 });
+    client.queueEvent(EventID::time_update_after, Timestamp{ 100 }, Timestamp{ 0 });
+    EXPECT_EQ(client.sendEvents(seconds(1)), Timestamp{ 100 });
+
+    client.queueEvent(EventID::time_reset, Timestamp{ -5 }, Timestamp{ 100 });
+    EXPECT_EQ(client.sendEvents(seconds(1)), Timestamp{ -5 });
+
+    const std::vector<ReceivedEvent> expected_events{
+        { EventID::time_update_before, Timestamp{ 100 }, Timestamp{ 0 } },
+        { EventID::time_updating, Timestamp{ 100 }, Timestamp{ 0 } },
+        { EventID::time_update_after, Timestamp{ 100 }, Timestamp{ 0 } },
+        { EventID::time_reset, Timestamp{ -5 }, Timestamp{ 100 } } };
+    EXPECT_EQ(getReceivedEvents(), expected_events);
+}
+
+/**
+ * @detail Test whether a frame which is not acknowledged in time throws
+ * and the channel can not be used afterwards.
+ */
+TEST_F(ClockSyncChannelTest, throwsOnTimeout)
+{
+    _handler_delay = milliseconds(300);
+    ASSERT_FEP3_NOERROR(_server.open());
+
+    ClockSyncChannelClient client;
+    ASSERT_FEP3_NOERROR(client.connect(getServerAddress(), seconds(1)));
+
+    client.queueEvent(EventID::time_updating, Timestamp{ 100 }, Timestamp{ 0 });
+    EXPECT_THROW(client.sendEvents(milliseconds(50)), ClockSyncChannelError);
+
+    client.queueEvent(EventID::time_updating, Timestamp{ 200 }, Timestamp{ 100 });
+    EXPECT_THROW(client.sendEvents(seconds(1)), ClockSyncChannelError);
+}
+
+/**
+ * @detail Test whether connecting fails if no slave listens at the address.
+ */
+TEST_F(ClockSyncChannelTest, connectFailsWithoutServer)
+{
+    ASSERT_FEP3_NOERROR(_server.open());
+    const auto address = getServerAddress();
+    _server.close();
+
+    ClockSyncChannelClient client;
+    EXPECT_FEP3_RESULT(client.connect(address, milliseconds(100)), ERR_NOT_CONNECTED);
+    EXPECT_FEP3_RESULT(client.connect("no_port", milliseconds(100)), ERR_INVALID_ARG);
+}
+
+/**
+ * @detail Test whether connecting to a slave which does not answer returns within the timeout.
+ * The server serves one master at a time, so the second master is not answered.
+ */
+TEST_F(ClockSyncChannelTest, connectTimesOut)
+{
+    ASSERT_FEP3_NOERROR(_server.open());
+
+    ClockSyncChannelClient client;
+    ASSERT_FEP3_NOERROR(client.connect(getServerAddress(), seconds(1)));
+
+    ClockSyncChannelClient second_client;
+    const auto begin = steady_clock::now();
+    EXPECT_FALSE(isOk(second_client.connect(getServerAddress(), milliseconds(200))));
+    EXPECT_LT(steady_clock::now() - begin, milliseconds(1000));
+}
+
+/**
+ * @detail Test the creation of the channel address from the url of the participant server.
+ */
+TEST(ClockSyncChannelAddress, createsAddressFromServerUrl)
+{
+    EXPECT_EQ(createClockSyncChannelAddress("http://my_host:9090", 1234), "my_host:1234");
+    EXPECT_EQ(createClockSyncChannelAddress("http://127.0.0.1:9090/", 1234), "127.0.0.1:1234");
+    EXPECT_EQ(createClockSyncChannelAddress("", 1234), "");
+    EXPECT_EQ(createClockSyncChannelAddress("http://my_host:9090", 0), "");
+    // the wildcard address is replaced by the host name
+    EXPECT_THAT(createClockSyncChannelAddress("http://0.0.0.0:9090", 1234), Not(StartsWith("0.0.0.0")));
+}
@@ -9,7 +9,12 @@
  *
  */
 
+#include <atomic>
+#include <mutex>
+#include <numeric>
 #include <string>
+#include <thread>
+#include <vector>
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
@@ -352,4 +357,169 @@ TEST_F(NativeClockSyncMasterTest, synchronizationSuccess)
      /// we only test for no error
      ASSERT_FEP3_NOERROR(clock_master.updateTimeout(milliseconds(3000)));
      ASSERT_FEP3_NOERROR(clock_master.updateTimeout(milliseconds(1)));
- }
\ No newline at end of file
+ }
+/**
+* @detail Test the clock sync master synchronization via the binary sync channel of a slave.
+* All time events of one time step are sent via the channel and no rpc calls are made.
+* If the slave does not acknowledge in time, the slave is deactivated.
+*
+*/
+ TEST_F(NativeClockSyncMasterTest, synchronizeViaSyncChannel)
+ {
+     const std::string slave_one_name{ "slave_one" };
+     ClockMaster clock_master(
+         _logger_mock,
+         _rpc_timeout,
+         _set_participant_to_error_state,
+         _get_rpc_requester_by_name);
+
+     std::mutex mutex;
+     std::vector<std::pair<EventID, Timestamp>> received_events;
+     std::atomic<bool> slow_slave{ false };
+     ClockSyncChannelServer sync_channel_server([&](EventID event_id, Timestamp new_time, Timestamp /*old_time*/)
+         {
+             if (slow_slave)
+             {
+                 std::this_thread::sleep_for(_rpc_timeout * 2);
+             }
+             std::lock_guard<std::mutex> lock(mutex);
+             received_events.emplace_back(event_id, new_time);
+             return new_time;
+         });
+     ASSERT_FEP3_NOERROR(sync_channel_server.open());
+
+     EXPECT_CALL(_get_rpc_requester_by_name_mock, Call(slave_one_name))
+         .WillOnce(Return(_rpc_requester_mock));
+     EXPECT_CALL(*_rpc_requester_mock, sendRequest(_, _, _)).Times(0);
+
+     ASSERT_FEP3_NOERROR(clock_master.registerSlave(slave_one_name,
+         static_cast<int>(EventIDFlag::register_for_time_update_before)
+         | static_cast<int>(EventIDFlag::register_for_time_updating)
+         | static_cast<int>(EventIDFlag::register_for_time_update_after)));
+     ASSERT_FEP3_RESULT(clock_master.registerSlaveSyncChannel("unknown_slave",
+         createClockSyncChannelAddress("http://127.0.0.1:9090", sync_channel_server.getPort())), ERR_NOT_FOUND);
+     ASSERT_FEP3_NOERROR(clock_master.registerSlaveSyncChannel(slave_one_name,
+         createClockSyncChannelAddress("http://127.0.0.1:9090", sync_channel_server.getPort())));
+
+     clock_master.timeUpdateBegin(Timestamp{ 0 }, Timestamp{ 1 });
+     clock_master.timeUpdating(Timestamp{ 1 });
+     clock_master.timeUpdateEnd(Timestamp{ 1 });
+
+     {
+         std::lock_guard<std::mutex> lock(mutex);
+         const std::vector<std::pair<EventID, Timestamp>> expected_events{
+             { EventID::time_update_before, Timestamp{ 1 } },
+             { EventID::time_updating, Timestamp{ 1 } },
+             { EventID::time_update_after, Timestamp{ 1 } } };
+         EXPECT_EQ(received_events, expected_events);
+     }
+
+     slow_slave = true;
+     EXPECT_CALL(*_logger_mock, logError(HasSubstr("sync channel")))
+         .WillOnce(Return(ERR_NOERROR));
+     clock_master.timeUpdating(Timestamp{ 2 });
+ }
+
+/**
+* @detail Test the clock sync master synchronization via the binary sync channel of a slave
+* which is not registered for the time updating event.
+* The events the slave is registered for are sent in frames of their own and none is dropped.
+*
+*/
+ TEST_F(NativeClockSyncMasterTest, synchronizeViaSyncChannelWithoutTimeUpdating)
+ {
+     const std::string slave_one_name{ "slave_one" };
+     ClockMaster clock_master(
+         _logger_mock,
+         _rpc_timeout,
+         _set_participant_to_error_state,
+         _get_rpc_requester_by_name);
+
+     std::mutex mutex;
+     std::vector<std::pair<EventID, Timestamp>> received_events;
+     ClockSyncChannelServer sync_channel_server([&](EventID event_id, Timestamp new_time, Timestamp /*old_time*/)
+         {
+             std::lock_guard<std::mutex> lock(mutex);
+             received_events.emplace_back(event_id, new_time);
+             return new_time;
+         });
+     ASSERT_FEP3_NOERROR(sync_channel_server.open());
+
+     EXPECT_CALL(_get_rpc_requester_by_name_mock, Call(slave_one_name))
+         .WillOnce(Return(_rpc_requester_mock));
+     EXPECT_CALL(*_rpc_requester_mock, sendRequest(_, _, _)).Times(0);
+     EXPECT_CALL(*_logger_mock, logError(_)).Times(0);
+     EXPECT_CALL(_set_participant_to_error_state_mock, Call()).Times(0);
+
+     ASSERT_FEP3_NOERROR(clock_master.registerSlave(slave_one_name,
+         static_cast<int>(EventIDFlag::register_for_time_update_before)
+         | static_cast<int>(EventIDFlag::register_for_time_update_after)));
+     ASSERT_FEP3_NOERROR(clock_master.registerSlaveSyncChannel(slave_one_name,
+         createClockSyncChannelAddress("http://127.0.0.1:9090", sync_channel_server.getPort())));
+
+     // more steps than events fit into one frame
+     for (int64_t time = 1; time <= 5; ++time)
+     {
+         clock_master.timeUpdateBegin(Timestamp{ time - 1 }, Timestamp{ time });
+         clock_master.timeUpdating(Timestamp{ time });
+         clock_master.timeUpdateEnd(Timestamp{ time });
+     }
+
+     std::vector<std::pair<EventID, Timestamp>> expected_events;
+     for (int64_t time = 1; time <= 5; ++time)
+     {
+         expected_events.emplace_back(EventID::time_update_before, Timestamp{ time });
+         expected_events.emplace_back(EventID::time_update_after, Timestamp{ time });
+     }
+     std::lock_guard<std::mutex> lock(mutex);
+     EXPECT_EQ(received_events, expected_events);
+ }
+
+/**
+* @detail Test whether the clock sync master synchronizes multiple slaves concurrently
+* and provides the latencies of every slave.
+*
+*/
+ TEST_F(NativeClockSyncMasterTest, synchronizeSlavesConcurrently)
+ {
+     const std::vector<std::string> slave_names{ "slave_one", "slave_two", "slave_three", "slave_four",
+         "slave_five", "slave_six", "slave_seven", "slave_eight" };
+     const milliseconds slave_latency{ 100 };
+     ClockMaster clock_master(
+         _logger_mock,
+         _rpc_timeout,
+         _set_participant_to_error_state,
+         _get_rpc_requester_by_name);
+
+     const auto reply = R"({"id" : 1,"jsonrpc" : "2.0","result" : "100"})";
+
+     EXPECT_CALL(_get_rpc_requester_by_name_mock, Call(_))
+         .WillRepeatedly(Return(_rpc_requester_mock));
+     EXPECT_CALL(*_rpc_requester_mock, sendRequest(_, ContainsRegex(createRequestRegex(IRPCClockSyncMasterDef::EventID::time_updating)), _))
+         .Times(static_cast<int>(slave_names.size()))
+         .WillRepeatedly(DoAll(
+             WithArg<2>(testing::Invoke([reply, slave_latency](IRPCRequester::IRPCResponse& pResponse) {
+                 std::this_thread::sleep_for(slave_latency);
+                 pResponse.set(reply);
+             })),
+             Return(ERR_NOERROR)));
+     EXPECT_CALL(*_logger_mock, logError(_)).Times(0);
+
+     for (const auto& slave_name : slave_names)
+     {
+         ASSERT_FEP3_NOERROR(clock_master.registerSlave(slave_name, static_cast<int>(EventIDFlag::register_for_time_updating)));
+     }
+
+     const auto begin = steady_clock::now();
+     clock_master.timeUpdating(Timestamp{ 1 });
+     EXPECT_LT(steady_clock::now() - begin, slave_latency * slave_names.size() / 2);
+
+     const auto latencies = clock_master.getSlaveSyncLatencies();
+     ASSERT_EQ(latencies.size(), slave_names.size());
+     for (const auto& latency : latencies)
+     {
+         EXPECT_EQ(latency.second._count, 1u);
+         EXPECT_GE(latency.second._min, slave_latency);
+         EXPECT_EQ(std::accumulate(latency.second._buckets.begin(), latency.second._buckets.end(), uint64_t{ 0 }), 1u);
+     }
+ }
@@ -457,6 +457,8 @@ TEST_F(ContinuousClockSyncSlaveService, testSyncSlaveFrequencyConfiguration)
          EXPECT_CALL(*_rpc_clock_sync_master_mock, getMasterType()).WillOnce(
              Return(static_cast<int>(fep3::IClock::ClockType::discrete)));
          EXPECT_CALL(*_rpc_clock_sync_master_mock, registerSyncSlave(_, _)).WillOnce(Return(1));
+         // the sync channel is declined, so the time events are received by syncTimeEvent calls
+         EXPECT_CALL(*_rpc_clock_sync_master_mock, registerSyncChannel(_, _)).WillOnce(Return(-1));
 		 EXPECT_CALL(*_event_sink_mock, timeResetBegin(Duration{ 0 }, Duration{ 0 }));
 		 EXPECT_CALL(*_event_sink_mock, timeResetEnd(Duration{ 0 }));
          _component_registry->start();                  
@@ -489,6 +491,8 @@ TEST_F(ContinuousClockSyncSlaveService, testSyncSlaveFrequencyConfiguration)
       {
           EXPECT_CALL(*_rpc_clock_sync_master_mock, getMasterType()).WillOnce(Return(static_cast<int>(fep3::IClock::ClockType::discrete)));
           EXPECT_CALL(*_rpc_clock_sync_master_mock, registerSyncSlave(_, _)).WillOnce(Return(1));
+          // the sync channel is declined, so the time events are received by syncTimeEvent calls
+          EXPECT_CALL(*_rpc_clock_sync_master_mock, registerSyncChannel(_, _)).WillOnce(Return(-1));
 		  EXPECT_CALL(*_event_sink_mock, timeResetBegin(Duration{ 0 }, Duration{ 0 }));
 		  EXPECT_CALL(*_event_sink_mock, timeResetEnd(Duration{ 0 }));
 		  _component_registry->start();         
@@ -531,6 +535,8 @@ TEST_F(ContinuousClockSyncSlaveService, testSyncSlaveFrequencyConfiguration)
      {
          EXPECT_CALL(*_rpc_clock_sync_master_mock, getMasterType()).WillOnce(Return(static_cast<int>(fep3::IClock::ClockType::discrete)));
          EXPECT_CALL(*_rpc_clock_sync_master_mock, registerSyncSlave(_, _)).WillOnce(Return(1));       
+         // the sync channel is declined, so the time events are received by syncTimeEvent calls
+         EXPECT_CALL(*_rpc_clock_sync_master_mock, registerSyncChannel(_, _)).WillOnce(Return(-1));
 		 EXPECT_CALL(*_event_sink_mock, timeResetBegin(Duration{ 0 }, Duration{ 0 }));
 		 EXPECT_CALL(*_event_sink_mock, timeResetEnd(Duration{ 0 }));
 		 _component_registry->start();
@@ -10,6 +10,7 @@
  */
 
 #include <chrono>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -79,4 +80,94 @@ TEST(InterpolationTimeTest, ProvideNonInterpolatedTimeAfterReset)
             static_cast<double>(reset_time.count()),
             static_cast<double>(allowed_deviation.count()));
     }
-}
\ No newline at end of file
+}
+
+/**
+ * @detail Test whether the drift compensating interpolation time follows a master clock
+ * running at another rate than the local clock.
+ */
+TEST(DriftCompensatingInterpolationTimeTest, FollowMasterClockRate)
+{
+    DriftCompensatingInterpolationTime interpolation_time(8);
+    const Duration round_trip_time{ duration_cast<nanoseconds>(1ms) },
+        allowed_deviation{ duration_cast<nanoseconds>(3ms) };
+    const auto start = steady_clock::now();
+    // the master clock runs at double speed
+    const auto getMasterTime = [&]() { return Timestamp{ 2 * (steady_clock::now() - start) + 1s }; };
+
+    ASSERT_EQ(0, interpolation_time.getTime().count());
+
+    // actual test case
+    {
+        for (int sample = 0; sample < 8; ++sample)
+        {
+            interpolation_time.setTime(getMasterTime() - round_trip_time / 2, round_trip_time);
+            std::this_thread::sleep_for(5ms);
+        }
+
+        // Cristian's algorithm would deviate by the sync cycle time here
+        std::this_thread::sleep_for(50ms);
+        const auto expected_time = getMasterTime();
+        EXPECT_NEAR(
+            static_cast<double>(interpolation_time.getTime().count()),
+            static_cast<double>(expected_time.count()),
+            static_cast<double>(allowed_deviation.count()));
+    }
+}
+
+/**
+ * @detail Test whether the drift compensating interpolation time discards times
+ * received with an outlying roundtrip time.
+ */
+TEST(DriftCompensatingInterpolationTimeTest, DiscardOutlyingRoundtripTimes)
+{
+    DriftCompensatingInterpolationTime interpolation_time(8);
+    const Duration round_trip_time{ duration_cast<nanoseconds>(1ms) },
+        allowed_deviation{ duration_cast<nanoseconds>(3ms) };
+    const auto start = steady_clock::now();
+    const auto getMasterTime = [&]() { return Timestamp{ (steady_clock::now() - start) + 1s }; };
+
+    // actual test case
+    {
+        for (int sample = 0; sample < 4; ++sample)
+        {
+            interpolation_time.setTime(getMasterTime() - round_trip_time / 2, round_trip_time);
+            std::this_thread::sleep_for(2ms);
+        }
+        // a request delayed asymmetrically, Cristian's algorithm would be off by 49ms
+        interpolation_time.setTime(getMasterTime(), 100ms);
+
+        EXPECT_NEAR(
+            static_cast<double>(interpolation_time.getTime().count()),
+            static_cast<double>(getMasterTime().count()),
+            static_cast<double>(allowed_deviation.count()));
+    }
+}
+
+/**
+ * @detail Test whether the drift compensating interpolation time provides the time set by a reset
+ * and detects a reset of the master clock.
+ */
+TEST(DriftCompensatingInterpolationTimeTest, ProvideNonInterpolatedTimeAfterReset)
+{
+    DriftCompensatingInterpolationTime interpolation_time(8);
+    const Timestamp reset_time{ duration_cast<nanoseconds>(10ms) },
+        allowed_deviation{ duration_cast<nanoseconds>(1ms) };
+
+    // actual test case
+    {
+        interpolation_time.setTime(Timestamp{ 10s }, Duration{ 0 });
+        interpolation_time.resetTime(reset_time);
+        EXPECT_NEAR(
+            static_cast<double>(interpolation_time.getTime().count()),
+            static_cast<double>(reset_time.count()),
+            static_cast<double>(allowed_deviation.count()));
+
+        interpolation_time.setTime(Timestamp{ 20s }, Duration{ 0 });
+        interpolation_time.setTime(reset_time, Duration{ 0 });
+        EXPECT_NEAR(
+            static_cast<double>(interpolation_time.getTime().count()),
+            static_cast<double>(reset_time.count()),
+            static_cast<double>(allowed_deviation.count()));
+    }
+}
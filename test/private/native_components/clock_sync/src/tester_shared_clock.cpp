@@ -0,0 +1,216 @@
+/**
+ * @file
+ * Copyright &copy; Audi AG. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ */
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <common/gtest_asserts.h>
+
+#include <fep3/components/clock/mock/mock_clock_service.h>
+#include <fep3/native_components/clock_sync/shared_clock_client.h>
+#include <fep3/native_components/clock_sync/shared_clock_segment.h>
+
+using namespace ::testing;
+using namespace fep3;
+using namespace fep3::rpc;
+using namespace std::chrono;
+
+using EventID = IRPCClockSyncMasterDef::EventID;
+using EventSinkMock = NiceMock<fep3::mock::EventSink>;
+
+namespace
+{
+
+const std::string system_name{ "tester_shared_clock_system" };
+
+std::string getMasterName()
+{
+    // tests running in parallel must not share the segment
+    return std::string("tester_shared_clock_") + UnitTest::GetInstance()->current_test_info()->name();
+}
+
+bool waitForAcquiredSlot(const SharedClockSegment& segment, milliseconds timeout)
+{
+    const auto timeout_until = steady_clock::now() + timeout;
+    while (segment.getAcquiredSlots() == 0)
+    {
+        if (steady_clock::now() >= timeout_until)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(milliseconds(1));
+    }
+    return true;
+}
+
+} // namespace
+
+/**
+ * @detail Test whether a slave reads the time and the events published by the master.
+ */
+TEST(SharedClockSegmentTest, slaveReadsPublishedTime)
+{
+    SharedClockSegment master;
+    ASSERT_FEP3_NOERROR(master.create(system_name, getMasterName()));
+
+    SharedClockSegment slave;
+    ASSERT_FEP3_NOERROR(slave.open(system_name, getMasterName()));
+    EXPECT_TRUE(slave.isMasterAlive());
+    EXPECT_EQ(slave.read()._event_sequence, 0u);
+
+    master.setRunning(true, IClock::ClockType::discrete);
+    const auto event_sequence = master.publishEvent(EventID::time_updating, Timestamp{ 100 }, Timestamp{ 0 });
+    EXPECT_TRUE(slave.waitForEvent(0, milliseconds(100)));
+
+    const auto state = slave.read();
+    EXPECT_TRUE(state._running);
+    EXPECT_EQ(state._clock_type, IClock::ClockType::discrete);
+    EXPECT_EQ(state._event_sequence, event_sequence);
+    EXPECT_EQ(state._event_id, EventID::time_updating);
+    EXPECT_EQ(state._new_time, Timestamp{ 100 });
+    EXPECT_FALSE(slave.waitForEvent(event_sequence, milliseconds(10)));
+
+    master.close();
+    EXPECT_TRUE(slave.isClosed());
+    EXPECT_FALSE(slave.isMasterAlive());
+    EXPECT_FEP3_RESULT(slave.open(system_name, getMasterName()), ERR_NOT_FOUND);
+}
+
+/**
+ * @detail Test whether a segment can not be created twice while its master is alive.
+ */
+TEST(SharedClockSegmentTest, createFailsIfUsedByAnotherMaster)
+{
+    SharedClockSegment master;
+    ASSERT_FEP3_NOERROR(master.create(system_name, getMasterName()));
+
+    SharedClockSegment other_master;
+    EXPECT_FEP3_RESULT(other_master.create(system_name, getMasterName()), ERR_RESOURCE_IN_USE);
+
+    master.close();
+    EXPECT_FEP3_NOERROR(other_master.create(system_name, getMasterName()));
+}
+
+/**
+ * @detail Test whether masters of the same name in different systems use different segments.
+ */
+TEST(SharedClockSegmentTest, mastersOfOtherSystemsUseOtherSegments)
+{
+    SharedClockSegment master;
+    ASSERT_FEP3_NOERROR(master.create(system_name, getMasterName()));
+
+    SharedClockSegment other_system_master;
+    ASSERT_FEP3_NOERROR(other_system_master.create("other_system", getMasterName()));
+
+    SharedClockSegment slave;
+    ASSERT_FEP3_NOERROR(slave.open(system_name, getMasterName()));
+    other_system_master.setRunning(true, IClock::ClockType::discrete);
+    EXPECT_FALSE(slave.read()._running);
+
+    other_system_master.close();
+    EXPECT_FALSE(slave.isClosed());
+}
+
+/**
+ * @detail Test whether the master waits for the acknowledgement of a slave
+ * and releases the slave if it does not acknowledge in time.
+ */
+TEST(SharedClockSegmentTest, masterReleasesSlaveNotAcknowledging)
+{
+    SharedClockSegment master;
+    ASSERT_FEP3_NOERROR(master.create(system_name, getMasterName()));
+    SharedClockSegment slave;
+    ASSERT_FEP3_NOERROR(slave.open(system_name, getMasterName()));
+
+    const auto slot = slave.acquireSlot();
+    ASSERT_NE(slot, -1);
+    EXPECT_EQ(master.getAcquiredSlots(), 1);
+
+    auto event_sequence = master.publishEvent(EventID::time_updating, Timestamp{ 100 }, Timestamp{ 0 });
+    std::thread acknowledging_slave([&]() { slave.acknowledge(slot, event_sequence); });
+    EXPECT_EQ(master.waitForAcknowledgements(event_sequence, seconds(1)), 0);
+    acknowledging_slave.join();
+
+    event_sequence = master.publishEvent(EventID::time_updating, Timestamp{ 200 }, Timestamp{ 0 });
+    EXPECT_EQ(master.waitForAcknowledgements(event_sequence, milliseconds(50)), 1);
+    EXPECT_EQ(master.getAcquiredSlots(), 0);
+    EXPECT_FALSE(slave.acknowledge(slot, event_sequence));
+}
+
+/**
+ * @detail Test whether the discrete shared clock processes every time event of the master
+ * before the master continues.
+ */
+TEST(SharedClockTest, discreteClockFollowsMasterInLockstep)
+{
+    SharedClockSegment master;
+    ASSERT_FEP3_NOERROR(master.create(system_name, getMasterName()));
+    master.setRunning(true, IClock::ClockType::discrete);
+
+    auto event_sink = std::make_shared<EventSinkMock>();
+    SharedClockDiscrete shared_clock(system_name, getMasterName(), milliseconds(100), nullptr);
+    IClock& clock = shared_clock;
+    clock.start(event_sink);
+    ASSERT_TRUE(waitForAcquiredSlot(master, seconds(1)));
+
+    {
+        InSequence sequence;
+        EXPECT_CALL(*event_sink, timeUpdating(Timestamp{ 10 })).Times(1);
+        EXPECT_CALL(*event_sink, timeUpdating(Timestamp{ 20 })).Times(1);
+        EXPECT_CALL(*event_sink, timeResetBegin(Timestamp{ 20 }, Timestamp{ 5 })).Times(1);
+    }
+
+    for (const auto& event : { std::make_pair(EventID::time_updating, Timestamp{ 10 }),
+                               std::make_pair(EventID::time_updating, Timestamp{ 20 }),
+                               std::make_pair(EventID::time_reset, Timestamp{ 5 }) })
+    {
+        const auto event_sequence = master.publishEvent(event.first, event.second, Timestamp{ 0 });
+        ASSERT_EQ(master.waitForAcknowledgements(event_sequence, seconds(1)), 0);
+        EXPECT_EQ(clock.getTime(), event.second);
+    }
+
+    clock.stop();
+    EXPECT_EQ(master.getAcquiredSlots(), 0);
+}
+
+/**
+ * @detail Test whether the continuous shared clock extrapolates the published time of a continuous master.
+ */
+TEST(SharedClockTest, continuousClockExtrapolatesPublishedTime)
+{
+    SharedClockSegment master;
+    ASSERT_FEP3_NOERROR(master.create(system_name, getMasterName()));
+    master.publishTime(Timestamp{ seconds(10) });
+    master.setRunning(true, IClock::ClockType::continuous);
+
+    SharedClockInterpolating shared_clock(system_name, getMasterName(), milliseconds(100), nullptr);
+    IClock& clock = shared_clock;
+    const auto event_sink = std::make_shared<EventSinkMock>();
+    clock.start(event_sink);
+
+    const auto first_time = clock.getTime();
+    EXPECT_GE(first_time, Timestamp{ seconds(10) });
+    EXPECT_LT(first_time, Timestamp{ seconds(11) });
+
+    std::this_thread::sleep_for(milliseconds(20));
+    EXPECT_GE(clock.getTime(), first_time + milliseconds(20));
+
+    // the time of a stopped master does not advance
+    master.setRunning(false, IClock::ClockType::continuous);
+    master.publishTime(Timestamp{ seconds(20) });
+    EXPECT_EQ(clock.getTime(), Timestamp{ seconds(20) });
+
+    clock.stop();
+}
@@ -9,6 +9,8 @@
 *
 */
 #include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
 
 #include "test_data_registry_client_stub.h"
 
@@ -19,6 +21,8 @@
 #include "fep3/native_components/service_bus/service_bus.h"
 #include "fep3/native_components/service_bus/testing/service_bus_testing.hpp"
 #include "fep3/native_components/data_registry/data_registry.h"
+#include "fep3/native_components/data_registry/data_receive_dispatcher.h"
+#include "fep3/native_components/configuration/configuration_service.h"
 #include "fep3/native_components/simulation_bus/simulation_bus.h"
 #include "fep3/components/simulation_bus/mock/mock_simulation_bus.h"
 #include "fep3/rpc_services/base/fep_rpc_client.h"
@@ -27,6 +31,10 @@
 #include "fep3/base/streamtype/default_streamtype.h"
 #include "fep3/base/sample/data_sample.h"
 
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
 
 bool containsVector(const std::vector<std::string>& source_vec,
                     const std::vector<std::string>& contain_vec)
@@ -403,4 +411,196 @@ TEST_F(NativeDataCommunication, sendAndReceiveData)
     EXPECT_EQ(value_read_from_listener, value_read_from_reader_dynamic_size);
     EXPECT_EQ(value_read_from_listener, value_read_from_reader_1);
     EXPECT_EQ(value_read_from_listener, value_written);
-}
\ No newline at end of file
+}
+
+/**
+ * @detail Test that a dispatcher with fewer threads than readers passes the items of all readers to their receivers
+ * @req_id FEPSDK-DataRegistry
+ */
+TEST(NativeDataReceiveDispatcher, dispatchesAllReadersWithSharedThreads)
+{
+    fep3::native::SimulationBus simulation_bus;
+    const size_t signal_count = 5;
+
+    std::vector<std::unique_ptr<fep3::ISimulationBus::IDataReader>> readers;
+    std::vector<std::unique_ptr<fep3::ISimulationBus::IDataWriter>> writers;
+    std::vector<TestDataReceiver> receivers(signal_count);
+    for (size_t index = 0; index < signal_count; ++index)
+    {
+        const auto signal_name = "dispatched_signal_" + std::to_string(index);
+        readers.push_back(simulation_bus.getReader(signal_name));
+        writers.push_back(simulation_bus.getWriter(signal_name));
+        ASSERT_TRUE(readers.back());
+        ASSERT_TRUE(writers.back());
+    }
+
+    fep3::native::DataReceiveDispatcher dispatcher(2);
+    EXPECT_EQ(dispatcher.getThreadCount(), 2u);
+    for (size_t index = 0; index < signal_count; ++index)
+    {
+        dispatcher.add(*readers[index], receivers[index]);
+    }
+    dispatcher.start();
+
+    for (auto& writer : writers)
+    {
+        ASSERT_TRUE(fep3::isOk(writer->write(fep3::DataSample())));
+        ASSERT_TRUE(fep3::isOk(writer->transmit()));
+    }
+
+    for (auto& receiver : receivers)
+    {
+        EXPECT_TRUE(receiver.waitForSampleUpdate(20));
+    }
+
+    for (auto& reader : readers)
+    {
+        dispatcher.remove(*reader);
+    }
+    dispatcher.stop();
+}
+
+// Records the name of the thread the last sample was received on
+struct ThreadNameRecordingReceiver : public TestDataReceiver
+{
+    void operator()(const fep3::data_read_ptr<const fep3::IStreamType>& rec_type) override
+    {
+        TestDataReceiver::operator()(rec_type);
+    }
+    void operator()(const fep3::data_read_ptr<const fep3::IDataSample>& rec_sample) override
+    {
+#ifdef __linux__
+        char name[16] = {};
+        pthread_getname_np(pthread_self(), name, sizeof(name));
+        _thread_name = name;
+#endif
+        TestDataReceiver::operator()(rec_sample);
+    }
+
+    std::string _thread_name;
+};
+
+struct NativeDataReceiveThreads : public ::testing::Test
+{
+    void SetUp() override
+    {
+        ASSERT_TRUE(fep3::native::testing::prepareServiceBusForTestingDefault(*_service_bus,
+            "test_receive_threads",
+            "http://localhost:9923"));
+        ASSERT_EQ(_component_registry->registerComponent<fep3::IServiceBus>(_service_bus), fep3::ERR_NOERROR);
+        ASSERT_EQ(_component_registry->registerComponent<fep3::IConfigurationService>(_configuration_service), fep3::ERR_NOERROR);
+        ASSERT_EQ(_component_registry->registerComponent<fep3::ISimulationBus>(_simulation_bus), fep3::ERR_NOERROR);
+        ASSERT_EQ(_component_registry->registerComponent<fep3::IDataRegistry>(_registry), fep3::ERR_NOERROR);
+        ASSERT_EQ(_component_registry->create(), fep3::ERR_NOERROR);
+        ASSERT_EQ(_component_registry->initialize(), fep3::ERR_NOERROR);
+    }
+
+    void TearDown() override
+    {
+        EXPECT_EQ(_component_registry->deinitialize(), fep3::ERR_NOERROR);
+    }
+
+    std::shared_ptr<fep3::native::DataRegistry> _registry{ std::make_shared<fep3::native::DataRegistry>() };
+    std::shared_ptr<fep3::native::ServiceBus> _service_bus{ std::make_shared<fep3::native::ServiceBus>() };
+    std::shared_ptr<fep3::native::ConfigurationService> _configuration_service{ std::make_shared<fep3::native::ConfigurationService>() };
+    std::shared_ptr<fep3::native::SimulationBus> _simulation_bus{ std::make_shared<fep3::native::SimulationBus>() };
+    std::shared_ptr<fep3::ComponentRegistry> _component_registry{ std::make_shared<fep3::ComponentRegistry>() };
+};
+
+/**
+ * @detail Test that the input signals are received by the shared dispatcher threads
+ * if the property data_registry/receive_thread_count is set
+ * @req_id FEPSDK-DataRegistry
+ */
+TEST_F(NativeDataReceiveThreads, receiveWithConfiguredThreadCount)
+{
+    ASSERT_EQ(fep3::setPropertyValue(*_configuration_service, FEP3_DATA_REGISTRY_RECEIVE_THREAD_COUNT, 2), fep3::ERR_NOERROR);
+
+    const size_t signal_count = 3;
+    std::vector<std::shared_ptr<ThreadNameRecordingReceiver>> listeners;
+    std::vector<std::unique_ptr<fep3::IDataRegistry::IDataWriter>> writers;
+    for (size_t index = 0; index < signal_count; ++index)
+    {
+        const auto signal_name = "received_signal_" + std::to_string(index);
+        ASSERT_EQ(_registry->registerDataOut(signal_name, fep3::StreamTypeString(0)), fep3::ERR_NOERROR);
+        ASSERT_EQ(_registry->registerDataIn(signal_name, fep3::StreamTypeString(0)), fep3::ERR_NOERROR);
+        listeners.push_back(std::make_shared<ThreadNameRecordingReceiver>());
+        ASSERT_EQ(_registry->registerDataReceiveListener(signal_name, listeners.back()), fep3::ERR_NOERROR);
+        writers.push_back(_registry->getWriter(signal_name));
+        ASSERT_TRUE(writers.back());
+    }
+
+    ASSERT_EQ(_component_registry->tense(), fep3::ERR_NOERROR);
+    ASSERT_EQ(_component_registry->start(), fep3::ERR_NOERROR);
+
+    for (auto& writer : writers)
+    {
+        ASSERT_TRUE(fep3::isOk(writer->write(fep3::DataSampleType<std::string>(std::string("value")))));
+        ASSERT_TRUE(fep3::isOk(writer->flush()));
+    }
+
+    for (auto& listener : listeners)
+    {
+        EXPECT_TRUE(listener->waitForSampleUpdate(20));
+#ifdef __linux__
+        // the threads of the dispatcher are named "__data_rx_<index>"
+        EXPECT_EQ(listener->_thread_name.find("__data_rx_"), 0u) << listener->_thread_name;
+#endif
+    }
+
+    EXPECT_EQ(_component_registry->stop(), fep3::ERR_NOERROR);
+    EXPECT_EQ(_component_registry->relax(), fep3::ERR_NOERROR);
+}
+
+/**
+ * @detail Test that a negative receive thread count is rejected on tense
+ * @req_id FEPSDK-DataRegistry
+ */
+TEST_F(NativeDataReceiveThreads, rejectNegativeThreadCount)
+{
+    ASSERT_EQ(fep3::setPropertyValue(*_configuration_service, FEP3_DATA_REGISTRY_RECEIVE_THREAD_COUNT, -1), fep3::ERR_NOERROR);
+    ASSERT_EQ(_registry->registerDataIn("received_signal", fep3::StreamTypeString(0)), fep3::ERR_NOERROR);
+
+    EXPECT_EQ(_registry->tense(), fep3::ERR_INVALID_ARG);
+    EXPECT_EQ(_registry->relax(), fep3::ERR_NOERROR);
+}
+
+/**
+ * @detail Test that listeners may be registered and unregistered while data is received
+ * @req_id FEPSDK-DataRegistry
+ */
+TEST_F(NativeDataReceiveThreads, registerListenersWhileReceiving)
+{
+    ASSERT_EQ(_registry->registerDataOut("received_signal", fep3::StreamTypeString(0)), fep3::ERR_NOERROR);
+    ASSERT_EQ(_registry->registerDataIn("received_signal", fep3::StreamTypeString(0)), fep3::ERR_NOERROR);
+    auto writer = _registry->getWriter("received_signal");
+    ASSERT_TRUE(writer);
+
+    ASSERT_EQ(_component_registry->tense(), fep3::ERR_NOERROR);
+    ASSERT_EQ(_component_registry->start(), fep3::ERR_NOERROR);
+
+    std::atomic<bool> writing{ true };
+    std::thread writer_thread([&writer, &writing]()
+    {
+        while (writing)
+        {
+            writer->write(fep3::DataSampleType<std::string>(std::string("value")));
+            writer->flush();
+        }
+    });
+
+    for (size_t count = 0; count < 1000; ++count)
+    {
+        auto listener = std::make_shared<TestDataReceiver>();
+        EXPECT_EQ(_registry->registerDataReceiveListener("received_signal", listener), fep3::ERR_NOERROR);
+        EXPECT_EQ(_registry->unregisterDataReceiveListener("received_signal", listener), fep3::ERR_NOERROR);
+    }
+    auto listener = std::make_shared<TestDataReceiver>();
+    EXPECT_EQ(_registry->registerDataReceiveListener("received_signal", listener), fep3::ERR_NOERROR);
+    EXPECT_TRUE(listener->waitForSampleUpdate(20));
+
+    writing = false;
+    writer_thread.join();
+    EXPECT_EQ(_component_registry->stop(), fep3::ERR_NOERROR);
+    EXPECT_EQ(_component_registry->relax(), fep3::ERR_NOERROR);
+}
@@ -314,6 +314,11 @@ TEST_F(JobRegistryWithComponentRegistry, ReconfigureJobsByTimingConfiguration)
         EXPECT_EQ(300000000, configured_job_info._max_runtime_real_time.value().count());
         EXPECT_EQ(fep3::arya::JobConfiguration::TimeViolationStrategy::set_stm_to_error,
             configured_job_info._runtime_violation_strategy);
+        EXPECT_EQ(std::vector<std::string>{ "InputA" }, configured_job_info._input_signals);
+        EXPECT_EQ(std::vector<std::string>{ "OutputA" }, configured_job_info._output_signals);
+        EXPECT_EQ((std::vector<uint32_t>{ 0, 2, 3 }), configured_job_info._thread_configuration._cpu_affinity);
+        EXPECT_EQ(fep3::ThreadConfiguration::SchedulingPolicy::fifo, configured_job_info._thread_configuration._scheduling_policy);
+        EXPECT_EQ(80, configured_job_info._thread_configuration._priority);
     }
 
     ASSERT_FEP3_NOERROR(_component_registry->start());
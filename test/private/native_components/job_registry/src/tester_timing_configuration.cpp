@@ -190,6 +190,28 @@ constexpr auto config_invalid_output_queue_size = R"(
         </participant>
     </participants>
 </timing>)";
+constexpr auto config_invalid_thread_priority = R"(
+<?xml version="1.0" encoding="utf-8"?>
+<timing xmlns:timing="fep/xsd/timing">
+    <participants>
+        <participant>
+            <name>Participant</name>
+            <jobs>
+                <job>
+                    <name>Job</name>
+                    <cycle_time>10</cycle_time>
+                    <cycle_delay_time>20</cycle_delay_time>
+                    <max_run_realtime>30</max_run_realtime>
+                    <run_realtime_violation>warn_about_runtime_violation</run_realtime_violation>
+                    <thread>
+                        <cpu_affinity>1</cpu_affinity>
+                        <scheduling_policy>round_robin</scheduling_policy>
+                    </thread>
+                </job>
+            </jobs>
+        </participant>
+    </participants>
+</timing>)";
 }
 
 /**
@@ -217,6 +239,9 @@ TEST(TimingConfigurationParsing, ValidTimingConfiguration)
     EXPECT_EQ(job_configuration._delay_sim_time, fep3::Duration{ 200000000 });
     EXPECT_EQ(job_configuration._max_runtime_real_time.value(), fep3::Duration{ 300000000 });
     EXPECT_EQ(job_configuration._runtime_violation_strategy, fep3::JobConfiguration::TimeViolationStrategy::set_stm_to_error);
+    EXPECT_EQ(job_configuration._thread_configuration._cpu_affinity, (std::vector<uint32_t>{ 0, 2, 3 }));
+    EXPECT_EQ(job_configuration._thread_configuration._scheduling_policy, fep3::ThreadConfiguration::SchedulingPolicy::fifo);
+    EXPECT_EQ(job_configuration._thread_configuration._priority, 80);
 
     EXPECT_EQ(data_job_configuration._job_input_configurations.at("InputA")._queue_size, 10);
     EXPECT_EQ(data_job_configuration._job_output_configurations.at("OutputA")._queue_size, 10);
@@ -229,6 +254,7 @@ TEST(TimingConfigurationParsing, ValidTimingConfiguration)
     EXPECT_EQ(job_configuration_2._delay_sim_time, fep3::Duration{ 500000000 });
     EXPECT_EQ(job_configuration_2._max_runtime_real_time.value(), fep3::Duration{ 600000000 });
     EXPECT_EQ(job_configuration_2._runtime_violation_strategy, fep3::JobConfiguration::TimeViolationStrategy::ignore_runtime_violation);
+    EXPECT_TRUE(job_configuration_2._thread_configuration.isDefault());
 
     const auto data_job_configuration_3{ participant_configuration_2._data_job_configurations.at("my_job3") };
     const auto job_configuration_3{ data_job_configuration_3._job_configuration };
@@ -387,6 +413,19 @@ TEST(TimingConfigurationParsing, ErrorConfigInvalidOutputQueueSize)
         ".*output node value \"queue_size\". Value has to be >= 0.");
 }
 
+/**
+* @brief Parsing a timing configuration specifying a real-time scheduling policy without priority shall return
+* the corresponding error.
+*
+*/
+TEST(TimingConfigurationParsing, ErrorConfigInvalidThreadPriority)
+{
+    TimingConfiguration timing_configuration;
+    ASSERT_FEP3_RESULT_WITH_MESSAGE(readTimingConfigFromString(config_invalid_thread_priority, timing_configuration),
+        fep3::ERR_INVALID_ARG,
+        ".*job node value \"thread\". the scheduling policy 'round_robin' requires a priority > 0.");
+}
+
 struct TimingConfigurationReconfigureInvalid : public ::testing::Test
 {
     Jobs _jobs;
@@ -9,6 +9,9 @@
 *
 */
 
+#include <atomic>
+#include <thread>
+
 #include <gtest/gtest.h>
 
 #include "fep3/components/base/component_registry.h"
@@ -72,3 +75,55 @@ TEST(TestLoggingService, TestLoggingConfiguration)
     ASSERT_FALSE(logger_c->isWarningEnabled());
     ASSERT_TRUE(logger_tester->isWarningEnabled());
 }
+
+/**
+* Test that the filter cached by the loggers follows every change of the configuration
+* @req_id ???
+*/
+TEST(TestLoggingService, TestLoggerFilterCache)
+{
+    auto logging = std::make_shared<fep3::native::LoggingService>();
+    auto logger = logging->createLogger("LoggerA.Tester");
+
+    // the default is info
+    ASSERT_TRUE(logger->isInfoEnabled());
+    ASSERT_FALSE(logger->isDebugEnabled());
+
+    // a change of the parent domain is seen by the cached filter
+    ASSERT_EQ(logging->setFilter("LoggerA", { fep3::logging::Severity::debug, { "console" } }), fep3::ERR_NOERROR);
+    ASSERT_TRUE(logger->isDebugEnabled());
+
+    // a change of another domain keeps the filter
+    ASSERT_EQ(logging->setFilter("LoggerB", { fep3::logging::Severity::off, { "console" } }), fep3::ERR_NOERROR);
+    ASSERT_TRUE(logger->isDebugEnabled());
+
+    ASSERT_EQ(logging->setFilter("LoggerA.Tester", { fep3::logging::Severity::error, { "console" } }), fep3::ERR_NOERROR);
+    ASSERT_FALSE(logger->isWarningEnabled());
+    ASSERT_TRUE(logger->isErrorEnabled());
+
+    // changing the configuration while checking from another thread
+    std::atomic<bool> stop{ false };
+    std::thread checker([&]()
+    {
+        while (!stop)
+        {
+            logger->isDebugEnabled();
+            logger->logDebug("checking");
+        }
+    });
+    for (int change = 0; change < 1000; ++change)
+    {
+        const auto severity = (change % 2 == 0) ? fep3::logging::Severity::debug : fep3::logging::Severity::fatal;
+        ASSERT_EQ(logging->setFilter("LoggerA", { severity, { "console" } }), fep3::ERR_NOERROR);
+    }
+    stop = true;
+    checker.join();
+    // the last change was fatal, the filter of LoggerA.Tester was replaced by it
+    ASSERT_TRUE(logger->isFatalEnabled());
+    ASSERT_FALSE(logger->isErrorEnabled());
+
+    // nothing is enabled after the logging service is gone
+    logging.reset();
+    ASSERT_FALSE(logger->isFatalEnabled());
+    ASSERT_EQ(logger->logFatal("not logged"), fep3::ERR_NOERROR);
+}
@@ -0,0 +1,299 @@
+/**
+* @file
+* Copyright &copy; Audi AG. All rights reserved.
+*
+* This Source Code Form is subject to the terms of the
+* Mozilla Public License, v. 2.0.
+* If a copy of the MPL was not distributed with this
+* file, You can obtain one at https://mozilla.org/MPL/2.0/.
+*
+*/
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "fep3/native_components/logging/logging_queue.h"
+
+using fep3::native::LoggingQueue;
+using fep3::native::LogRecord;
+
+namespace
+{
+
+LogRecord makeRecord(const std::string& message)
+{
+    LogRecord record;
+    record.setMessage(message);
+    return record;
+}
+
+/**
+ * Collects the messages of the handled records.
+ * Handling the record with the message "block" keeps the consumer thread busy until it is released,
+ * the release callback is called by the consumer thread before it continues.
+ */
+class RecordCollector
+{
+public:
+    std::function<void(const LogRecord&)> handler()
+    {
+        return [this](const LogRecord& record)
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            const auto message = record.getMessage();
+            if (message == "block")
+            {
+                _blocked = true;
+                _changed.notify_all();
+                _changed.wait(lock, [this]() { return _released; });
+                if (_on_release)
+                {
+                    _on_release();
+                }
+            }
+            else
+            {
+                _messages.push_back(message);
+            }
+        };
+    }
+    void waitUntilBlocked()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _changed.wait(lock, [this]() { return _blocked; });
+    }
+    void setOnRelease(const std::function<void()>& on_release)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _on_release = on_release;
+    }
+    void release()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _released = true;
+        _changed.notify_all();
+    }
+    std::vector<std::string> getMessages()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _messages;
+    }
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _changed;
+    bool _blocked{ false };
+    bool _released{ false };
+    std::function<void()> _on_release;
+    std::vector<std::string> _messages;
+};
+
+std::vector<std::string> toMessages(std::initializer_list<int> numbers)
+{
+    std::vector<std::string> messages;
+    for (const auto number : numbers)
+    {
+        messages.push_back(std::to_string(number));
+    }
+    return messages;
+}
+
+} // namespace
+
+/**
+ * @detail Test whether a burst of records from several threads is handled completely and in order per thread.
+ */
+TEST(LoggingQueueTest, handleBurst)
+{
+    constexpr int producers = 4;
+    constexpr int records_per_producer = 10000;
+    std::vector<std::vector<int>> handled(producers);
+    std::atomic<int> handled_count{ 0 };
+    {
+        LoggingQueue queue([&](const LogRecord& record)
+            {
+                handled[record._logger_id].push_back(std::stoi(record.getMessage()));
+                ++handled_count;
+            },
+            producers * records_per_producer,
+            LoggingQueue::OverflowPolicy::drop_newest);
+
+        std::vector<std::thread> threads;
+        for (int producer = 0; producer < producers; ++producer)
+        {
+            threads.emplace_back([&, producer]()
+            {
+                for (int number = 0; number < records_per_producer; ++number)
+                {
+                    auto record = makeRecord(std::to_string(number));
+                    record._logger_id = static_cast<uint32_t>(producer);
+                    EXPECT_TRUE(fep3::isOk(queue.add(std::move(record))));
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        //the consumer is woken up on add and does not poll
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (handled_count < producers * records_per_producer
+            && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        EXPECT_EQ(handled_count, producers * records_per_producer);
+        EXPECT_EQ(queue.getDroppedCount(), 0u);
+    }
+
+    for (const auto& numbers : handled)
+    {
+        ASSERT_EQ(numbers.size(), static_cast<size_t>(records_per_producer));
+        for (int number = 0; number < records_per_producer; ++number)
+        {
+            EXPECT_EQ(numbers[number], number);
+        }
+    }
+}
+
+/**
+ * @detail Test whether the new records are dropped, counted and reported if the queue is full.
+ */
+TEST(LoggingQueueTest, dropNewest)
+{
+    RecordCollector collector;
+    std::atomic<uint64_t> reported_dropped_count{ 0 };
+    {
+        LoggingQueue queue(collector.handler(), 4, LoggingQueue::OverflowPolicy::drop_newest,
+            [&](uint64_t dropped_count) { reported_dropped_count += dropped_count; });
+        ASSERT_TRUE(fep3::isOk(queue.add(makeRecord("block"))));
+        collector.waitUntilBlocked();
+
+        for (int number = 0; number < 10; ++number)
+        {
+            const auto result = queue.add(makeRecord(std::to_string(number)));
+            EXPECT_EQ(number < 4, fep3::isOk(result));
+        }
+        EXPECT_EQ(queue.getDroppedCount(), 6u);
+        collector.release();
+    }
+
+    EXPECT_EQ(collector.getMessages(), toMessages({ 0, 1, 2, 3 }));
+    EXPECT_EQ(reported_dropped_count, 6u);
+}
+
+/**
+ * @detail Test whether the oldest records are dropped in favour of the new ones if the queue is full.
+ */
+TEST(LoggingQueueTest, dropOldest)
+{
+    RecordCollector collector;
+    std::atomic<uint64_t> reported_dropped_count{ 0 };
+    {
+        LoggingQueue queue(collector.handler(), 4, LoggingQueue::OverflowPolicy::drop_oldest,
+            [&](uint64_t dropped_count) { reported_dropped_count += dropped_count; });
+        ASSERT_TRUE(fep3::isOk(queue.add(makeRecord("block"))));
+        collector.waitUntilBlocked();
+
+        for (int number = 0; number < 10; ++number)
+        {
+            EXPECT_TRUE(fep3::isOk(queue.add(makeRecord(std::to_string(number)))));
+        }
+        EXPECT_EQ(queue.getDroppedCount(), 6u);
+        collector.release();
+    }
+
+    EXPECT_EQ(collector.getMessages(), toMessages({ 6, 7, 8, 9 }));
+    EXPECT_EQ(reported_dropped_count, 6u);
+}
+
+/**
+ * @detail Test whether adding to a full queue waits for the consumer if the overflow policy is block.
+ */
+TEST(LoggingQueueTest, block)
+{
+    RecordCollector collector;
+    {
+        LoggingQueue queue(collector.handler(), 4, LoggingQueue::OverflowPolicy::block);
+        ASSERT_TRUE(fep3::isOk(queue.add(makeRecord("block"))));
+        collector.waitUntilBlocked();
+
+        std::mutex added_mutex;
+        std::condition_variable added_changed;
+        int added_count{ 0 };
+        std::thread producer([&]()
+        {
+            for (int number = 0; number < 10; ++number)
+            {
+                EXPECT_TRUE(fep3::isOk(queue.add(makeRecord(std::to_string(number)))));
+                std::lock_guard<std::mutex> lock(added_mutex);
+                ++added_count;
+                added_changed.notify_all();
+            }
+        });
+
+        {
+            std::unique_lock<std::mutex> lock(added_mutex);
+            EXPECT_TRUE(added_changed.wait_for(lock, std::chrono::seconds(5), [&]() { return added_count >= 4; }));
+        }
+
+        //the consumer still handles the blocking record, so the queue is full and the fifth add has to wait
+        int added_count_on_release{ -1 };
+        collector.setOnRelease([&]()
+        {
+            std::lock_guard<std::mutex> lock(added_mutex);
+            added_count_on_release = added_count;
+        });
+        collector.release();
+        producer.join();
+        EXPECT_EQ(added_count_on_release, 4);
+        EXPECT_EQ(queue.getDroppedCount(), 0u);
+    }
+
+    EXPECT_EQ(collector.getMessages(), toMessages({ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }));
+}
+
+/**
+ * @detail Test whether short messages are kept inline and long messages are kept completely.
+ */
+TEST(LoggingQueueTest, recordMessage)
+{
+    const std::string short_message(LogRecord::inline_message_capacity, 's');
+    const std::string long_message(LogRecord::inline_message_capacity + 1, 'l');
+
+    auto record = makeRecord(short_message);
+    EXPECT_EQ(record.getMessage(), short_message);
+    record.setMessage(long_message);
+    EXPECT_EQ(record.getMessage(), long_message);
+    record.setMessage("");
+    EXPECT_EQ(record.getMessage(), "");
+
+    //moving keeps the message
+    record.setMessage(short_message);
+    LogRecord moved = std::move(record);
+    EXPECT_EQ(moved.getMessage(), short_message);
+}
+
+/**
+ * @detail Test the parsing of the overflow policy property values.
+ */
+TEST(LoggingQueueTest, parseOverflowPolicy)
+{
+    LoggingQueue::OverflowPolicy overflow_policy;
+    ASSERT_TRUE(LoggingQueue::parseOverflowPolicy("drop_oldest", overflow_policy));
+    EXPECT_EQ(overflow_policy, LoggingQueue::OverflowPolicy::drop_oldest);
+    ASSERT_TRUE(LoggingQueue::parseOverflowPolicy("drop_newest", overflow_policy));
+    EXPECT_EQ(overflow_policy, LoggingQueue::OverflowPolicy::drop_newest);
+    ASSERT_TRUE(LoggingQueue::parseOverflowPolicy("block", overflow_policy));
+    EXPECT_EQ(overflow_policy, LoggingQueue::OverflowPolicy::block);
+    EXPECT_FALSE(LoggingQueue::parseOverflowPolicy("drop_all", overflow_policy));
+}
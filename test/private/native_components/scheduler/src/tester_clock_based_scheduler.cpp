@@ -11,8 +11,10 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <common/gtest_asserts.h>
+#include <atomic>
 #include <chrono>
 #include <iostream>
+#include <thread>
 
 #include <fep3/native_components/scheduler/clock_based/local_clock_based_scheduler.h>
 #include <fep3/components/job_registry/job_info.h>
@@ -570,4 +572,200 @@ TEST_F(ClockBasedSchedulerContinuous, NotCatchesUp)
     }       
    
     scheduler.stop();
-}
\ No newline at end of file
+}
+/**
+* @brief Discrete scheduling of several jobs executed by a job worker pool with less threads than jobs.
+* Every job has to be called for every cycle.
+*/
+TEST_F(ClockBasedSchedulerDiscrete, SchedulingWithJobWorkerPool)
+{
+    const auto max_time = 50ms;
+    const auto job_cycle_time = 10ms;
+
+    fep3::Jobs jobs;
+    std::vector<std::shared_ptr<NiceMock<fep3::mock::core::Job>>> my_jobs;
+    for (const auto& job_name : { "my_job_1", "my_job_2", "my_job_3" })
+    {
+        const helper::SimpleJobBuilder builder(job_name, duration_cast<fep3::Duration>(job_cycle_time));
+        auto my_job = builder.makeJob<NiceMock<fep3::mock::core::Job>>();
+        my_job->setDefaultBehaviour();
+        jobs.emplace(builder.makeJobInfo().getName(), fep3::JobEntry{ my_job, builder.makeJobInfo() });
+        my_jobs.push_back(my_job);
+    }
+
+    const auto job_execution_configuration = std::make_shared<fep3::native::JobExecutionConfiguration>();
+    job_execution_configuration->_job_worker_thread_count = 2;
+    fep3::native::LocalClockBasedScheduler scheduler(scheduler_test._logger, scheduler_test._set_participant_to_error_state,
+        nullptr, job_execution_configuration);
+
+    {
+        for (auto& my_job : my_jobs)
+        {
+            for (auto time = 0ms; time <= max_time; time += job_cycle_time)
+            {
+                EXPECT_CALL(*my_job, execute(fep3::Timestamp(time))).Times(1);
+            }
+        }
+
+        ASSERT_FEP3_RESULT(scheduler.initialize(clock_service, jobs), fep3::ERR_NOERROR);
+        ASSERT_FEP3_RESULT(scheduler.start(), fep3::ERR_NOERROR);
+
+        scheduler_event_sink.lock()->timeResetBegin(Timestamp(0), Timestamp(0));
+        scheduler_event_sink.lock()->timeResetEnd(Timestamp(0));
+
+        auto time = Timestamp(0);
+        while (time < max_time)
+        {
+            time += job_cycle_time;
+            scheduler_event_sink.lock()->timeUpdating(time);
+        }
+    }
+
+    scheduler.stop();
+    scheduler.deinitialize();
+}
+
+/**
+ * @brief It is tested that a job executed by the job worker pool never overlaps itself,
+ * even if it is woken up again while it is still running.
+ */
+TEST_F(ClockBasedSchedulerContinuous, JobWorkerPoolDoesNotOverlapJob)
+{
+    const auto job_cycle_time = 10ms;
+
+    const helper::SimpleJobBuilder builder("my_job", duration_cast<fep3::Duration>(job_cycle_time));
+
+    auto my_job = builder.makeJob<NiceMock<fep3::mock::core::Job>>();
+    my_job->setDefaultBehaviour();
+
+    const fep3::Jobs jobs{ {builder.makeJobInfo().getName(), {my_job, builder.makeJobInfo()}} };
+
+    const auto job_execution_configuration = std::make_shared<fep3::native::JobExecutionConfiguration>();
+    job_execution_configuration->_job_worker_thread_count = 4;
+    fep3::native::LocalClockBasedScheduler scheduler(scheduler_test._logger, scheduler_test._set_participant_to_error_state,
+        nullptr, job_execution_configuration);
+
+    std::atomic<int> running_executions{ 0 };
+    std::atomic<int> max_running_executions{ 0 };
+    ::test::helper::Notification called_max_time;
+    EXPECT_CALL(*my_job, execute(_)).WillRepeatedly(Invoke([&](fep3::Timestamp time)
+        {
+            const int running = ++running_executions;
+            if (running > max_running_executions)
+            {
+                max_running_executions = running;
+            }
+            std::this_thread::sleep_for(5ms);
+            --running_executions;
+            if (time >= fep3::Timestamp(200ms))
+            {
+                called_max_time.notify();
+            }
+            return fep3::Result{};
+        }));
+
+    ASSERT_FEP3_RESULT(scheduler.initialize(clock_service, jobs), fep3::ERR_NOERROR);
+    ASSERT_FEP3_RESULT(scheduler.start(), fep3::ERR_NOERROR);
+
+    scheduler_event_sink.lock()->timeResetBegin(Timestamp(0), Timestamp(0));
+    scheduler_event_sink.lock()->timeResetEnd(Timestamp(0));
+
+    // every time jump wakes up the job several times at once
+    for (auto time = 50ms; time <= 200ms; time += 50ms)
+    {
+        clock_service.setCurrentTime(time);
+        std::this_thread::sleep_for(1ms);
+    }
+    ASSERT_TRUE(called_max_time.waitForNotificationWithTimeout(std::chrono::seconds(1)));
+
+    scheduler.stop();
+    scheduler.deinitialize();
+
+    EXPECT_EQ(max_running_executions, 1);
+}
+
+/**
+* @brief Jobs due at the same instant of a discrete clock are executed in parallel if enabled.
+* A job depending on other jobs due at the same instant is executed after these jobs finished.
+*/
+TEST_F(ClockBasedSchedulerDiscrete, ParallelJobExecution)
+{
+    const auto max_time = 50ms;
+    const auto job_cycle_time = 10ms;
+
+    std::atomic<int32_t> running_jobs{ 0 };
+    std::atomic<int32_t> max_running_jobs{ 0 };
+    std::atomic<int32_t> finished_dependencies{ 0 };
+    std::atomic<int32_t> dependency_violations{ 0 };
+
+    const auto execute_dependency = [&](fep3::Timestamp)
+    {
+        const auto running = ++running_jobs;
+        auto max_running = max_running_jobs.load();
+        while (running > max_running && !max_running_jobs.compare_exchange_weak(max_running, running))
+        {
+        }
+        std::this_thread::sleep_for(5ms);
+        --running_jobs;
+        ++finished_dependencies;
+        return fep3::Result{};
+    };
+    const auto execute_dependent = [&](fep3::Timestamp)
+    {
+        if (running_jobs != 0 || finished_dependencies.exchange(0) != 2)
+        {
+            ++dependency_violations;
+        }
+        return fep3::Result{};
+    };
+
+    fep3::Jobs jobs;
+    std::vector<std::shared_ptr<NiceMock<fep3::mock::core::Job>>> my_jobs;
+    const std::vector<std::pair<std::string, std::vector<std::string>>> job_dependencies
+        = { { "my_job_1", {} }, { "my_job_2", {} }, { "my_job_3", { "my_job_1", "my_job_2" } } };
+    for (const auto& job_dependency : job_dependencies)
+    {
+        const fep3::JobConfiguration job_configuration(duration_cast<fep3::Duration>(job_cycle_time),
+            Duration(0),
+            {},
+            fep3::JobConfiguration::TimeViolationStrategy::ignore_runtime_violation,
+            job_dependency.second);
+        auto my_job = std::make_shared<NiceMock<fep3::mock::core::Job>>(job_dependency.first,
+            duration_cast<fep3::Duration>(job_cycle_time));
+        my_job->setDefaultBehaviour();
+        if (job_dependency.second.empty())
+        {
+            EXPECT_CALL(*my_job, execute(_)).Times(6).WillRepeatedly(Invoke(execute_dependency));
+        }
+        else
+        {
+            EXPECT_CALL(*my_job, execute(_)).Times(6).WillRepeatedly(Invoke(execute_dependent));
+        }
+        jobs.emplace(job_dependency.first, fep3::JobEntry{ my_job, fep3::JobInfo(job_dependency.first, job_configuration) });
+        my_jobs.push_back(my_job);
+    }
+
+    const auto job_execution_configuration = std::make_shared<fep3::native::JobExecutionConfiguration>();
+    job_execution_configuration->_parallel_job_execution = true;
+    fep3::native::LocalClockBasedScheduler scheduler(scheduler_test._logger, scheduler_test._set_participant_to_error_state,
+        nullptr, job_execution_configuration);
+
+    ASSERT_FEP3_RESULT(scheduler.initialize(clock_service, jobs), fep3::ERR_NOERROR);
+    ASSERT_FEP3_RESULT(scheduler.start(), fep3::ERR_NOERROR);
+
+    scheduler_event_sink.lock()->timeResetBegin(Timestamp(0), Timestamp(0));
+    scheduler_event_sink.lock()->timeResetEnd(Timestamp(0));
+
+    auto time = Timestamp(0);
+    while (time < max_time)
+    {
+        time += job_cycle_time;
+        scheduler_event_sink.lock()->timeUpdating(time);
+    }
+
+    scheduler.stop();
+    scheduler.deinitialize();
+
+    EXPECT_EQ(max_running_jobs.load(), 2);
+    EXPECT_EQ(dependency_violations.load(), 0);
+}
@@ -0,0 +1,383 @@
+/**
+* @file
+* Copyright &copy; AUDI AG. All rights reserved.
+*
+* This Source Code Form is subject to the terms of the
+* Mozilla Public License, v. 2.0.
+* If a copy of the MPL was not distributed with this
+* file, You can obtain one at https://mozilla.org/MPL/2.0/.
+*
+*/
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <common/gtest_asserts.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include <fep3/native_components/scheduler/data_flow/local_data_flow_scheduler.h>
+#include <fep3/components/job_registry/job_info.h>
+#include <fep3/components/clock/mock/mock_clock_service.h>
+#include <fep3/core/mock/mock_core.h>
+#include <fep3/base/sample/data_sample.h>
+#include <fep3/base/streamtype/default_streamtype.h>
+#include <fep3/components/base/component_registry.h>
+#include <fep3/native_components/configuration/configuration_service.h>
+#include <fep3/native_components/data_registry/data_registry.h>
+#include <fep3/native_components/service_bus/service_bus.h>
+#include <fep3/native_components/service_bus/testing/service_bus_testing.hpp>
+#include <fep3/native_components/simulation_bus/simulation_bus.h>
+
+#include <testenvs/scheduler_envs.h>
+
+using namespace ::testing;
+using namespace std::chrono;
+using namespace std::chrono_literals;
+using namespace fep3::test;
+using namespace fep3;
+
+using JobMock = NiceMock<fep3::mock::core::Job>;
+
+namespace
+{
+
+fep3::native::DataFlowGraph::JobNode makeJobNode(const std::string& name,
+    fep3::IJob& job,
+    const std::shared_ptr<const fep3::ILoggingService::ILogger>& logger,
+    std::vector<std::string> input_signals,
+    std::vector<std::string> output_signals,
+    std::vector<std::string> jobs_this_depends_on = {})
+{
+    return { name,
+        &job,
+        fep3::native::JobRunner(name,
+            fep3::JobConfiguration::TimeViolationStrategy::ignore_runtime_violation,
+            {},
+            logger),
+        std::move(input_signals),
+        std::move(output_signals),
+        std::move(jobs_this_depends_on) };
+}
+
+// Records the time of the last sample received
+struct SampleTimeReceiver : public fep3::IDataRegistry::IDataReceiver
+{
+    void operator()(const fep3::data_read_ptr<const fep3::IStreamType>&) override
+    {
+    }
+    void operator()(const fep3::data_read_ptr<const fep3::IDataSample>& sample) override
+    {
+        _sample_time = sample->getTime();
+    }
+
+    fep3::Optional<fep3::Timestamp> _sample_time;
+};
+
+// Never delivers the data, records the timeouts it is waited for with
+struct UndeliveringDataRegistry : public fep3::native::IDeliveryTrackingDataRegistry
+{
+    fep3::Result waitForDelivery(const std::string& signal_name, std::chrono::nanoseconds timeout) override
+    {
+        std::this_thread::sleep_for(timeout);
+        std::lock_guard<std::mutex> lock(_mutex);
+        _timeouts.push_back(timeout);
+        RETURN_ERROR_DESCRIPTION(fep3::ERR_TIMEOUT, "%s not delivered", signal_name.c_str());
+    }
+
+    std::mutex _mutex;
+    std::vector<std::chrono::nanoseconds> _timeouts;
+};
+
+} // namespace
+
+struct DataFlowScheduler : public ::testing::Test
+{
+    void SetUp() override
+    {
+        EXPECT_CALL(clock_service, registerEventSink(_))
+            .WillOnce(Invoke([this](const std::weak_ptr<IClock::IEventSink>& event_sink)
+            {
+                scheduler_event_sink = event_sink;
+                return fep3::Result{};
+            }));
+        EXPECT_CALL(clock_service, getType()).WillRepeatedly(Return(fep3::IClock::ClockType::discrete));
+    }
+
+    NiceMock<fep3::mock::DiscreteSteppingClockService> clock_service;
+    std::weak_ptr<fep3::IClock::IEventSink> scheduler_event_sink;
+    env::SchedulerTestEnv scheduler_test;
+};
+
+/**
+* @brief The dependencies of a job are derived from the writers of its input signals and its explicit dependencies,
+* a dependency closing a cycle is dropped and logged
+*/
+TEST(DataFlowGraph, buildsAcyclicGraph)
+{
+    env::SchedulerTestEnv scheduler_test;
+    JobMock job("job", Duration(10ms));
+    fep3::native::JobWorkerPool worker_pool(1);
+    fep3::native::DataFlowGraph graph(scheduler_test._logger, worker_pool);
+
+    EXPECT_CALL(*scheduler_test._logger, isWarningEnabled()).WillRepeatedly(Return(true));
+    EXPECT_CALL(*scheduler_test._logger, logWarning(HasSubstr("closes a cycle"))).WillOnce(Return(fep3::Result{}));
+
+    std::vector<fep3::native::DataFlowGraph::JobNode> jobs;
+    // sink <- filter <- source, control depends on sink explicitly and writes the input of source
+    jobs.push_back(makeJobNode("control", job, scheduler_test._logger, {}, { "control_signal" }, { "sink" }));
+    jobs.push_back(makeJobNode("filter", job, scheduler_test._logger, { "raw_signal" }, { "filtered_signal" }));
+    jobs.push_back(makeJobNode("sink", job, scheduler_test._logger, { "filtered_signal", "unknown_signal" }, {}));
+    jobs.push_back(makeJobNode("source", job, scheduler_test._logger, { "control_signal", "raw_signal" }, { "raw_signal" }));
+    graph.build(std::move(jobs));
+
+    // the cycle control -> sink -> filter -> source -> control is broken at the dependency of source on control
+    EXPECT_EQ(graph.getDependencies(0), std::vector<std::string>{ "sink" });
+    EXPECT_EQ(graph.getDependencies(1), std::vector<std::string>{ "source" });
+    EXPECT_EQ(graph.getDependencies(2), std::vector<std::string>{ "filter" });
+    EXPECT_EQ(graph.getDependencies(3), std::vector<std::string>{});
+
+    EXPECT_EQ(graph.getTopologicalOrder(), (std::vector<size_t>{ 3, 1, 2, 0 }));
+}
+
+/**
+* @brief The data delivery of all signals written by one job execution is waited for with one deadline,
+* so a job writing several signals read by its successors delays them by the delivery timeout at most
+*/
+TEST(DataFlowGraph, sharesDeliveryTimeoutBetweenSignals)
+{
+    env::SchedulerTestEnv scheduler_test;
+    JobMock job("job", Duration(10ms));
+    job.setDefaultBehaviour();
+    fep3::native::JobWorkerPool worker_pool(1);
+    UndeliveringDataRegistry data_registry;
+    fep3::native::DataFlowGraph graph(scheduler_test._logger, worker_pool, &data_registry);
+
+    EXPECT_CALL(*scheduler_test._logger, isWarningEnabled()).WillRepeatedly(Return(true));
+    EXPECT_CALL(*scheduler_test._logger, logWarning(HasSubstr("not delivered"))).Times(3).WillRepeatedly(Return(fep3::Result{}));
+
+    std::vector<fep3::native::DataFlowGraph::JobNode> jobs;
+    jobs.push_back(makeJobNode("source", job, scheduler_test._logger, {}, { "signal_1", "signal_2", "signal_3" }));
+    jobs.push_back(makeJobNode("sink", job, scheduler_test._logger, { "signal_1", "signal_2", "signal_3" }, {}));
+    graph.build(std::move(jobs));
+    graph.start();
+
+    std::promise<void> finished;
+    const auto begin = steady_clock::now();
+    graph.wakeUp(0, Timestamp(10ms), &finished);
+    ASSERT_EQ(finished.get_future().wait_for(5 * fep3::native::DataFlowGraph::data_delivery_timeout), std::future_status::ready);
+    const auto elapsed = steady_clock::now() - begin;
+    graph.stop();
+
+    EXPECT_LT(elapsed, 2 * fep3::native::DataFlowGraph::data_delivery_timeout);
+    std::lock_guard<std::mutex> lock(data_registry._mutex);
+    ASSERT_EQ(data_registry._timeouts.size(), 3u);
+    EXPECT_LE(data_registry._timeouts[0], fep3::native::DataFlowGraph::data_delivery_timeout);
+    EXPECT_EQ(data_registry._timeouts[1], nanoseconds(0));
+    EXPECT_EQ(data_registry._timeouts[2], nanoseconds(0));
+}
+
+/**
+* @brief A pipeline of jobs exchanging data is executed within one step of a discrete clock,
+* every stage after the stage it reads from, while an independent job is executed in parallel
+*/
+TEST_F(DataFlowScheduler, executesPipelineWithinOneStep)
+{
+    const auto max_time = 50ms;
+    const auto job_cycle_time = 10ms;
+
+    std::mutex executions_mutex;
+    std::vector<std::pair<std::string, fep3::Timestamp>> executions;
+    std::atomic<int32_t> running_jobs{ 0 };
+    std::atomic<int32_t> max_running_jobs{ 0 };
+
+    const auto makeExecute = [&](const std::string& name)
+    {
+        return [&, name](fep3::Timestamp time)
+        {
+            const auto running = ++running_jobs;
+            auto max_running = max_running_jobs.load();
+            while (running > max_running && !max_running_jobs.compare_exchange_weak(max_running, running))
+            {
+            }
+            std::this_thread::sleep_for(2ms);
+            {
+                std::lock_guard<std::mutex> lock(executions_mutex);
+                executions.emplace_back(name, time);
+            }
+            --running_jobs;
+            return fep3::Result{};
+        };
+    };
+
+    fep3::Jobs jobs;
+    std::vector<std::shared_ptr<JobMock>> my_jobs;
+    const auto addJob = [&](const std::string& name,
+        std::vector<std::string> input_signals,
+        std::vector<std::string> output_signals)
+    {
+        const fep3::JobConfiguration job_configuration(duration_cast<fep3::Duration>(job_cycle_time),
+            Duration(0),
+            {},
+            fep3::JobConfiguration::TimeViolationStrategy::ignore_runtime_violation,
+            {},
+            {},
+            std::move(input_signals),
+            std::move(output_signals));
+        auto my_job = std::make_shared<JobMock>(name, duration_cast<fep3::Duration>(job_cycle_time));
+        my_job->setDefaultBehaviour();
+        EXPECT_CALL(*my_job, execute(_)).Times(6).WillRepeatedly(Invoke(makeExecute(name)));
+        jobs.emplace(name, fep3::JobEntry{ my_job, fep3::JobInfo(name, job_configuration) });
+        my_jobs.push_back(my_job);
+    };
+    addJob("stage_1", {}, { "signal_1" });
+    addJob("stage_2", { "signal_1" }, { "signal_2" });
+    addJob("stage_3", { "signal_2" }, { "signal_3" });
+    addJob("stage_4", { "signal_3" }, {});
+    addJob("independent", {}, {});
+
+    const auto job_execution_configuration = std::make_shared<fep3::native::JobExecutionConfiguration>();
+    job_execution_configuration->_job_worker_thread_count = 4;
+    fep3::native::LocalDataFlowScheduler scheduler(scheduler_test._logger, scheduler_test._set_participant_to_error_state,
+        nullptr, job_execution_configuration);
+    ASSERT_EQ(scheduler.getName(), FEP3_SCHEDULER_DATA_FLOW);
+
+    ASSERT_FEP3_NOERROR(scheduler.initialize(clock_service, jobs));
+    ASSERT_FEP3_NOERROR(scheduler.start());
+
+    scheduler_event_sink.lock()->timeResetBegin(Timestamp(0), Timestamp(0));
+    scheduler_event_sink.lock()->timeResetEnd(Timestamp(0));
+
+    auto time = Timestamp(0);
+    while (time < max_time)
+    {
+        time += job_cycle_time;
+        scheduler_event_sink.lock()->timeUpdating(time);
+    }
+
+    scheduler.stop();
+    ASSERT_FEP3_NOERROR(scheduler.deinitialize());
+
+    // every step finished before the next one started, so the stages of one step are executed one after another
+    const std::vector<std::string> pipeline = { "stage_1", "stage_2", "stage_3", "stage_4" };
+    std::map<int64_t, std::vector<std::string>> stages_per_step;
+    for (const auto& execution : executions)
+    {
+        if (execution.first != "independent")
+        {
+            stages_per_step[execution.second.count()].push_back(execution.first);
+        }
+    }
+    ASSERT_EQ(stages_per_step.size(), 6u);
+    for (const auto& step : stages_per_step)
+    {
+        EXPECT_EQ(step.second, pipeline) << "at time " << step.first;
+    }
+    EXPECT_EQ(max_running_jobs.load(), 2);
+}
+
+/**
+* @brief A sample written by a job through the native data registry is read by the job depending on it
+* within the same step, although the receive thread of the data registry passes it to the reader
+*/
+TEST_F(DataFlowScheduler, successorReadsSampleOfSameStep)
+{
+    const auto max_time = 50ms;
+    const auto job_cycle_time = 10ms;
+
+    auto service_bus = std::make_shared<fep3::native::ServiceBus>();
+    auto data_registry = std::make_shared<fep3::native::DataRegistry>();
+    fep3::ComponentRegistry component_registry;
+    ASSERT_TRUE(fep3::native::testing::prepareServiceBusForTestingDefault(*service_bus,
+        "test_data_flow_scheduler",
+        "http://localhost:9927"));
+    ASSERT_FEP3_NOERROR(component_registry.registerComponent<fep3::IServiceBus>(service_bus));
+    ASSERT_FEP3_NOERROR(component_registry.registerComponent<fep3::IConfigurationService>(
+        std::make_shared<fep3::native::ConfigurationService>()));
+    ASSERT_FEP3_NOERROR(component_registry.registerComponent<fep3::ISimulationBus>(
+        std::make_shared<fep3::native::SimulationBus>()));
+    ASSERT_FEP3_NOERROR(component_registry.registerComponent<fep3::IDataRegistry>(data_registry));
+    ASSERT_FEP3_NOERROR(component_registry.create());
+    ASSERT_FEP3_NOERROR(component_registry.initialize());
+
+    ASSERT_FEP3_NOERROR(data_registry->registerDataOut("signal", fep3::StreamTypeRaw()));
+    ASSERT_FEP3_NOERROR(data_registry->registerDataIn("signal", fep3::StreamTypeRaw()));
+    auto writer = data_registry->getWriter("signal");
+    auto reader = data_registry->getReader("signal");
+    ASSERT_TRUE(writer);
+    ASSERT_TRUE(reader);
+    ASSERT_FEP3_NOERROR(component_registry.tense());
+    ASSERT_FEP3_NOERROR(component_registry.start());
+
+    std::mutex received_mutex;
+    std::vector<std::pair<fep3::Timestamp, fep3::Optional<fep3::Timestamp>>> received_sample_times;
+
+    fep3::Jobs jobs;
+    const auto addJob = [&](const std::string& name,
+        std::vector<std::string> input_signals,
+        std::vector<std::string> output_signals,
+        std::function<fep3::Result(fep3::Timestamp)> execute)
+    {
+        const fep3::JobConfiguration job_configuration(duration_cast<fep3::Duration>(job_cycle_time),
+            Duration(0),
+            {},
+            fep3::JobConfiguration::TimeViolationStrategy::ignore_runtime_violation,
+            {},
+            {},
+            std::move(input_signals),
+            std::move(output_signals));
+        auto my_job = std::make_shared<JobMock>(name, duration_cast<fep3::Duration>(job_cycle_time));
+        my_job->setDefaultBehaviour();
+        EXPECT_CALL(*my_job, execute(_)).Times(6).WillRepeatedly(Invoke(execute));
+        jobs.emplace(name, fep3::JobEntry{ my_job, fep3::JobInfo(name, job_configuration) });
+    };
+    addJob("producer", {}, { "signal" }, [&writer](fep3::Timestamp time)
+    {
+        fep3::DataSample sample;
+        sample.setTime(time);
+        FEP3_RETURN_IF_FAILED(writer->write(sample));
+        return writer->flush();
+    });
+    addJob("consumer", { "signal" }, {}, [&](fep3::Timestamp time)
+    {
+        SampleTimeReceiver receiver;
+        reader->pop(receiver);
+        std::lock_guard<std::mutex> lock(received_mutex);
+        received_sample_times.emplace_back(time, receiver._sample_time);
+        return fep3::Result{};
+    });
+
+    const auto job_execution_configuration = std::make_shared<fep3::native::JobExecutionConfiguration>();
+    job_execution_configuration->_job_worker_thread_count = 2;
+    fep3::native::LocalDataFlowScheduler scheduler(scheduler_test._logger, scheduler_test._set_participant_to_error_state,
+        nullptr, job_execution_configuration, data_registry.get());
+
+    ASSERT_FEP3_NOERROR(scheduler.initialize(clock_service, jobs));
+    ASSERT_FEP3_NOERROR(scheduler.start());
+
+    scheduler_event_sink.lock()->timeResetBegin(Timestamp(0), Timestamp(0));
+    scheduler_event_sink.lock()->timeResetEnd(Timestamp(0));
+
+    auto time = Timestamp(0);
+    while (time < max_time)
+    {
+        time += job_cycle_time;
+        scheduler_event_sink.lock()->timeUpdating(time);
+    }
+
+    scheduler.stop();
+    ASSERT_FEP3_NOERROR(scheduler.deinitialize());
+
+    EXPECT_FEP3_NOERROR(component_registry.stop());
+    EXPECT_FEP3_NOERROR(component_registry.relax());
+    EXPECT_FEP3_NOERROR(component_registry.deinitialize());
+
+    ASSERT_EQ(received_sample_times.size(), 6u);
+    for (const auto& received_sample_time : received_sample_times)
+    {
+        ASSERT_TRUE(received_sample_time.second.has_value()) << "no sample at time " << received_sample_time.first.count();
+        EXPECT_EQ(received_sample_time.second.value(), received_sample_time.first);
+    }
+}
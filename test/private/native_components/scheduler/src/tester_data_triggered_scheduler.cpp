@@ -0,0 +1,137 @@
+/**
+* @file
+* Copyright &copy; AUDI AG. All rights reserved.
+*
+* This Source Code Form is subject to the terms of the
+* Mozilla Public License, v. 2.0.
+* If a copy of the MPL was not distributed with this
+* file, You can obtain one at https://mozilla.org/MPL/2.0/.
+*
+*/
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <common/gtest_asserts.h>
+#include <chrono>
+#include <thread>
+
+#include <fep3/native_components/scheduler/data_triggered/local_data_triggered_scheduler.h>
+#include <fep3/components/job_registry/job_info.h>
+#include <fep3/components/clock/mock/mock_clock_service.h>
+#include <fep3/components/data_registry/mock/mock_data_registry.h>
+#include <fep3/core/mock/mock_core.h>
+#include <fep3/base/sample/data_sample.h>
+#include <fep3/base/streamtype/default_streamtype.h>
+
+#include <testenvs/scheduler_envs.h>
+#include <helper/gmock_async_helper.h>
+
+using namespace ::testing;
+using namespace std::chrono_literals;
+using namespace fep3::test;
+using namespace fep3;
+
+using ClockServiceMock = NiceMock<fep3::mock::ClockServiceComponentWithDefaultBehaviour>;
+using DataRegistryMock = StrictMock<fep3::mock::DataRegistryComponent>;
+using JobMock = NiceMock<fep3::mock::core::Job>;
+
+ACTION_P(Notify, notification)
+{
+    notification->notify();
+}
+
+struct DataTriggeredScheduler : public ::testing::Test
+{
+    DataTriggeredScheduler()
+        : _job(std::make_shared<JobMock>("triggered_job", Duration(10ms)))
+        , _scheduler(_scheduler_test._logger, _scheduler_test._set_participant_to_error_state, _data_registry)
+    {
+        _job->setDefaultBehaviour();
+        ON_CALL(_clock_service, getType()).WillByDefault(Return(fep3::IClock::ClockType::continuous));
+    }
+
+    fep3::Jobs makeJobs(const std::vector<std::string>& trigger_signals) const
+    {
+        const fep3::JobConfiguration job_configuration(Duration(10ms),
+            Duration(0),
+            {},
+            fep3::JobConfiguration::TimeViolationStrategy::ignore_runtime_violation,
+            {},
+            trigger_signals);
+        return fep3::Jobs{ { "triggered_job", { _job, fep3::JobInfo("triggered_job", job_configuration) } } };
+    }
+
+    ClockServiceMock _clock_service;
+    DataRegistryMock _data_registry;
+    env::SchedulerTestEnv _scheduler_test;
+    std::shared_ptr<JobMock> _job;
+    fep3::native::LocalDataTriggeredScheduler _scheduler;
+};
+
+/**
+* @brief A job with a trigger signal is executed as soon as a sample of this signal is received,
+* a received stream type does not trigger the job
+*/
+TEST_F(DataTriggeredScheduler, executesJobOnReceivedSample)
+{
+    std::shared_ptr<IDataRegistry::IDataReceiver> listener;
+    EXPECT_CALL(_data_registry, registerDataReceiveListener("trigger_signal", _))
+        .WillOnce(DoAll(SaveArg<1>(&listener), Return(fep3::Result{})));
+
+    ASSERT_FEP3_NOERROR(_scheduler.initialize(_clock_service, makeJobs({ "trigger_signal" })));
+    ASSERT_TRUE(listener);
+    ASSERT_FEP3_NOERROR(_scheduler.start());
+
+    ::test::helper::Notification called;
+    ON_CALL(_clock_service, getTime()).WillByDefault(Return(Timestamp(42ms)));
+    EXPECT_CALL(*_job, execute(Timestamp(42ms))).WillOnce(DoAll(Notify(&called), Return(fep3::ERR_NOERROR)));
+
+    (*listener)(data_read_ptr<const IStreamType>(std::make_shared<StreamTypePlain<uint32_t>>()));
+    (*listener)(data_read_ptr<const IDataSample>(std::make_shared<DataSample>()));
+    ASSERT_TRUE(called.waitForNotificationWithTimeout(std::chrono::seconds(1)));
+
+    ASSERT_FEP3_NOERROR(_scheduler.stop());
+
+    EXPECT_CALL(_data_registry, unregisterDataReceiveListener("trigger_signal", listener))
+        .WillOnce(Return(fep3::Result{}));
+    ASSERT_FEP3_NOERROR(_scheduler.deinitialize());
+}
+
+/**
+* @brief Samples received while the scheduler is stopped do not trigger the job
+*/
+TEST_F(DataTriggeredScheduler, ignoresSamplesWhileStopped)
+{
+    std::shared_ptr<IDataRegistry::IDataReceiver> listener;
+    EXPECT_CALL(_data_registry, registerDataReceiveListener("trigger_signal", _))
+        .WillOnce(DoAll(SaveArg<1>(&listener), Return(fep3::Result{})));
+    EXPECT_CALL(*_job, execute(_)).Times(0);
+
+    ASSERT_FEP3_NOERROR(_scheduler.initialize(_clock_service, makeJobs({ "trigger_signal" })));
+    ASSERT_TRUE(listener);
+    (*listener)(data_read_ptr<const IDataSample>(std::make_shared<DataSample>()));
+
+    ASSERT_FEP3_NOERROR(_scheduler.start());
+    std::this_thread::sleep_for(10ms);
+    ASSERT_FEP3_NOERROR(_scheduler.stop());
+
+    EXPECT_CALL(_data_registry, unregisterDataReceiveListener("trigger_signal", listener))
+        .WillOnce(Return(fep3::Result{}));
+    ASSERT_FEP3_NOERROR(_scheduler.deinitialize());
+}
+
+/**
+* @brief Initialization fails if a trigger signal is not registered at the data registry
+* and the listeners registered so far are unregistered again
+*/
+TEST_F(DataTriggeredScheduler, failsForUnknownTriggerSignal)
+{
+    EXPECT_CALL(_data_registry, registerDataReceiveListener("trigger_signal", _))
+        .WillOnce(Return(fep3::Result{}));
+    EXPECT_CALL(_data_registry, registerDataReceiveListener("unknown_signal", _))
+        .WillOnce(Return(fep3::ERR_NOT_FOUND));
+    EXPECT_CALL(_data_registry, unregisterDataReceiveListener("trigger_signal", _))
+        .WillOnce(Return(fep3::Result{}));
+
+    ASSERT_FEP3_RESULT(_scheduler.initialize(_clock_service, makeJobs({ "trigger_signal", "unknown_signal" })),
+        fep3::ERR_NOT_FOUND);
+}
@@ -17,6 +17,7 @@
 #include <fep3/components/job_registry/mock/mock_job.h>
 #include <fep3/components/job_registry/mock/mock_job_registry.h>
 #include <fep3/components/logging/mock/mock_logging_service.h>
+#include <fep3/components/clock/mock/mock_clock_service.h>
 #include <helper/job_registry_helper.h>
 #include <fep3/fep3_duration.h>
 
@@ -296,4 +297,44 @@ TEST(JobRunner, RuntimeViolationSkipPublish)
         
         ASSERT_EQ(runtime_checker->runJob(2ms, my_job), a_util::result::Result());      
     }
-}
\ No newline at end of file
+}
+
+/**
+* @brief Tests that the runtimes, the wakeup jitter, overruns and skipped outputs are recorded to the job statistics
+*/
+TEST(JobRunner, RecordsStatistics)
+{
+    auto max_runtime = 1ms;
+    auto actual_runtime = 10ms;
+
+    RuntimeJobEnv runtime_job_env;
+    NiceMock<fep3::mock::Job> my_job{};
+    NiceMock<fep3::mock::ClockService<>> clock_service{};
+    ON_CALL(clock_service, getTime()).WillByDefault(Return(fep3::Timestamp(5ms)));
+
+    auto statistics = std::make_shared<fep3::native::JobStatistics>();
+
+    // actual test
+    {
+        fep3::native::JobRunner runtime_checker("my_runtime_checker", Strategy::skip_output_publish, max_runtime,
+            runtime_job_env._logger, runtime_job_env._set_participant_to_error_state, statistics, &clock_service);
+
+        ASSERT_FEP3_NOERROR(runtime_checker.runJob(2ms, my_job));
+
+        EXPECT_CALL(my_job, execute(_)).WillOnce(
+            InvokeWithoutArgs([&actual_runtime](){ std::this_thread::sleep_for(actual_runtime); return ::fep3::Result{}; }) );
+        ASSERT_FEP3_NOERROR(runtime_checker.runJob(4ms, my_job));
+
+        const auto snapshot = statistics->getSnapshot();
+        EXPECT_EQ(snapshot.execute.count, 2u);
+        EXPECT_GE(snapshot.execute.max, fep3::Duration(actual_runtime).count());
+        EXPECT_EQ(snapshot.data_in.count, 2u);
+        // the output of the second run was skipped
+        EXPECT_EQ(snapshot.data_out.count, 1u);
+        EXPECT_EQ(snapshot.overrun_count, 1u);
+        EXPECT_EQ(snapshot.skipped_output_count, 1u);
+        EXPECT_EQ(snapshot.wakeup_jitter.count, 2u);
+        EXPECT_EQ(snapshot.wakeup_jitter.min, fep3::Duration(1ms).count());
+        EXPECT_EQ(snapshot.wakeup_jitter.max, fep3::Duration(3ms).count());
+    }
+}
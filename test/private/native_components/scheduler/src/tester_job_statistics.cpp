@@ -0,0 +1,132 @@
+/**
+* @file
+* Copyright &copy; AUDI AG. All rights reserved.
+*
+* This Source Code Form is subject to the terms of the
+* Mozilla Public License, v. 2.0.
+* If a copy of the MPL was not distributed with this
+* file, You can obtain one at https://mozilla.org/MPL/2.0/.
+*
+*/
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include <fep3/native_components/scheduler/job_statistics.h>
+
+using namespace std::chrono_literals;
+using namespace fep3::native;
+
+/**
+* @brief Tests the values of a histogram with exactly counted durations
+*/
+TEST(DurationHistogram, ExactValues)
+{
+    DurationHistogram histogram;
+    for (int64_t value = 1; value <= 50; ++value)
+    {
+        histogram.record(std::chrono::nanoseconds(value));
+    }
+
+    const auto snapshot = histogram.getSnapshot();
+    EXPECT_EQ(snapshot.count, 50u);
+    EXPECT_EQ(snapshot.min, 1);
+    EXPECT_EQ(snapshot.max, 50);
+    EXPECT_EQ(snapshot.mean, 25);
+    EXPECT_EQ(snapshot.p50, 25);
+    EXPECT_EQ(snapshot.p90, 45);
+    EXPECT_EQ(snapshot.p99, 50);
+}
+
+/**
+* @brief Tests that large durations are reported with a bounded relative error
+*/
+TEST(DurationHistogram, RelativeError)
+{
+    DurationHistogram histogram;
+    for (int value = 1; value <= 1000; ++value)
+    {
+        histogram.record(std::chrono::microseconds(value));
+    }
+
+    const auto snapshot = histogram.getSnapshot();
+    EXPECT_EQ(snapshot.count, 1000u);
+    EXPECT_EQ(snapshot.min, 1000);
+    EXPECT_EQ(snapshot.max, 1000000);
+    EXPECT_NEAR(snapshot.p50, 500000, 500000 / 32);
+    EXPECT_NEAR(snapshot.p90, 900000, 900000 / 32);
+    EXPECT_NEAR(snapshot.p99, 990000, 990000 / 32);
+
+    // durations beyond the range of the buckets still have their exact maximum
+    histogram.record(std::chrono::hours(10));
+    EXPECT_EQ(histogram.getSnapshot().max, std::chrono::nanoseconds(std::chrono::hours(10)).count());
+}
+
+/**
+* @brief Tests that a reset histogram is empty and negative durations are counted as 0
+*/
+TEST(DurationHistogram, ResetAndNegative)
+{
+    DurationHistogram histogram;
+    histogram.record(-5ms);
+    auto snapshot = histogram.getSnapshot();
+    EXPECT_EQ(snapshot.count, 1u);
+    EXPECT_EQ(snapshot.max, 0);
+
+    histogram.reset();
+    snapshot = histogram.getSnapshot();
+    EXPECT_EQ(snapshot.count, 0u);
+    EXPECT_EQ(snapshot.min, 0);
+    EXPECT_EQ(snapshot.max, 0);
+    EXPECT_EQ(snapshot.p99, 0);
+
+    histogram.record(3ms);
+    snapshot = histogram.getSnapshot();
+    EXPECT_EQ(snapshot.min, std::chrono::nanoseconds(3ms).count());
+}
+
+/**
+* @brief Tests recording from several threads while the statistics are read
+*/
+TEST(JobStatistics, ConcurrentRecording)
+{
+    JobStatisticsRegistry registry;
+    const auto statistics = registry.getJobStatistics("job");
+    ASSERT_EQ(statistics, registry.getJobStatistics("job"));
+    ASSERT_FALSE(registry.findJobStatistics("other_job"));
+
+    constexpr int threads_count = 4;
+    constexpr int records_per_thread = 10000;
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_count; ++thread)
+    {
+        threads.emplace_back([&]()
+        {
+            for (int record = 0; record < records_per_thread; ++record)
+            {
+                statistics->recordExecute(std::chrono::nanoseconds(record));
+                statistics->recordOverrun();
+            }
+        });
+    }
+    for (int read = 0; read < 100; ++read)
+    {
+        registry.findJobStatistics("job")->getSnapshot();
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    auto snapshot = registry.findJobStatistics("job")->getSnapshot();
+    EXPECT_EQ(snapshot.execute.count, static_cast<uint64_t>(threads_count * records_per_thread));
+    EXPECT_EQ(snapshot.execute.max, records_per_thread - 1);
+    EXPECT_EQ(snapshot.overrun_count, static_cast<uint64_t>(threads_count * records_per_thread));
+    EXPECT_EQ(snapshot.data_in.count, 0u);
+
+    registry.reset();
+    snapshot = registry.findJobStatistics("job")->getSnapshot();
+    EXPECT_EQ(snapshot.execute.count, 0u);
+    EXPECT_EQ(snapshot.overrun_count, 0u);
+    EXPECT_EQ(registry.getJobNames(), std::vector<std::string>{ "job" });
+}
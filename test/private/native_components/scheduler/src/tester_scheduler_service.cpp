@@ -10,6 +10,7 @@
 */
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <algorithm>
 #include <common/gtest_asserts.h>
 
 #include <fep3/native_components/scheduler/local_scheduler_service.h>
@@ -167,6 +168,36 @@ TEST_F(SchedulerServiceWithSchedulerMock, IterateAllStates)
     ASSERT_FEP3_NOERROR(_component_registry->destroy());
 }
 
+/**
+* @detail Test that the native data flow scheduler is only registered on tense if it is selected
+* and unregistered again on destroy
+*/
+TEST_F(SchedulerServiceWithSchedulerMock, RegisterDataFlowSchedulerIfSelected)
+{
+    EXPECT_CALL(*_configuration_service_mock, unregisterNode(_)).Times(1).WillOnce(Return(fep3::Result{}));
+
+    auto scheduler_names = getSchedulerService()->getSchedulerNames();
+    ASSERT_EQ(std::find(scheduler_names.begin(), scheduler_names.end(), FEP3_SCHEDULER_DATA_FLOW), scheduler_names.end());
+
+    fep3::setPropertyValue<std::string>(*_scheduler_service_property_node->getChild(FEP3_SCHEDULER_PROPERTY), FEP3_SCHEDULER_DATA_FLOW);
+
+    ASSERT_FEP3_NOERROR(_component_registry->initialize());
+    ASSERT_FEP3_NOERROR(_component_registry->tense());
+    ASSERT_EQ(getSchedulerService()->getActiveSchedulerName(), FEP3_SCHEDULER_DATA_FLOW);
+    scheduler_names = getSchedulerService()->getSchedulerNames();
+    ASSERT_NE(std::find(scheduler_names.begin(), scheduler_names.end(), FEP3_SCHEDULER_DATA_FLOW), scheduler_names.end());
+
+    ASSERT_FEP3_NOERROR(_component_registry->start());
+
+    ASSERT_FEP3_NOERROR(_component_registry->stop());
+    ASSERT_FEP3_NOERROR(_component_registry->relax());
+    ASSERT_FEP3_NOERROR(_component_registry->deinitialize());
+    ASSERT_FEP3_NOERROR(_component_registry->destroy());
+
+    scheduler_names = getSchedulerService()->getSchedulerNames();
+    ASSERT_EQ(std::find(scheduler_names.begin(), scheduler_names.end(), FEP3_SCHEDULER_DATA_FLOW), scheduler_names.end());
+}
+
 /**
 * @detail While running the following actions are performed:
 * register, unregister, setActiveScheduler
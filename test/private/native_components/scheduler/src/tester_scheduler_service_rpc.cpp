@@ -11,7 +11,9 @@
 #include <gtest/gtest.h>
 
 #include "test_scheduler_service_client_stub.h"
+#include "test_job_statistics_client_stub.h"
 #include <fep3/rpc_services/scheduler_service/scheduler_service_rpc_intf_def.h>
+#include <fep3/rpc_services/job_statistics/job_statistics_rpc_intf_def.h>
 #include <fep3/components/service_bus/rpc/fep_rpc_stubs_client.h>
 #include "fep3/components/base/component_registry.h"
 #include "fep3/native_components/scheduler/local_scheduler_service.h"
@@ -51,6 +53,21 @@ public:
     }
 };
 
+class TestJobStatisticsClient : public rpc::RPCServiceClient<::test::rpc_stubs::TestJobStatisticsClientStub, rpc::IRPCJobStatisticsDef>
+{
+private:
+    typedef RPCServiceClient<TestJobStatisticsClientStub, rpc::IRPCJobStatisticsDef> base_type;
+
+public:
+    using base_type::GetStub;
+
+    TestJobStatisticsClient(const std::string& server_object_name,
+        const std::shared_ptr<rpc::IRPCRequester>& rpc_requester)
+        : base_type(server_object_name, rpc_requester)
+    {
+    }
+};
+
 struct NativeSchedulerServiceRPC : public Test
 {
     NativeSchedulerServiceRPC()
@@ -121,6 +138,22 @@ TEST_F(NativeSchedulerServiceRPC, testGetActiveSchedulerName)
     }
 }
 
+TEST_F(NativeSchedulerServiceRPC, testJobStatisticsWithoutJobs)
+{
+    TestJobStatisticsClient client(rpc::IRPCJobStatisticsDef::getRPCDefaultName(),
+        _service_bus->getRequester(native::testing::test_participant_name));
+
+    // actual test
+    {
+        ASSERT_EQ("", client.getJobNames());
+        const auto all_job_statistics = client.getAllJobStatistics();
+        ASSERT_TRUE(all_job_statistics.isArray());
+        ASSERT_EQ(0u, all_job_statistics.size());
+        ASSERT_EQ("", client.getJobStatistics("unknown_job")["job_name"].asString());
+        ASSERT_EQ(0, client.resetJobStatistics());
+    }
+}
+
 }
 }
 }
@@ -0,0 +1,159 @@
+/**
+* @file
+* Copyright &copy; AUDI AG. All rights reserved.
+*
+* This Source Code Form is subject to the terms of the
+* Mozilla Public License, v. 2.0.
+* If a copy of the MPL was not distributed with this
+* file, You can obtain one at https://mozilla.org/MPL/2.0/.
+*
+*/
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
+#include <fep3/base/thread/thread.h>
+
+using namespace fep3;
+
+namespace
+{
+
+/**
+ * Thread running until it is stopped, so it can be configured by the test.
+ */
+class RunningThread
+{
+public:
+    RunningThread()
+        : _thread([this]() { while (!_stop) { std::this_thread::yield(); } })
+    {
+    }
+    ~RunningThread()
+    {
+        _stop = true;
+        _thread.join();
+    }
+
+    std::thread& get()
+    {
+        return _thread;
+    }
+
+private:
+    std::atomic<bool> _stop{ false };
+    std::thread _thread;
+};
+
+} // namespace
+
+/**
+ * @detail Test that a complete thread configuration is parsed
+ */
+TEST(ThreadConfiguration, parseConfiguration)
+{
+    ThreadConfiguration configuration;
+    ASSERT_TRUE(isOk(thread::parseConfiguration(" cpus=3,0-1 ; policy=fifo; priority=80", configuration)));
+
+    EXPECT_EQ(configuration._cpu_affinity, (std::vector<uint32_t>{ 0, 1, 3 }));
+    EXPECT_EQ(configuration._scheduling_policy, ThreadConfiguration::SchedulingPolicy::fifo);
+    EXPECT_EQ(configuration._priority, 80);
+    EXPECT_FALSE(configuration.isDefault());
+}
+
+/**
+ * @detail Test that an empty string is the default configuration keeping the thread as it is
+ */
+TEST(ThreadConfiguration, parseEmptyConfiguration)
+{
+    ThreadConfiguration configuration;
+    configuration._cpu_affinity = { 1 };
+    ASSERT_TRUE(isOk(thread::parseConfiguration("", configuration)));
+
+    EXPECT_TRUE(configuration.isDefault());
+    EXPECT_EQ(configuration, ThreadConfiguration());
+}
+
+/**
+ * @detail Test that malformed and invalid configurations are rejected
+ */
+TEST(ThreadConfiguration, parseInvalidConfiguration)
+{
+    for (const auto& configuration_string : std::vector<std::string>{
+        "cpus=3-1",
+        "cpus=a",
+        "cpus=1-2-3",
+        "cpus=0-4294967295",
+        "cpus=4294967295",
+        "cpus=100000",
+        "policy=deadline",
+        "priority=-1",
+        "priority=10",
+        "policy=round_robin",
+        "policy=other;priority=10",
+        "affinity=1" })
+    {
+        ThreadConfiguration configuration;
+        EXPECT_EQ(thread::parseConfiguration(configuration_string, configuration).getErrorCode(), ResultType_ERR_INVALID_ARG::getCode())
+            << configuration_string;
+    }
+}
+
+/**
+ * @detail Test that a cpu list is parsed to unique cpus in ascending order
+ */
+TEST(ThreadConfiguration, parseCpuList)
+{
+    std::vector<uint32_t> cpus;
+    ASSERT_TRUE(isOk(thread::parseCpuList("4, 2-3,3", cpus)));
+    EXPECT_EQ(cpus, (std::vector<uint32_t>{ 2, 3, 4 }));
+
+    ASSERT_TRUE(isOk(thread::parseCpuList("", cpus)));
+    EXPECT_TRUE(cpus.empty());
+}
+
+#ifdef __linux__
+
+/**
+ * @detail Test that configuring a thread names it (truncated to the length supported by Linux)
+ * and pins it to the configured cpus
+ */
+TEST(ThreadConfiguration, configureThread)
+{
+    RunningThread running_thread;
+
+    ThreadConfiguration configuration;
+    configuration._cpu_affinity = { 0 };
+    ASSERT_TRUE(isOk(thread::configure(running_thread.get(), "a_long_thread_name", configuration)));
+
+    char name[16] = {};
+    ASSERT_EQ(pthread_getname_np(running_thread.get().native_handle(), name, sizeof(name)), 0);
+    EXPECT_EQ(std::string(name), "a_long_thread_n");
+
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    ASSERT_EQ(pthread_getaffinity_np(running_thread.get().native_handle(), sizeof(cpu_set), &cpu_set), 0);
+    EXPECT_EQ(CPU_COUNT(&cpu_set), 1);
+    EXPECT_TRUE(CPU_ISSET(0, &cpu_set));
+}
+
+#endif // __linux__
+
+/**
+ * @detail Test that an invalid configuration is not applied
+ */
+TEST(ThreadConfiguration, configureThreadWithInvalidConfiguration)
+{
+    RunningThread running_thread;
+
+    ThreadConfiguration configuration;
+    configuration._scheduling_policy = ThreadConfiguration::SchedulingPolicy::fifo;
+    configuration._priority = 0;
+    EXPECT_EQ(thread::configure(running_thread.get(), "invalid", configuration).getErrorCode(), ResultType_ERR_INVALID_ARG::getCode());
+}
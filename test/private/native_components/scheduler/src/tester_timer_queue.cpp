@@ -0,0 +1,127 @@
+/**
+* @file
+* Copyright &copy; AUDI AG. All rights reserved.
+*
+* This Source Code Form is subject to the terms of the
+* Mozilla Public License, v. 2.0.
+* If a copy of the MPL was not distributed with this
+* file, You can obtain one at https://mozilla.org/MPL/2.0/.
+*
+*/
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include <fep3/native_components/scheduler/clock_based/timer_queue.h>
+
+using namespace std::chrono_literals;
+using namespace fep3;
+using namespace fep3::native;
+
+namespace
+{
+
+TimerInfo makeTimerInfo(const std::string& name, size_t index, Duration period = Duration(0))
+{
+    return { nullptr, period, name, {}, index };
+}
+
+std::vector<std::string> popAll(TimerQueue& queue)
+{
+    std::vector<std::string> names;
+    while (!queue.empty())
+    {
+        names.push_back(queue.top()._name);
+        queue.pop();
+    }
+    return names;
+}
+
+} // namespace
+
+/**
+* @brief Tests that the timers are ordered by their instant and timers due at the same instant by the order they were added in
+*/
+TEST(TimerQueue, Order)
+{
+    TimerQueue queue;
+    queue.push(makeTimerInfo("c", 0), Timestamp(30ms));
+    queue.push(makeTimerInfo("a2", 1), Timestamp(10ms));
+    queue.push(makeTimerInfo("b", 2), Timestamp(20ms));
+    queue.push(makeTimerInfo("a1", 3), Timestamp(10ms));
+    queue.push(makeTimerInfo("d", 4), Timestamp(40ms));
+    ASSERT_EQ(queue.size(), 5u);
+    EXPECT_EQ(queue.topInstant(), Timestamp(10ms));
+
+    EXPECT_EQ(popAll(queue), (std::vector<std::string>{ "a2", "a1", "b", "c", "d" }));
+}
+
+/**
+* @brief Tests rescheduling the next due timer like a periodic timer
+*/
+TEST(TimerQueue, RescheduleTop)
+{
+    TimerQueue queue;
+    queue.push(makeTimerInfo("fast", 0, Duration(10ms)), Timestamp(0));
+    queue.push(makeTimerInfo("slow", 1, Duration(25ms)), Timestamp(0));
+
+    std::vector<std::pair<std::string, Timestamp>> wakeups;
+    while (queue.topInstant() <= Timestamp(50ms))
+    {
+        wakeups.emplace_back(queue.top()._name, queue.topInstant());
+        queue.rescheduleTop(queue.topInstant() + queue.top()._period);
+    }
+
+    EXPECT_EQ(wakeups, (std::vector<std::pair<std::string, Timestamp>>{
+        { "fast", Timestamp(0) }, { "slow", Timestamp(0) },
+        { "fast", Timestamp(10ms) }, { "fast", Timestamp(20ms) },
+        { "slow", Timestamp(25ms) }, { "fast", Timestamp(30ms) },
+        { "fast", Timestamp(40ms) }, { "fast", Timestamp(50ms) }, { "slow", Timestamp(50ms) } }));
+}
+
+/**
+* @brief Tests removing timers from the middle and the top of the queue
+*/
+TEST(TimerQueue, Remove)
+{
+    std::vector<int> timers(6);
+    TimerQueue queue;
+    for (size_t index = 0; index < timers.size(); ++index)
+    {
+        TimerInfo timer_info = makeTimerInfo(std::to_string(index), index);
+        timer_info._timer = reinterpret_cast<ITimer*>(&timers[index]);
+        queue.push(timer_info, Timestamp(std::chrono::milliseconds(10 * (timers.size() - index))));
+    }
+
+    EXPECT_TRUE(queue.remove(reinterpret_cast<ITimer*>(&timers[2])));
+    EXPECT_TRUE(queue.remove(reinterpret_cast<ITimer*>(&timers[5])));
+    EXPECT_FALSE(queue.remove(reinterpret_cast<ITimer*>(&timers[5])));
+
+    EXPECT_EQ(popAll(queue), (std::vector<std::string>{ "4", "3", "1", "0" }));
+}
+
+/**
+* @brief Tests that shifting the queue moves the instants of all timers
+*/
+TEST(TimerQueue, Shift)
+{
+    TimerQueue queue;
+    queue.push(makeTimerInfo("a", 0), Timestamp(10ms));
+    queue.shift(Duration(100ms));
+    queue.push(makeTimerInfo("b", 1), Timestamp(50ms));
+
+    EXPECT_EQ(queue.topInstant(), Timestamp(50ms));
+    queue.pop();
+    EXPECT_EQ(queue.topInstant(), Timestamp(110ms));
+
+    queue.shift(Duration(-110ms));
+    EXPECT_EQ(queue.topInstant(), Timestamp(0));
+
+    size_t count = 0;
+    queue.forEach([&count](const TimerInfo& timer_info)
+    {
+        EXPECT_EQ(timer_info._name, "a");
+        ++count;
+    });
+    EXPECT_EQ(count, 1u);
+}
@@ -11,8 +11,11 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <common/gtest_asserts.h>
-#include <thread>
+#include <condition_variable>
 #include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include <fep3/native_components/scheduler/clock_based/timer_scheduler_impl.h>
 #include <fep3/native_components/scheduler/clock_based/local_clock_based_scheduler.h>
@@ -240,4 +243,82 @@ TEST_F(TimerSchedulerFixture, ExecuteOneJobDiscrete)
 
         timer_scheduler->stop();
     }
-}
\ No newline at end of file
+}
+/**
+* @brief Timer recording the times it is woken up at
+*/
+struct RecordingTimer : public ITimer
+{
+    fep3::Result wakeUp(Timestamp wakeup_time, std::promise<void>* finished = nullptr) override
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _wakeup_times.push_back(wakeup_time);
+        }
+        _cv_wakeup.notify_all();
+        if (finished)
+        {
+            finished->set_value();
+        }
+        return {};
+    }
+
+    fep3::Result reset() override
+    {
+        return {};
+    }
+
+    bool waitForWakeUps(size_t count, Duration timeout)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        return _cv_wakeup.wait_for(lock, timeout, [&]() { return _wakeup_times.size() >= count; });
+    }
+
+    std::vector<Timestamp> getWakeUpTimes()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _wakeup_times;
+    }
+
+    std::mutex _mutex;
+    std::condition_variable _cv_wakeup;
+    std::vector<Timestamp> _wakeup_times;
+};
+
+/**
+* @brief A periodic timer of a continuous clock which is due several times at once is woken up only once
+* with the current time, the missed instants are skipped
+*/
+TEST(TimerScheduler, ContinuousSkipsMissedPeriods)
+{
+    NiceMock<fep3::mock::DiscreteSteppingClockService> clock_service;
+    EXPECT_CALL(clock_service, getType()).WillRepeatedly(Return(fep3::IClock::ClockType::continuous));
+
+    auto timer_scheduler = std::make_shared<TimerScheduler>(clock_service);
+    RecordingTimer timer;
+    ASSERT_FEP3_NOERROR(timer_scheduler->addTimer(timer, duration_cast<Duration>(1ms), Duration(0)));
+    fep3::IClock::IEventSink& scheduler_as_event_sink = *timer_scheduler;
+
+    ASSERT_FEP3_NOERROR(timer_scheduler->start());
+    scheduler_as_event_sink.timeResetBegin(Timestamp(0), Timestamp(0));
+    scheduler_as_event_sink.timeResetEnd(Timestamp(0));
+
+    std::future<void> call_execute = std::async(std::launch::async, [&]() {
+        fep3::IJob& scheduler_as_job = *timer_scheduler;
+        ASSERT_FEP3_NOERROR(scheduler_as_job.execute(clock_service.getTime()));
+    });
+
+    ASSERT_TRUE(timer.waitForWakeUps(1, duration_cast<Duration>(1s)));
+
+    // the instants 1ms to 5ms are missed
+    clock_service.setCurrentTime(duration_cast<Duration>(5500us));
+    ASSERT_TRUE(timer.waitForWakeUps(2, duration_cast<Duration>(1s)));
+    clock_service.setCurrentTime(duration_cast<Duration>(6ms));
+    ASSERT_TRUE(timer.waitForWakeUps(3, duration_cast<Duration>(1s)));
+
+    timer_scheduler->stop();
+    call_execute.get();
+
+    EXPECT_EQ(timer.getWakeUpTimes(),
+        (std::vector<Timestamp>{ Timestamp(0), duration_cast<Duration>(5500us), duration_cast<Duration>(6ms) }));
+}
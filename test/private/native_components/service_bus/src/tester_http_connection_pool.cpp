@@ -0,0 +1,331 @@
+/**
+ * @file
+ * Copyright &copy; AUDI AG. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ */
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "fep3/native_components/service_bus/rpc/http/http_connection_pool.h"
+
+#ifdef WIN32
+    #include <winsock2.h>
+    #include <ws2tcpip.h>
+    #define closeSocket(fd_socket) closesocket(fd_socket)
+    using socket_length = int;
+#else
+    #include <arpa/inet.h>
+    #include <netinet/in.h>
+    #include <sys/socket.h>
+    #include <unistd.h>
+    #define SOCKET int
+    #define INVALID_SOCKET (-1)
+    #define closeSocket(fd_socket) close(fd_socket)
+    using socket_length = socklen_t;
+#endif
+
+using namespace fep3::native;
+
+namespace
+{
+
+/**
+ * Minimal HTTP/1.1 server echoing the request bodies, counts the accepted connections.
+ */
+class EchoServer
+{
+public:
+    EchoServer(bool close_after_response, bool chunked)
+        : _close_after_response(close_after_response)
+        , _chunked(chunked)
+    {
+#ifdef WIN32
+        WSADATA wsa_data = { 0 };
+        WSAStartup(MAKEWORD(2, 2), &wsa_data);
+#endif
+        _socket = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in address;
+        std::memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = 0;
+        bind(_socket, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        listen(_socket, 16);
+
+        socket_length address_length = sizeof(address);
+        getsockname(_socket, reinterpret_cast<sockaddr*>(&address), &address_length);
+        _port = std::to_string(ntohs(address.sin_port));
+
+        _acceptor = std::thread([this]() { accept(); });
+    }
+
+    ~EchoServer()
+    {
+        _stop = true;
+#ifdef WIN32
+        shutdown(_socket, SD_BOTH);
+#else
+        shutdown(_socket, SHUT_RDWR);
+#endif
+        closeSocket(_socket);
+        _acceptor.join();
+
+        std::lock_guard<std::mutex> lock(_connections_mutex);
+        for (auto& connection : _connections)
+        {
+            connection.join();
+        }
+    }
+
+    std::string getPort() const
+    {
+        return _port;
+    }
+
+    int getAcceptedConnections() const
+    {
+        return _accepted_connections;
+    }
+
+private:
+    void accept()
+    {
+        while (!_stop)
+        {
+            const auto connection = ::accept(_socket, nullptr, nullptr);
+            if (connection == INVALID_SOCKET)
+            {
+                return;
+            }
+            ++_accepted_connections;
+
+            std::lock_guard<std::mutex> lock(_connections_mutex);
+            _connections.emplace_back([this, connection]() { serve(connection); });
+        }
+    }
+
+    void serve(SOCKET connection)
+    {
+        std::string buffer;
+        char data[4096];
+        while (!_stop)
+        {
+            const auto header_end = buffer.find("\r\n\r\n");
+            if (header_end == std::string::npos)
+            {
+                const auto received = recv(connection, data, sizeof(data), 0);
+                if (received <= 0)
+                {
+                    break;
+                }
+                buffer.append(data, static_cast<size_t>(received));
+                continue;
+            }
+
+            const auto content_length_begin = buffer.find("Content-Length: ") + 16;
+            const auto content_length = static_cast<size_t>(std::atoi(buffer.c_str() + content_length_begin));
+            if (buffer.size() < header_end + 4 + content_length)
+            {
+                const auto received = recv(connection, data, sizeof(data), 0);
+                if (received <= 0)
+                {
+                    break;
+                }
+                buffer.append(data, static_cast<size_t>(received));
+                continue;
+            }
+
+            const auto body = buffer.substr(header_end + 4, content_length);
+            buffer.erase(0, header_end + 4 + content_length);
+
+            std::string response;
+            if (_chunked)
+            {
+                const auto half = body.size() / 2;
+                char chunk_size[32];
+                response = "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n";
+                std::snprintf(chunk_size, sizeof(chunk_size), "%zx\r\n", half);
+                response += chunk_size + body.substr(0, half) + "\r\n";
+                std::snprintf(chunk_size, sizeof(chunk_size), "%zx\r\n", body.size() - half);
+                response += chunk_size + body.substr(half) + "\r\n0\r\n\r\n";
+            }
+            else
+            {
+                response = "HTTP/1.1 200 OK\r\nContent-Length: " + std::to_string(body.size()) + "\r\n\r\n" + body;
+            }
+            send(connection, response.data(), static_cast<int>(response.size()), 0);
+
+            if (_close_after_response)
+            {
+                // a server closing idle connections without telling the client
+                break;
+            }
+        }
+        closeSocket(connection);
+    }
+
+private:
+    const bool _close_after_response;
+    const bool _chunked;
+    SOCKET _socket;
+    std::string _port;
+    std::atomic_bool _stop{ false };
+    std::atomic_int _accepted_connections{ 0 };
+    std::thread _acceptor;
+    std::mutex _connections_mutex;
+    std::vector<std::thread> _connections;
+};
+
+} // namespace
+
+/**
+ * @detail Test whether the connection pool reuses one kept-alive connection for sequential requests.
+ */
+TEST(HttpConnectionPoolTest, reuseConnection)
+{
+    EchoServer server(false, false);
+    HttpConnectionPool pool("127.0.0.1", server.getPort(), 4);
+
+    for (int request = 0; request < 10; ++request)
+    {
+        const auto body = "{\"request\":" + std::to_string(request) + "}";
+        std::string response_body;
+        ASSERT_TRUE(fep3::isOk(pool.post("/service", body, response_body)));
+        EXPECT_EQ(response_body, body);
+    }
+    EXPECT_EQ(server.getAcceptedConnections(), 1);
+}
+
+/**
+ * @detail Test whether the connection pool decodes chunked responses.
+ */
+TEST(HttpConnectionPoolTest, receiveChunkedResponse)
+{
+    EchoServer server(false, true);
+    HttpConnectionPool pool("127.0.0.1", server.getPort(), 4);
+
+    for (int request = 0; request < 3; ++request)
+    {
+        const std::string body(1000 + request, 'x');
+        std::string response_body;
+        ASSERT_TRUE(fep3::isOk(pool.post("/service", body, response_body)));
+        EXPECT_EQ(response_body, body);
+    }
+    EXPECT_EQ(server.getAcceptedConnections(), 1);
+}
+
+/**
+ * @detail Test whether the connection pool reconnects transparently if the server closed a kept-alive connection.
+ */
+TEST(HttpConnectionPoolTest, reconnectClosedConnection)
+{
+    EchoServer server(true, false);
+    HttpConnectionPool pool("127.0.0.1", server.getPort(), 4);
+
+    for (int request = 0; request < 5; ++request)
+    {
+        std::string response_body;
+        ASSERT_TRUE(fep3::isOk(pool.post("/service", "{}", response_body)));
+        EXPECT_EQ(response_body, "{}");
+        // let the server close the connection before it is reused
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(server.getAcceptedConnections(), 5);
+}
+
+/**
+ * @detail Test whether concurrent callers get a connection each and the connections are reused afterwards.
+ */
+TEST(HttpConnectionPoolTest, concurrentCallers)
+{
+    EchoServer server(false, false);
+    HttpConnectionPool pool("127.0.0.1", server.getPort(), 4);
+    constexpr int callers = 4;
+
+    std::atomic_int failed_requests{ 0 };
+    std::vector<std::thread> threads;
+    for (int caller = 0; caller < callers; ++caller)
+    {
+        threads.emplace_back([&pool, &failed_requests, caller]()
+        {
+            for (int request = 0; request < 20; ++request)
+            {
+                const auto body = std::to_string(caller) + ":" + std::to_string(request);
+                std::string response_body;
+                if (fep3::isFailed(pool.post("/service", body, response_body)) || response_body != body)
+                {
+                    ++failed_requests;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(failed_requests, 0);
+    EXPECT_LE(server.getAcceptedConnections(), callers);
+}
+
+/**
+ * @detail Test whether a request to a server not listening fails.
+ */
+TEST(HttpConnectionPoolTest, connectionRefused)
+{
+    std::string port;
+    {
+        EchoServer server(false, false);
+        port = server.getPort();
+    }
+    HttpConnectionPool pool("127.0.0.1", port, 4);
+
+    std::string response_body;
+    EXPECT_TRUE(fep3::isFailed(pool.post("/service", "{}", response_body)));
+}
+
+/**
+ * @detail Test whether a request to a server accepting the connection but never responding
+ * fails after the configured response timeout.
+ */
+TEST(HttpConnectionPoolTest, responseTimeout)
+{
+#ifdef WIN32
+    WSADATA wsa_data = { 0 };
+    WSAStartup(MAKEWORD(2, 2), &wsa_data);
+#endif
+    // the connection is accepted by the backlog of the listening socket, but nobody reads the request
+    const auto silent_server = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address;
+    std::memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+    ASSERT_EQ(bind(silent_server, reinterpret_cast<sockaddr*>(&address), sizeof(address)), 0);
+    ASSERT_EQ(listen(silent_server, 16), 0);
+    socket_length address_length = sizeof(address);
+    ASSERT_EQ(getsockname(silent_server, reinterpret_cast<sockaddr*>(&address), &address_length), 0);
+
+    HttpConnectionPool pool("127.0.0.1", std::to_string(ntohs(address.sin_port)), 4,
+        std::chrono::milliseconds(500), std::chrono::milliseconds(200));
+
+    std::string response_body;
+    const auto begin = std::chrono::steady_clock::now();
+    EXPECT_EQ(pool.post("/service", "{}", response_body).getErrorCode(), fep3::ResultType_ERR_TIMEOUT::getCode());
+    EXPECT_LT(std::chrono::steady_clock::now() - begin, std::chrono::seconds(2));
+
+    closeSocket(silent_server);
+}
@@ -8,6 +8,8 @@
  * file, You can obtain one at https://mozilla.org/MPL/2.0/.
  *
  */
+#include <atomic>
+#include <thread>
 #include <gtest/gtest.h>
 #include <fep3/components/service_bus/rpc/fep_rpc.h>
 #include <fep3/rpc_services/base/fep_rpc_client.h>
@@ -16,6 +18,8 @@
 #include <testserverstub.h>
 
 #include <fep3/native_components/service_bus/service_bus.h>
+#include <fep3/native_components/service_bus/rpc/http/local_requester.h>
+#include <fep3/native_components/service_bus/rpc/http/http_client.h>
 
 class ITestInterface
 {
@@ -122,9 +126,9 @@ TEST(ServciceBusServer, testRegistrationOfServices)
     //impl test 
     fep3::rpc::RPCClient<ITestInterface> my_interface_client;
 
-    //test the client server connections
+    //test the client server connections, a requester of the service bus would call the in-process server directly
     TestClient client(ITestInterface::getRPCDefaultName(),
-    bus.getRequester(test_server_url, true));
+        std::make_shared<fep3::native::HttpClientConnector>(test_server_url));
 
     ASSERT_NO_THROW(
         ASSERT_EQ(TestService::SetRunlevel_call_count, 0);
@@ -174,3 +178,171 @@ TEST(ServciceBusServer, testRegistrationOfServices)
 
     ASSERT_EQ(TestService::GetRPCIIDForObjects_call_count, 3);
 }
+
+/**
+ * @detail Test the registration and unregistration of services called by the requester of the ServiceBus,
+ * which calls the services of a server of the same process directly
+ * @req_id FEPSDK-ServiceBus
+ *
+ */
+TEST(ServciceBusServer, testRegistrationOfServicesLocal)
+{
+    constexpr const char* const test_server_url = "http://localhost:9904";
+    auto test_service = std::make_shared<TestService>();
+    fep3::native::ServiceBus bus;
+
+    ASSERT_TRUE(fep3::isOk(bus.createSystemAccess("sysname",
+        "",
+        true)));
+    auto sys_access = bus.getSystemAccess("sysname");
+    ASSERT_TRUE(sys_access);
+    ASSERT_TRUE(fep3::isOk(sys_access->createServer("name_of_server",
+        test_server_url)));
+    auto server = bus.getServer();
+    ASSERT_TRUE(server);
+
+    ASSERT_TRUE(fep3::isOk(server->registerService("test_service", test_service)));
+    ASSERT_FALSE(fep3::isOk(server->registerService("test_service", test_service)));
+
+    const auto requester = bus.getRequester(test_server_url, true);
+    ASSERT_TRUE(std::dynamic_pointer_cast<fep3::native::LocalRequester>(requester));
+    TestClient client(ITestInterface::getRPCDefaultName(), requester);
+
+    const auto get_objects_call_count = TestService::GetObjects_call_count;
+    ASSERT_NO_THROW(
+        ASSERT_EQ(client.GetObjects(), "bla, blubb, bla");
+    );
+    ASSERT_EQ(TestService::GetObjects_call_count, get_objects_call_count + 1);
+
+    //unregister the service
+    ASSERT_TRUE(fep3::isOk(server->unregisterService("test_service")));
+
+    ASSERT_ANY_THROW(
+        client.GetObjects();
+    );
+    ASSERT_EQ(TestService::GetObjects_call_count, get_objects_call_count + 1);
+}
+
+/**
+ * @detail Test whether requesters to a server of the same process call its services directly
+ * @req_id FEPSDK-ServiceBus
+ *
+ */
+TEST(ServciceBusServer, testLocalRequester)
+{
+    constexpr const char* const test_server_url = "http://0.0.0.0:9901";
+    auto test_service = std::make_shared<TestService>();
+    fep3::native::ServiceBus bus;
+
+    ASSERT_TRUE(fep3::isOk(bus.createSystemAccess("sysname",
+        "",
+        true)));
+    auto sys_access = bus.getSystemAccess("sysname");
+    ASSERT_TRUE(sys_access);
+    ASSERT_TRUE(fep3::isOk(sys_access->createServer("name_of_server",
+        test_server_url)));
+    ASSERT_TRUE(fep3::isOk(bus.getServer()->registerService("test_service", test_service)));
+
+    //our own server by name, by its url and by a loopback alias of its url
+    const auto requester_by_name = sys_access->getRequester("name_of_server");
+    const auto requester_by_url = bus.getRequester(test_server_url, true);
+    const auto requester_by_alias = bus.getRequester("http://localhost:9901", true);
+    ASSERT_TRUE(std::dynamic_pointer_cast<fep3::native::LocalRequester>(requester_by_name));
+    ASSERT_TRUE(std::dynamic_pointer_cast<fep3::native::LocalRequester>(requester_by_url));
+    ASSERT_TRUE(std::dynamic_pointer_cast<fep3::native::LocalRequester>(requester_by_alias));
+
+    //another port is not served in this process
+    ASSERT_FALSE(std::dynamic_pointer_cast<fep3::native::LocalRequester>(
+        bus.getRequester("http://127.0.0.1:9902", true)));
+
+    TestClient client(ITestInterface::getRPCDefaultName(), requester_by_name);
+    ASSERT_NO_THROW(
+        client.SetRunlevel(42);
+        ASSERT_EQ(client.GetRunlevel(), 42);
+        ASSERT_EQ(client.GetRPCIIDForObject("bla"), "blubb");
+    );
+
+    //not registered services fail as they do via http
+    TestClient unknown_client("unknown_service", requester_by_url);
+    ASSERT_ANY_THROW(
+        unknown_client.GetRunlevel();
+    );
+
+    //the requester does not keep the server alive
+    sys_access->releaseServer();
+    ASSERT_ANY_THROW(
+        client.GetRunlevel();
+    );
+}
+
+/**
+ * @detail Test whether services can be registered and unregistered while requests are served over http
+ * @req_id FEPSDK-ServiceBus
+ *
+ */
+TEST(ServciceBusServer, testRegistrationWhileListening)
+{
+    constexpr const char* const test_server_url = "http://127.0.0.1:9903";
+    fep3::native::ServiceBus bus;
+
+    ASSERT_TRUE(fep3::isOk(bus.createSystemAccess("sysname",
+        "",
+        true)));
+    auto sys_access = bus.getSystemAccess("sysname");
+    ASSERT_TRUE(sys_access);
+    ASSERT_TRUE(fep3::isOk(sys_access->createServer("name_of_server",
+        test_server_url)));
+    auto server = bus.getServer();
+    ASSERT_TRUE(fep3::isOk(server->registerService("test_service", std::make_shared<TestService>())));
+
+    //go via http explicitly, a requester of the service bus would call the in-process server directly
+    TestClient client(ITestInterface::getRPCDefaultName(),
+        std::make_shared<fep3::native::HttpClientConnector>(test_server_url));
+    client.SetRunlevel(7);
+
+    std::atomic_bool stop{ false };
+    std::atomic_int failed_calls{ 0 };
+    std::thread caller([&]()
+    {
+        while (!stop)
+        {
+            try
+            {
+                if (client.GetRunlevel() != 7)
+                {
+                    ++failed_calls;
+                }
+            }
+            catch (const std::exception&)
+            {
+                ++failed_calls;
+            }
+        }
+    });
+
+    for (int registration = 0; registration < 50; ++registration)
+    {
+        ASSERT_TRUE(fep3::isOk(server->registerService("other_service", std::make_shared<TestService>())));
+        ASSERT_TRUE(fep3::isOk(server->unregisterService("other_service")));
+        //a service name not registered before gets its wrapper while the server is listening
+        const auto new_service_name = "new_service_" + std::to_string(registration);
+        ASSERT_TRUE(fep3::isOk(server->registerService(new_service_name, std::make_shared<TestService>())));
+        ASSERT_TRUE(fep3::isOk(server->unregisterService(new_service_name)));
+    }
+    stop = true;
+    caller.join();
+
+    EXPECT_EQ(failed_calls, 0);
+
+    //the service name is served again after a re-registration
+    ASSERT_TRUE(fep3::isOk(server->registerService("other_service", std::make_shared<TestService>())));
+    TestClient other_client("other_service",
+        std::make_shared<fep3::native::HttpClientConnector>(test_server_url));
+    ASSERT_NO_THROW(
+        ASSERT_EQ(other_client.GetRunlevel(), 0);
+    );
+    ASSERT_TRUE(fep3::isOk(server->unregisterService("other_service")));
+    ASSERT_ANY_THROW(
+        other_client.GetRunlevel();
+    );
+}
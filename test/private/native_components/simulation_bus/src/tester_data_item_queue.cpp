@@ -0,0 +1,369 @@
+/**
+ * @file
+ * Copyright &copy; AUDI AG. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <fep3/components/simulation_bus/simulation_bus_intf.h>
+#include <fep3/native_components/simulation_bus/data_item_queue.h>
+#include <fep3/native_components/simulation_bus/lock_free_data_item_queue.h>
+#include <fep3/base/streamtype/default_streamtype.h>
+#include <fep3/base/sample/data_sample.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+// older gtest versions only provide the test case naming
+#ifndef TYPED_TEST_SUITE
+#define TYPED_TEST_SUITE TYPED_TEST_CASE
+#endif
+
+using namespace fep3;
+
+namespace {
+
+data_read_ptr<const IDataSample> createSample(int64_t time, uint32_t counter = 0)
+{
+    auto sample = std::make_shared<DataSample>();
+    sample->setTime(Timestamp(time));
+    sample->setCounter(counter);
+    return sample;
+}
+
+template <typename QUEUE_TYPE>
+class DataItemQueueTest : public ::testing::Test
+{
+};
+
+using DataItemQueueTypes = ::testing::Types<native::DataItemQueue<>, native::LockFreeDataItemQueue<>>;
+TYPED_TEST_SUITE(DataItemQueueTest, DataItemQueueTypes);
+
+} // namespace
+
+/**
+ * @detail Test that items are popped in the order they are pushed
+ * @req_id FEPSDK-SimulationBus
+ */
+TYPED_TEST(DataItemQueueTest, popsInPushOrder)
+{
+    TypeParam queue(4);
+    EXPECT_EQ(queue.capacity(), 4u);
+    EXPECT_EQ(queue.size(), 0u);
+
+    const auto stream_type = std::make_shared<StreamTypePlain<uint32_t>>();
+    queue.push(createSample(1));
+    queue.push(data_read_ptr<const IStreamType>(stream_type));
+    queue.push(createSample(2));
+    EXPECT_EQ(queue.size(), 3u);
+
+    auto item = queue.pop();
+    ASSERT_TRUE(std::get<0>(item));
+    EXPECT_EQ(std::get<0>(item)->getTime(), Timestamp(1));
+    EXPECT_FALSE(std::get<1>(item));
+
+    item = queue.pop();
+    EXPECT_FALSE(std::get<0>(item));
+    EXPECT_EQ(std::get<1>(item), stream_type);
+
+    item = queue.pop();
+    ASSERT_TRUE(std::get<0>(item));
+    EXPECT_EQ(std::get<0>(item)->getTime(), Timestamp(2));
+
+    item = queue.pop();
+    EXPECT_FALSE(std::get<0>(item));
+    EXPECT_FALSE(std::get<1>(item));
+    EXPECT_EQ(queue.size(), 0u);
+}
+
+/**
+ * @detail Test that the oldest items are dropped if the capacity is exceeded
+ * @req_id FEPSDK-SimulationBus
+ */
+TYPED_TEST(DataItemQueueTest, overwritesOldestItem)
+{
+    TypeParam queue(3);
+    for (int64_t time = 1; time <= 5; ++time)
+    {
+        queue.push(createSample(time));
+    }
+    EXPECT_EQ(queue.size(), 3u);
+
+    for (int64_t time = 3; time <= 5; ++time)
+    {
+        auto item = queue.pop();
+        ASSERT_TRUE(std::get<0>(item));
+        EXPECT_EQ(std::get<0>(item)->getTime(), Timestamp(time));
+    }
+    EXPECT_EQ(queue.size(), 0u);
+}
+
+/**
+ * @detail Test that the front time reflects the sample at the front of the queue
+ * @req_id FEPSDK-SimulationBus
+ */
+TYPED_TEST(DataItemQueueTest, providesFrontTime)
+{
+    TypeParam queue(2);
+    EXPECT_FALSE(queue.getFrontTime());
+
+    queue.push(createSample(10));
+    queue.push(createSample(20));
+    ASSERT_TRUE(queue.getFrontTime());
+    EXPECT_EQ(queue.getFrontTime().value(), Timestamp(10));
+
+    queue.pop();
+    ASSERT_TRUE(queue.getFrontTime());
+    EXPECT_EQ(queue.getFrontTime().value(), Timestamp(20));
+
+    queue.clear();
+    EXPECT_FALSE(queue.getFrontTime());
+    EXPECT_EQ(queue.size(), 0u);
+}
+
+/**
+ * @detail Test that popped samples are not referenced by the queue anymore
+ * @req_id FEPSDK-SimulationBus
+ */
+TYPED_TEST(DataItemQueueTest, releasesPoppedItems)
+{
+    TypeParam queue(2);
+    auto sample = createSample(1);
+    queue.push(sample);
+    EXPECT_EQ(sample.use_count(), 2);
+
+    queue.pop();
+    EXPECT_EQ(sample.use_count(), 1);
+}
+
+/**
+ * @detail Test that items pushed and popped at once keep their order and the oldest items are dropped
+ * if the capacity is exceeded
+ * @req_id FEPSDK-SimulationBus
+ */
+TYPED_TEST(DataItemQueueTest, pushesAndPopsBatches)
+{
+    using Items = std::vector<native::DataItemQueueBase<>::Item>;
+    TypeParam queue(3);
+
+    const auto stream_type = std::make_shared<StreamTypePlain<uint32_t>>();
+    queue.push(createSample(1));
+    queue.pushItems(Items{ Items::value_type{ createSample(2), nullptr }
+                         , Items::value_type{ nullptr, stream_type } });
+    EXPECT_EQ(queue.size(), 3u);
+
+    Items popped;
+    EXPECT_EQ(queue.popItems(popped), 3u);
+    ASSERT_EQ(popped.size(), 3u);
+    EXPECT_EQ(std::get<0>(popped[0])->getTime(), Timestamp(1));
+    EXPECT_EQ(std::get<0>(popped[1])->getTime(), Timestamp(2));
+    EXPECT_EQ(std::get<1>(popped[2]), stream_type);
+    EXPECT_EQ(queue.size(), 0u);
+
+    // the batch exceeds the capacity together with the queued item
+    queue.push(createSample(3));
+    Items batch;
+    for (int64_t time = 4; time <= 8; ++time)
+    {
+        batch.emplace_back(createSample(time), nullptr);
+    }
+    queue.pushItems(batch);
+    EXPECT_EQ(queue.size(), 3u);
+
+    popped.clear();
+    EXPECT_EQ(queue.popItems(popped), 3u);
+    ASSERT_EQ(popped.size(), 3u);
+    for (size_t index = 0; index < popped.size(); ++index)
+    {
+        EXPECT_EQ(std::get<0>(popped[index])->getTime(), Timestamp(6 + static_cast<int64_t>(index)));
+    }
+    EXPECT_EQ(queue.popItems(popped), 0u);
+}
+
+/**
+ * @detail Test that a waiting receiver is woken up by a push and by interruptWait
+ * @req_id FEPSDK-SimulationBus
+ */
+TYPED_TEST(DataItemQueueTest, wakesUpWaitingReceiver)
+{
+    TypeParam queue(2);
+
+    std::thread pusher([&queue]()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        queue.push(createSample(1));
+    });
+    EXPECT_TRUE(queue.waitForItem());
+    pusher.join();
+    queue.pop();
+
+    std::thread interrupter([&queue]()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        queue.interruptWait();
+    });
+    EXPECT_FALSE(queue.waitForItem());
+    interrupter.join();
+    queue.clearWaitInterruption();
+}
+
+/**
+ * @detail Test that concurrent producers and a consumer do not lose or reorder items
+ * if the capacity is not exceeded
+ * @req_id FEPSDK-SimulationBus
+ */
+TYPED_TEST(DataItemQueueTest, supportsMultipleProducers)
+{
+    constexpr size_t producer_count = 4;
+    constexpr uint32_t items_per_producer = 1000;
+    TypeParam queue(producer_count * items_per_producer);
+
+    std::vector<std::thread> producers;
+    for (size_t producer = 0; producer < producer_count; ++producer)
+    {
+        producers.emplace_back([&queue, producer]()
+        {
+            for (uint32_t counter = 0; counter < items_per_producer; ++counter)
+            {
+                queue.push(createSample(static_cast<int64_t>(producer), counter));
+            }
+        });
+    }
+
+    std::vector<uint32_t> expected_counter(producer_count, 0);
+    size_t received = 0;
+    while (received < producer_count * items_per_producer)
+    {
+        auto sample = std::get<0>(queue.pop());
+        if (!sample)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        // items of one producer keep their order
+        auto& counter = expected_counter[static_cast<size_t>(sample->getTime().count())];
+        EXPECT_EQ(sample->getCounter(), counter);
+        ++counter;
+        ++received;
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    EXPECT_EQ(queue.size(), 0u);
+}
+
+namespace {
+
+struct BenchmarkResult
+{
+    double items_per_second;
+    double mean_latency_us;
+    double max_latency_us;
+};
+
+/**
+ * Pushes timestamped samples from @p producer_count threads while one consumer pops them.
+ * The sample time is the push time, so the consumer can measure the push to pop latency.
+ */
+template <typename QUEUE_TYPE>
+BenchmarkResult runBenchmark(size_t producer_count, size_t items_per_producer)
+{
+    using clock = std::chrono::steady_clock;
+    QUEUE_TYPE queue(1024);
+
+    // every sample is pushed once, so the producers do not modify samples the consumer is reading
+    std::vector<std::vector<std::shared_ptr<DataSample>>> samples(producer_count);
+    for (auto& producer_samples : samples)
+    {
+        for (size_t index = 0; index < items_per_producer; ++index)
+        {
+            producer_samples.push_back(std::make_shared<DataSample>());
+        }
+    }
+
+    std::atomic<size_t> running_producers{ producer_count };
+    std::vector<std::thread> producers;
+    const auto begin = clock::now();
+    for (size_t producer = 0; producer < producer_count; ++producer)
+    {
+        producers.emplace_back([&queue, &running_producers, &producer_samples = samples[producer]]()
+        {
+            for (auto& sample : producer_samples)
+            {
+                sample->setTime(std::chrono::duration_cast<Timestamp>(clock::now().time_since_epoch()));
+                queue.push(data_read_ptr<const IDataSample>(sample));
+            }
+            --running_producers;
+        });
+    }
+
+    size_t popped = 0;
+    double latency_sum_us = 0.0;
+    double latency_max_us = 0.0;
+    while (running_producers > 0 || queue.size() > 0)
+    {
+        auto sample = std::get<0>(queue.pop());
+        if (!sample)
+        {
+            continue;
+        }
+        const auto latency = clock::now().time_since_epoch() - sample->getTime();
+        const double latency_us = std::chrono::duration<double, std::micro>(latency).count();
+        latency_sum_us += latency_us;
+        latency_max_us = std::max(latency_max_us, latency_us);
+        ++popped;
+    }
+    const auto end = clock::now();
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    const double seconds = std::chrono::duration<double>(end - begin).count();
+    return { static_cast<double>(producer_count * items_per_producer) / seconds
+           , popped > 0 ? latency_sum_us / static_cast<double>(popped) : 0.0
+           , latency_max_us };
+}
+
+void recordBenchmarkResult(const std::string& name, size_t producer_count, const BenchmarkResult& result)
+{
+    const auto key = name + "_" + std::to_string(producer_count) + "_producers_";
+    ::testing::Test::RecordProperty(key + "items_per_second", std::to_string(static_cast<uint64_t>(result.items_per_second)));
+    ::testing::Test::RecordProperty(key + "mean_latency_us", std::to_string(result.mean_latency_us));
+    ::testing::Test::RecordProperty(key + "max_latency_us", std::to_string(result.max_latency_us));
+}
+
+} // namespace
+
+/**
+ * @detail Micro benchmark comparing the mutex based and the lock free queue.
+ * Only records the results as test properties (see --gtest_output), the numbers depend too much
+ * on the machine to be checked.
+ * Disabled as it busy spins, run it explicitly with --gtest_also_run_disabled_tests.
+ * Items dropped because of a full queue are not part of the latency.
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(DataItemQueueBenchmark, DISABLED_compareMutexAndLockFreeQueue)
+{
+    constexpr size_t items_per_producer = 100000;
+    for (size_t producer_count : { 1, 2 })
+    {
+        recordBenchmarkResult("data_item_queue", producer_count,
+            runBenchmark<native::DataItemQueue<>>(producer_count, items_per_producer));
+        recordBenchmarkResult("lock_free_data_item_queue", producer_count,
+            runBenchmark<native::LockFreeDataItemQueue<>>(producer_count, items_per_producer));
+    }
+}
@@ -0,0 +1,253 @@
+/**
+ * @file
+ * Copyright &copy; AUDI AG. All rights reserved.
+ *
+ * This Source Code Form is subject to the terms of the
+ * Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <fep3/base/sample/data_sample_pool.h>
+#include <fep3/base/sample/raw_memory.h>
+#include <fep3/native_components/simulation_bus/simulation_bus.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<bool> count_allocations{ false };
+std::atomic<size_t> allocation_count{ 0 };
+
+/**
+ * Counts the heap allocations of the test thread between construction and destruction
+ */
+struct AllocationCounter
+{
+    AllocationCounter()
+    {
+        allocation_count = 0;
+        count_allocations = true;
+    }
+    ~AllocationCounter()
+    {
+        count_allocations = false;
+    }
+    size_t getCount() const
+    {
+        return allocation_count;
+    }
+};
+
+} // namespace
+
+void* operator new(size_t size)
+{
+    if (count_allocations)
+    {
+        ++allocation_count;
+    }
+    void* memory = std::malloc(size > 0 ? size : 1);
+    if (!memory)
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+    std::free(memory);
+}
+
+using namespace fep3;
+
+namespace {
+
+class CountingReceiver : public ISimulationBus::IDataReceiver
+{
+public:
+    void operator()(const data_read_ptr<const IStreamType>&) override
+    {
+    }
+    void operator()(const data_read_ptr<const IDataSample>& sample) override
+    {
+        _value = 0;
+        RawMemoryStandardType<uint64_t> value_ref(_value);
+        sample->read(value_ref);
+        ++_received;
+    }
+
+    uint64_t _value{ 0 };
+    size_t _received{ 0 };
+};
+
+} // namespace
+
+/**
+ * @detail Test that samples go back to the free list of their size class when they are released
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(DataSamplePool, recyclesReleasedSamples)
+{
+    DataSamplePool pool(64, 4);
+
+    auto sample = pool.getSample(10);
+    ASSERT_TRUE(sample);
+    EXPECT_GE(sample->capacity(), 10u);
+    sample->setTime(Timestamp(5));
+    sample->setCounter(3);
+    const DataSample* released_sample = sample.get();
+    sample.reset();
+
+    // same size class
+    auto recycled_sample = pool.getSample(64);
+    EXPECT_EQ(recycled_sample.get(), released_sample);
+    EXPECT_EQ(recycled_sample->getTime(), Timestamp(0));
+    EXPECT_EQ(recycled_sample->getCounter(), 0u);
+    EXPECT_EQ(recycled_sample->getSize(), 0u);
+
+    // different size class
+    auto other_sample = pool.getSample(65);
+    EXPECT_NE(other_sample.get(), released_sample);
+    EXPECT_GE(other_sample->capacity(), 65u);
+
+    // exceeds the largest size class
+    auto large_sample = pool.getSample(64 * 16);
+    EXPECT_GE(large_sample->capacity(), 64u * 16u);
+}
+
+/**
+ * @detail Test that samples exceeding the largest size class are reused by capacity
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(DataSamplePool, recyclesOversizedSamples)
+{
+    DataSamplePool pool(64, 4);
+    const size_t large_size = 64 * 16;
+
+    auto large_sample = pool.getSample(4 * large_size);
+    auto small_large_sample = pool.getSample(large_size);
+    const DataSample* released_large_sample = large_sample.get();
+    const DataSample* released_small_large_sample = small_large_sample.get();
+    large_sample.reset();
+    small_large_sample.reset();
+
+    // the smallest fitting one is reused
+    auto recycled_sample = pool.getSample(2 * large_size);
+    EXPECT_EQ(recycled_sample.get(), released_large_sample);
+    EXPECT_GE(recycled_sample->capacity(), 2u * large_size);
+    EXPECT_EQ(recycled_sample->getSize(), 0u);
+
+    // if none fits the largest one is reused with a larger capacity
+    auto grown_sample = pool.getSample(8 * large_size);
+    EXPECT_EQ(grown_sample.get(), released_small_large_sample);
+    EXPECT_GE(grown_sample->capacity(), 8u * large_size);
+
+    // steady state does not allocate
+    grown_sample.reset();
+    recycled_sample.reset();
+    AllocationCounter counter;
+    for (size_t count = 0; count < 100; ++count)
+    {
+        auto sample_1 = pool.getSample(8 * large_size);
+        auto sample_2 = pool.getSample(3 * large_size);
+        EXPECT_GE(sample_1->capacity(), 8u * large_size);
+        EXPECT_GE(sample_2->capacity(), 3u * large_size);
+    }
+    EXPECT_EQ(counter.getCount(), 0u);
+}
+
+/**
+ * @detail Test that samples may outlive their pool
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(DataSamplePool, samplesOutlivePool)
+{
+    std::shared_ptr<DataSample> sample;
+    {
+        DataSamplePool pool;
+        sample = pool.getSample(sizeof(uint64_t));
+    }
+    uint64_t value = 42;
+    sample->write(RawMemoryStandardType<uint64_t>(value));
+    EXPECT_EQ(sample->getSize(), sizeof(uint64_t));
+    sample.reset();
+}
+
+/**
+ * @detail Test that getting and releasing samples does not allocate once the pool is warmed up
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(DataSamplePool, steadyStateDoesNotAllocate)
+{
+    DataSamplePool pool;
+    uint64_t value = 0;
+    {
+        auto warm_up_1 = pool.getSample(sizeof(value));
+        auto warm_up_2 = pool.getSample(sizeof(value));
+    }
+
+    AllocationCounter counter;
+    for (value = 0; value < 1000; ++value)
+    {
+        auto sample_1 = pool.getSample(sizeof(value));
+        auto sample_2 = pool.getSample(sizeof(value));
+        sample_1->write(RawMemoryStandardType<uint64_t>(value));
+        data_read_ptr<const IDataSample> shared_sample = sample_1;
+    }
+    EXPECT_EQ(counter.getCount(), 0u);
+}
+
+/**
+ * @detail Test that writing, transmitting and receiving samples with the native simulation bus
+ * does not allocate once all samples in flight are allocated
+ * @req_id FEPSDK-SimulationBus
+ */
+TEST(DataSamplePool, nativeSimulationBusSteadyStateDoesNotAllocate)
+{
+    native::SimulationBus simulation_bus;
+    auto reader = simulation_bus.getReader("signal_without_allocation", 2);
+    auto writer = simulation_bus.getWriter("signal_without_allocation", 2);
+    ASSERT_TRUE(reader);
+    ASSERT_TRUE(writer);
+
+    CountingReceiver receiver;
+    uint64_t value = 0;
+    auto write_and_receive = [&]()
+    {
+        DataSampleType<uint64_t> sample(value);
+        ASSERT_TRUE(isOk(writer->write(sample)));
+        ASSERT_TRUE(isOk(writer->write(sample)));
+        ASSERT_TRUE(isOk(writer->transmit()));
+        while (reader->pop(receiver))
+        {
+        }
+    };
+
+    for (value = 0; value < 10; ++value)
+    {
+        write_and_receive();
+    }
+
+    {
+        AllocationCounter counter;
+        for (value = 10; value < 1010; ++value)
+        {
+            write_and_receive();
+        }
+        EXPECT_EQ(counter.getCount(), 0u);
+    }
+    EXPECT_EQ(receiver._received, 2020u);
+    EXPECT_EQ(receiver._value, 1009u);
+}
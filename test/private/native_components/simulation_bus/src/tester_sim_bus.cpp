@@ -16,6 +16,8 @@
 #include <fep3/components/simulation_bus/mock/mock_simulation_bus.h>
 #include <fep3/native_components/simulation_bus/simulation_bus.h>
 #include <fep3/native_components/simulation_bus/simbus_datareader.h>
+#include <fep3/native_components/simulation_bus/simbus_datawriter.h>
+#include <fep3/native_components/simulation_bus/data_item_queue.h>
 #include <fep3/base/streamtype/default_streamtype.h>
 #include <fep3/base/sample/mock/mock_data_sample.h>
 #include <fep3/base/sample/data_sample.h>
@@ -24,6 +26,7 @@
 
 #include <thread>
 #include <array>
+#include <atomic>
 
 using namespace fep3;
 
@@ -144,6 +147,34 @@ TEST(NativeSimulationBus, testStoppingDataReader)
     t2.join();
 }
 
+/**
+ * @detail Test that a blocking data triggered reception wakes up on push and returns on stop
+ * @req_id FEPSDK-SimulationBus
+ *
+ */
+TEST(NativeSimulationBus, testDataTriggeredReceptionWakesUpOnPush)
+{
+    using ::testing::_;
+    using MatchIDataSample = testing::Matcher<const data_read_ptr<const IDataSample>&>;
+
+    auto item_queue = std::make_shared<fep3::native::DataItemQueue<>>(1);
+    auto sample = std::make_shared<fep3::mock::DataSample>();
+
+    fep3::mock::DataReceiver receiver;
+    test::helper::Notification received;
+    EXPECT_CALL(receiver, call(MatchIDataSample(_)))
+        .WillOnce(Notify(&received));
+
+    fep3::native::SimulationBus::DataReader reader{ item_queue };
+    std::thread receive_thread(&fep3::native::SimulationBus::DataReader::receive, &reader, std::ref(receiver));
+
+    item_queue->push(sample);
+    received.waitForNotification();
+
+    reader.stop();
+    receive_thread.join();
+}
+
 /**
  * @detail Test transmission of arbitrary data
  * @req_id FEPSDK-SimulationBus
@@ -312,3 +343,181 @@ TEST_F(SimpleDataSample, testOverflowWriterQueue)
 
     while(reader->pop(receiver));
 }
+
+namespace {
+    class SampleCollector : public ISimulationBus::IDataReceiver
+    {
+    public:
+        void operator()(const data_read_ptr<const IStreamType>&) override
+        {
+        }
+
+        void operator()(const data_read_ptr<const IDataSample>& sample) override
+        {
+            _samples.push_back(sample);
+        }
+
+        std::vector<data_read_ptr<const IDataSample>> _samples;
+    };
+}
+
+/**
+ * @detail Test that all receivers share the written sample and the writer recycles it once released
+ * @req_id FEPSDK-SimulationBus
+ *
+ */
+TEST_F(SimpleDataSample, testSampleIsSharedAndRecycled)
+{
+    const std::string signal_name{ "signal_recycled" };
+
+    // a bus instance accepts only one reader per signal, the second receiver reads via another instance
+    fep3::native::SimulationBus reader_bus;
+    auto reader_1 = _sim_bus->getReader(signal_name, 1);
+    auto reader_2 = reader_bus.getReader(signal_name, 1);
+    auto writer = _sim_bus->getWriter(signal_name, 1);
+    ASSERT_TRUE(reader_1);
+    ASSERT_TRUE(reader_2);
+    ASSERT_TRUE(writer);
+
+    writer->write(_samples[0]);
+    writer->transmit();
+
+    SampleCollector receiver_1, receiver_2;
+    ASSERT_TRUE(reader_1->pop(receiver_1));
+    ASSERT_TRUE(reader_2->pop(receiver_2));
+    ASSERT_EQ(receiver_1._samples.size(), 1u);
+    ASSERT_EQ(receiver_2._samples.size(), 1u);
+    EXPECT_EQ(receiver_1._samples[0].get(), receiver_2._samples[0].get());
+    EXPECT_THAT(*receiver_1._samples[0], fep3::mock::DataSampleMatcher(_samples[0]));
+
+    const IDataSample* first_sample = receiver_1._samples[0].get();
+    receiver_1._samples.clear();
+    receiver_2._samples.clear();
+
+    writer->write(_samples[1]);
+    writer->transmit();
+
+    ASSERT_TRUE(reader_1->pop(receiver_1));
+    ASSERT_TRUE(reader_2->pop(receiver_2));
+    ASSERT_EQ(receiver_1._samples.size(), 1u);
+    ASSERT_EQ(receiver_2._samples.size(), 1u);
+    EXPECT_EQ(receiver_1._samples[0].get(), first_sample);
+    EXPECT_EQ(receiver_2._samples[0].get(), first_sample);
+    EXPECT_THAT(*receiver_1._samples[0], fep3::mock::DataSampleMatcher(_samples[1]));
+}
+
+/**
+ * @detail Test that a transmit of many samples keeps their order for every receiver
+ * and drops the oldest samples for receivers with smaller queues
+ * @req_id FEPSDK-SimulationBus
+ *
+ */
+TEST_F(SimpleDataSample, testBatchedTransmitKeepsOrder)
+{
+    const std::string signal_name{ "signal_batched" };
+
+    fep3::native::SimulationBus reader_bus;
+    auto reader_large = _sim_bus->getReader(signal_name, 2 * _sample_number);
+    auto reader_small = reader_bus.getReader(signal_name, 3);
+    auto writer = _sim_bus->getWriter(signal_name, 2 * _sample_number);
+    ASSERT_TRUE(reader_large);
+    ASSERT_TRUE(reader_small);
+    ASSERT_TRUE(writer);
+
+    for (const auto& sample : _samples)
+    {
+        writer->write(sample);
+    }
+    writer->transmit();
+
+    SampleCollector receiver_large, receiver_small;
+    while (reader_large->pop(receiver_large))
+    {
+    }
+    while (reader_small->pop(receiver_small))
+    {
+    }
+
+    ASSERT_EQ(receiver_large._samples.size(), _samples.size());
+    for (size_t index = 0; index < _samples.size(); ++index)
+    {
+        EXPECT_THAT(*receiver_large._samples[index], fep3::mock::DataSampleMatcher(_samples[index]));
+    }
+
+    ASSERT_EQ(receiver_small._samples.size(), 3u);
+    for (size_t index = 0; index < 3; ++index)
+    {
+        EXPECT_THAT(*receiver_small._samples[index], fep3::mock::DataSampleMatcher(_samples[_samples.size() - 3 + index]));
+    }
+}
+
+/**
+ * @detail Test that the queue of a destroyed reader does not receive samples anymore
+ * @req_id FEPSDK-SimulationBus
+ *
+ */
+TEST(NativeSimulationBus, testDestroyedReaderIsRemovedFromTransmitter)
+{
+    auto transmitter = std::make_shared<fep3::native::SimulationBus::Transmitter>();
+    auto remaining_queue = std::make_shared<fep3::native::DataItemQueue<>>(5);
+    auto removed_queue = std::make_shared<fep3::native::DataItemQueue<>>(5);
+    transmitter->add(remaining_queue);
+    transmitter->add(removed_queue);
+    {
+        fep3::native::SimulationBus::DataReader reader(removed_queue, transmitter);
+    }
+
+    fep3::native::SimulationBus::Transmitter::Items items;
+    items.emplace_back(std::make_shared<fep3::mock::DataSample>(), nullptr);
+    transmitter->transmit(items);
+
+    EXPECT_EQ(remaining_queue->size(), 1u);
+    EXPECT_EQ(removed_queue->size(), 0u);
+}
+
+/**
+ * @detail Test that readers of one signal can be created and destroyed by several threads while samples are transmitted
+ * @req_id FEPSDK-SimulationBus
+ *
+ */
+TEST(NativeSimulationBus, testConcurrentReaderRegistrationWhileTransmitting)
+{
+    const std::string signal_name{ "signal_concurrent_registration" };
+
+    fep3::native::SimulationBus writer_bus;
+    auto writer = writer_bus.getWriter(signal_name, 1);
+    ASSERT_TRUE(writer);
+
+    std::atomic<bool> transmitting{ true };
+    std::thread transmitter_thread([&]()
+    {
+        DataSampleNumber sample{ 1 };
+        while (transmitting)
+        {
+            writer->write(sample);
+            writer->transmit();
+        }
+    });
+
+    std::vector<std::thread> registration_threads;
+    for (size_t thread_index = 0; thread_index < 4; ++thread_index)
+    {
+        registration_threads.emplace_back([&signal_name]()
+        {
+            for (size_t iteration = 0; iteration < 100; ++iteration)
+            {
+                fep3::native::SimulationBus reader_bus;
+                auto reader = reader_bus.getReader(signal_name, 2);
+                ASSERT_TRUE(reader);
+                EXPECT_LE(reader->size(), 2u);
+            }
+        });
+    }
+    for (auto& registration_thread : registration_threads)
+    {
+        registration_thread.join();
+    }
+
+    transmitting = false;
+    transmitter_thread.join();
+}